@@ -0,0 +1,87 @@
+// Copyright (c) 2012-2014 Rasmus Andersson <http://rsms.me/> See README.md for full MIT license.
+// Compares the cost per code point of folding with normalize(u32), which looks up a two-stage
+// table, and the switch it replaced, on generated Latin, Cyrillic and CJK text.
+#include <rx/rx.h>
+#include <rx/text.hh>
+#include <chrono>
+#include <stdio.h>
+#include "fold-switch.hh"
+
+using namespace rx;
+
+struct Rand {
+  // Deterministic, so that runs see the same text
+  u32 s = 2463534242u;
+  u32 operator()(u32 n) { s ^= s << 13; s ^= s >> 17; s ^= s << 5; return s % n; }
+};
+
+static Text latin(size_t n) {
+  // Words of lowercase ASCII letters with some capitals and Latin-1 letters
+  Rand r;
+  Text t;
+  while (t.size() < n) {
+    for (u32 i = 0, len = 2 + r(8); i != len; ++i) {
+      u32 k = r(100);
+      t.push_back(k < 3 ? 0xC0 + r(0x40) : k < 15 ? 'A' + r(26) : 'a' + r(26));
+    }
+    t.push_back(' ');
+  }
+  return t;
+}
+
+static Text cyrillic(size_t n) {
+  // Words of lowercase Cyrillic letters with some capitals
+  Rand r;
+  Text t;
+  while (t.size() < n) {
+    for (u32 i = 0, len = 2 + r(8); i != len; ++i) {
+      t.push_back(r(100) < 15 ? 0x410 + r(0x20) : 0x430 + r(0x20));
+    }
+    t.push_back(' ');
+  }
+  return t;
+}
+
+static Text cjk(size_t n) {
+  // Mostly CJK ideographs, with hiragana, ideographic punctuation and some ASCII digits
+  Rand r;
+  Text t;
+  while (t.size() < n) {
+    u32 k = r(100);
+    t.push_back(k < 75 ? 0x4E00 + r(0x5200) : k < 92 ? 0x3041 + r(0x56) : k < 96 ? 0x3001 : '0' + r(10));
+  }
+  return t;
+}
+
+template <typename F>
+static double nsPerCodepoint(const Text& t, F fold) {
+  // Best of a few runs
+  double best = 1e9;
+  for (int run = 0; run != 5; ++run) {
+    u32 sum = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (u32 c : t) {
+      sum += fold(c);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    volatile u32 sink = sum;
+    (void)sink;
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / t.size();
+    best = ns < best ? ns : best;
+  }
+  return best;
+}
+
+int main() {
+  const size_t n = 4 << 20;
+  struct { const char* name; Text text; } corpora[] = {
+    {"latin", latin(n)}, {"cyrillic", cyrillic(n)}, {"cjk", cjk(n)},
+  };
+  printf("%-10s %14s %14s\n", "", "switch", "table");
+  for (auto& c : corpora) {
+    double sw = nsPerCodepoint(c.text, normalizeSwitch);
+    double tab = nsPerCodepoint(c.text, (u32(*)(u32))text::normalize);
+    printf("%-10s %8.2f ns/cp %8.2f ns/cp\n", c.name, sw, tab);
+  }
+  return 0;
+}
@@ -0,0 +1,248 @@
+// Copyright (c) 2012-2014 Rasmus Andersson <http://rsms.me/> See README.md for full MIT license.
+#include "rx.h"
+#include "interner.hh"
+#include <vector>
+
+namespace rx {
+namespace text {
+
+// Strings are looked up in open-addressed hash tables, split into shards by the top bits of the
+// hash. Slots hold the upper half of the hash and an id, and are written once, after the entry
+// for the id. A full table is replaced by a copy twice its size, and the old table is kept until
+// the interner is destroyed since readers may still be using it. Readers thus only ever see
+// complete entries and never need a lock, while writers lock the shard they add to.
+//
+// Entries are stored in chunks which double in size, so that an entry never moves and the chunk
+// for an id can be computed from the id alone.
+
+static const u32 shardBits = 4;
+static const u32 shardCount = 1 << shardBits;
+static const u32 firstChunkBits = 8;
+static const u32 chunkCount = 32 - firstChunkBits;
+static const size_t arenaBlockSize = 64 * 1024;
+
+struct Interner::Imp : rx::ref_counted {
+  struct Entry {
+    const char* p;
+    u32         size;
+  };
+  struct Table {
+    u32          mask;
+    u32          count;
+    volatile u64 slots[1]; // (hash >> 32) << 32 | id, or 0 for free slots
+  };
+  struct Shard {
+    Spinlock            lock;
+    Table* volatile     table = nullptr;
+    std::vector<Table*> retired;
+  };
+
+  u8                 options;
+  Shard              shards[shardCount];
+  Shard              foldedShards[shardCount];
+  Spinlock           arenaLock; // guards everything below
+  Entry* volatile    chunks[chunkCount] = {};
+  volatile u32       count = 0;
+  char*              arenaP = nullptr;
+  size_t             arenaFree = 0;
+  std::vector<char*> blocks;
+
+  Imp(u8 options) : options{options} {}
+  ~Imp();
+
+  const Entry& entry(u32 id) const {
+    u32 i = id - 1 + (1u << firstChunkBits);
+    u32 k = 31 - __builtin_clz(i);
+    return chunks[k - firstChunkBits][i - (1u << k)];
+  }
+  u32 add(View);
+};
+
+static Interner::Imp::Table* newTable(u32 capacity) {
+  size_t z = sizeof(Interner::Imp::Table) + (capacity - 1) * sizeof(u64);
+  auto t = (Interner::Imp::Table*)calloc(1, z);
+  t->mask = capacity - 1;
+  return t;
+}
+
+static void freeShard(Interner::Imp::Shard& shard) {
+  free(shard.table);
+  for (auto t : shard.retired) {
+    free(t);
+  }
+}
+
+Interner::Imp::~Imp() {
+  for (u32 i = 0; i != shardCount; ++i) {
+    freeShard(shards[i]);
+    freeShard(foldedShards[i]);
+  }
+  for (u32 k = 0; k != chunkCount; ++k) {
+    delete[] chunks[k];
+  }
+  for (auto p : blocks) {
+    delete[] p;
+  }
+}
+
+u32 Interner::Imp::add(View s) {
+  // Copies `s` to the arena and returns its new id
+  ScopedSpinlock lock{arenaLock};
+  const char* p = ""; // stays so for the empty string, which takes no space
+  if (s.size() > arenaBlockSize / 4) {
+    char* q = new char[s.size()];
+    memcpy(q, s.data(), s.size());
+    blocks.push_back(q);
+    p = q;
+  } else if (!s.empty()) {
+    if (s.size() > arenaFree) {
+      arenaP = new char[arenaBlockSize];
+      arenaFree = arenaBlockSize;
+      blocks.push_back(arenaP);
+    }
+    memcpy(arenaP, s.data(), s.size());
+    p = arenaP;
+    arenaP += s.size();
+    arenaFree -= s.size();
+  }
+  u32 id = count + 1;
+  u32 i = id - 1 + (1u << firstChunkBits);
+  u32 k = 31 - __builtin_clz(i);
+  if (chunks[k - firstChunkBits] == nullptr) {
+    chunks[k - firstChunkBits] = new Entry[1u << k];
+  }
+  chunks[k - firstChunkBits][i - (1u << k)] = Entry{p, (u32)s.size()};
+  rx_atomic_barrier(); // the entry must be complete before its id can be seen
+  count = id;
+  return id;
+}
+
+static u64 hashBytes(View s) {
+  // FNV-1a
+  u64 h = 0xcbf29ce484222325ull;
+  for (char c : s) {
+    h = (h ^ (u8)c) * 0x100000001b3ull;
+  }
+  return h;
+}
+
+template <typename Equal>
+static u32 lookup(const Interner::Imp::Shard& shard, u64 hash, Equal eq) {
+  const Interner::Imp::Table* t = shard.table;
+  if (t == nullptr) {
+    return 0;
+  }
+  u32 tag = (u32)(hash >> 32);
+  for (u32 i = tag & t->mask; ; i = (i + 1) & t->mask) {
+    u64 slot = t->slots[i];
+    if (slot == 0) {
+      return 0;
+    }
+    if ((u32)(slot >> 32) == tag && eq((u32)slot)) {
+      return (u32)slot;
+    }
+  }
+}
+
+static void insertSlot(Interner::Imp::Table* t, u64 slot) {
+  u32 i = (u32)(slot >> 32) & t->mask;
+  while (t->slots[i] != 0) {
+    i = (i + 1) & t->mask;
+  }
+  t->slots[i] = slot;
+  ++t->count;
+}
+
+static void insert(Interner::Imp::Shard& shard, u64 hash, u32 id) {
+  // Must be called with the shard locked
+  Interner::Imp::Table* t = shard.table;
+  if (t == nullptr || (t->count + 1) * 4 > (t->mask + 1) * 3) {
+    auto t2 = newTable(t ? (t->mask + 1) * 2 : 64);
+    if (t != nullptr) {
+      for (u32 i = 0; i <= t->mask; ++i) {
+        if (t->slots[i] != 0) {
+          insertSlot(t2, t->slots[i]);
+        }
+      }
+      shard.retired.push_back(t);
+    }
+    rx_atomic_barrier(); // the copy must be complete before it replaces the old table
+    shard.table = t = t2;
+  }
+  insertSlot(t, ((hash >> 32) << 32) | id);
+}
+
+
+Interner::Interner() : self{nullptr} {}
+
+Interner::Interner(u8 options) : self{new Imp{options}} {}
+
+u32 Interner::intern(View s) {
+  assert(self != nullptr);
+  Imp& a = *self;
+  u64 hash = hashBytes(s);
+  auto eq = [&](u32 id) { return View{a.entry(id).p, a.entry(id).size} == s; };
+  Imp::Shard& shard = a.shards[hash >> (64 - shardBits)];
+  u32 id = lookup(shard, hash, eq);
+  if (id != 0) {
+    return id;
+  }
+  // Folding reports invalid UTF8, which must happen before the string is added
+  u64 fhash = (a.options & Folded) ? FoldedHash{}(s) : 0;
+  {
+    ScopedSpinlock lock{shard.lock};
+    id = lookup(shard, hash, eq); // another thread might have added it
+    if (id != 0) {
+      return id;
+    }
+    id = a.add(s);
+    if (a.options & Folded) {
+      // Strings which fold the same map to the first of them to get here. This must happen before
+      // the id is published below, so that findFolded never misses a string which intern has
+      // returned. Locks are always taken in shard, then folded shard order.
+      auto feq = [&](u32 id) { return equalsFolded(View{a.entry(id).p, a.entry(id).size}, s); };
+      Imp::Shard& fshard = a.foldedShards[fhash >> (64 - shardBits)];
+      ScopedSpinlock flock{fshard.lock};
+      if (lookup(fshard, fhash, feq) == 0) {
+        insert(fshard, fhash, id);
+      }
+    }
+    insert(shard, hash, id);
+  }
+  return id;
+}
+
+u32 Interner::find(View s) const {
+  if (self == nullptr) {
+    return 0;
+  }
+  const Imp& a = *self;
+  u64 hash = hashBytes(s);
+  return lookup(a.shards[hash >> (64 - shardBits)], hash, [&](u32 id) {
+    return View{a.entry(id).p, a.entry(id).size} == s;
+  });
+}
+
+u32 Interner::findFolded(View s) const {
+  if (self == nullptr) {
+    return 0;
+  }
+  const Imp& a = *self;
+  assert(a.options & Folded);
+  u64 fhash = FoldedHash{}(s);
+  return lookup(a.foldedShards[fhash >> (64 - shardBits)], fhash, [&](u32 id) {
+    return equalsFolded(View{a.entry(id).p, a.entry(id).size}, s);
+  });
+}
+
+View Interner::str(u32 id) const {
+  assert(self != nullptr && id != 0 && id <= self->count);
+  const Imp::Entry& e = self->entry(id);
+  return View{e.p, e.size};
+}
+
+size_t Interner::size() const {
+  return self ? self->count : 0;
+}
+
+}} // namespace rx::text
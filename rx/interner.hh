@@ -0,0 +1,36 @@
+// Copyright (c) 2012-2014 Rasmus Andersson <http://rsms.me/> See README.md for full MIT license.
+#pragma once
+#include "text.hh"
+
+namespace rx {
+namespace text {
+
+struct Interner { RX_REF_MIXIN(Interner)
+  // Pool of distinct UTF8 strings, each identified by a 32-bit id, so that comparing interned
+  // strings is an integer comparison. Strings are stored once, back to back, and stay in place
+  // for as long as the interner lives. Lookups never take locks and adding strings only locks the
+  // shard it goes in (and its folded shard), so an interner can be shared freely between threads.
+  enum Options : u8 {
+    Folded = 1 << 0, // Also index strings by their normalized folded version, for findFolded
+  };
+  Interner(); // == nullptr
+  explicit Interner(u8 options);
+
+  u32 intern(View);
+    // Returns the id of a string, adding it to the pool if needed. Ids are assigned in order from
+    // 1, so 0 never refers to a string. With the Folded option, invalid UTF8 is reported like
+    // decodeUTF8 does, before anything is added.
+  u32 find(View) const;
+    // Returns the id of a string, or 0 if it has not been interned
+  u32 findFolded(View) const;
+    // Returns the id of an interned string which equalsFolded the argument, or 0 if there is
+    // none. That is the first such string interned, unless several were interned concurrently,
+    // in which case it's any one of them. Requires the Folded option.
+
+  View str(u32 id) const;
+    // The string with `id`, which must have been returned by intern
+  size_t size() const;
+    // Number of strings in the pool
+};
+
+}} // namespace rx::text
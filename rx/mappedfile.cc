@@ -0,0 +1,169 @@
+// Copyright (c) 2012-2014 Rasmus Andersson <http://rsms.me/> See README.md for full MIT license.
+#include "rx.h"
+#include "mappedfile.hh"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace rx {
+namespace text {
+
+static Status errnoStatus(const char* what) {
+  return Status{(Status::Code)errno, std::string{what} + ": " + strerror(errno)};
+}
+
+
+MappedFile::MappedFile(MappedFile&& f) : _p{f._p}, _z{f._z} {
+  f._p = nullptr;
+  f._z = 0;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& f) {
+  if (this != &f) {
+    close();
+    std::swap(_p, f._p);
+    std::swap(_z, f._z);
+  }
+  return *this;
+}
+
+Status MappedFile::open(const std::string& path, u8 flags) {
+  close();
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return errnoStatus("open");
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    Status s = errnoStatus("fstat");
+    ::close(fd);
+    return s;
+  }
+  if (st.st_size == 0) {
+    ::close(fd); // mmap doesn't do empty mappings
+    return nullptr;
+  }
+  void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  Status s = (p == MAP_FAILED) ? errnoStatus("mmap") : nullptr;
+  ::close(fd); // the mapping keeps the file open
+  if (!s.ok()) {
+    return s;
+  }
+  _p = (const char*)p;
+  _z = (size_t)st.st_size;
+  // Advice is only a hint, so failures are ignored
+  if (flags & Sequential) {
+    madvise(p, _z, MADV_SEQUENTIAL);
+  }
+  #ifdef MADV_HUGEPAGE
+  if (flags & HugePages) {
+    madvise(p, _z, MADV_HUGEPAGE);
+  }
+  #endif
+  return nullptr;
+}
+
+void MappedFile::close() {
+  if (_p != nullptr) {
+    munmap((void*)_p, _z);
+    _p = nullptr;
+    _z = 0;
+  }
+}
+
+void MappedFile::release(size_t offset, size_t size) const {
+  // Only whole pages inside the range can be released
+  size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+  size_t start = (offset + pageSize - 1) & ~(pageSize - 1);
+  size_t end = RX_MIN(offset + size, _z) & ~(pageSize - 1);
+  if (start < end) {
+    madvise((void*)(_p + start), end - start, MADV_DONTNEED);
+  }
+}
+
+
+Status writeAll(int fd, const char* p, size_t z) {
+  while (z != 0) {
+    ssize_t n = ::write(fd, p, z);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return errnoStatus("write");
+    }
+    p += n;
+    z -= (size_t)n;
+  }
+  return nullptr;
+}
+
+
+template <typename F>
+static Status mapToFileImp(int fd, View ins, F& fun, size_t bufferSize, const MappedFile* f) {
+  // Chunks are mapped separately, so early stops need to be carried over to the rest of the
+  // chunks: MapIncludeAll and MapIncludeRest write them as-is, while MapIgnoreAll and
+  // MapIgnoreRest drop them.
+  enum { Continue, IncludeRest, IgnoreRest } stop = Continue;
+  auto mapChar = [&](u32 c) -> u32 {
+    u32 mapped = fun(c);
+    if (mapped == MapIncludeAll || mapped == MapIncludeRest) {
+      stop = IncludeRest;
+    } else if (mapped == MapIgnoreAll || mapped == MapIgnoreRest) {
+      stop = IgnoreRest;
+    }
+    return mapped;
+  };
+  bufferSize = RX_MAX(bufferSize, (size_t)4);
+  std::string outs;
+  outs.reserve(bufferSize + bufferSize / 2);
+  const char* inI = ins.begin();
+  const char* inE = ins.end();
+  while (inI != inE && stop != IgnoreRest) {
+    // End the chunk at the start of a character, unless invalid input has none within reach
+    const char* chunkE = inI + RX_MIN((size_t)(inE - inI), bufferSize);
+    for (const char* p = chunkE; p != inE && p != chunkE - 4; --p) {
+      if (((u8)*p & 0xc0) != 0x80) {
+        chunkE = p;
+        break;
+      }
+    }
+    outs.clear();
+    if (stop == Continue) {
+      mapInto(outs, View{inI, (size_t)(chunkE - inI)}, mapChar);
+    } else {
+      outs.append(inI, chunkE);
+    }
+    Status s = writeAll(fd, outs.data(), outs.size());
+    if (!s.ok()) {
+      return s;
+    }
+    if (f != nullptr) {
+      f->release(inI - f->data(), chunkE - inI);
+    }
+    inI = chunkE;
+  }
+  return nullptr;
+}
+
+Status mapToFile(int fd, View ins, rx::func<u32(u32)> fun, size_t bufferSize) {
+  return mapToFileImp(fd, ins, fun, bufferSize, nullptr);
+}
+
+Status mapToFile(int fd, const MappedFile& f, rx::func<u32(u32)> fun, size_t bufferSize) {
+  return mapToFileImp(fd, f.view(), fun, bufferSize, &f);
+}
+
+Status normalizeToFile(int fd, View ins, size_t bufferSize) {
+  u32(*fun)(u32) = normalize;
+  return mapToFileImp(fd, ins, fun, bufferSize, nullptr);
+}
+
+Status normalizeToFile(int fd, const MappedFile& f, size_t bufferSize) {
+  u32(*fun)(u32) = normalize;
+  return mapToFileImp(fd, f.view(), fun, bufferSize, &f);
+}
+
+}} // namespace rx::text
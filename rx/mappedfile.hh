@@ -0,0 +1,54 @@
+// Copyright (c) 2012-2014 Rasmus Andersson <http://rsms.me/> See README.md for full MIT license.
+#pragma once
+#include "text.hh"
+#include "status.hh"
+
+namespace rx {
+namespace text {
+
+struct MappedFile {
+  // Read-only memory mapping of a file, for processing files with the text functions without
+  // reading them into memory first. Pages are read in by the OS as they are accessed, so files
+  // larger than RAM can be processed front to back.
+  enum Flags : u8 {
+    Sequential = 1 << 0, // Access is mostly sequential: read ahead aggressively
+    HugePages  = 1 << 1, // Hint that huge pages be used for the mapping where supported
+  };
+
+  MappedFile() : _p{nullptr}, _z{0} {}
+  MappedFile(MappedFile&&);
+  MappedFile& operator=(MappedFile&&);
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile() { close(); }
+
+  Status open(const std::string& path, u8 flags = Sequential);
+  void close();
+
+  const char* data() const { return _p; }
+  size_t size() const { return _z; }
+  View view() const { return View{_p, _z}; }
+  operator View() const { return view(); }
+
+  void release(size_t offset, size_t size) const;
+    // Tell the OS that a range of the file won't be accessed again soon, so that its pages can be
+    // evicted from memory right away.
+
+private:
+  const char* _p;
+  size_t      _z;
+};
+
+Status writeAll(int fd, const char* p, size_t z);
+  // Write all bytes to a file descriptor, retrying on partial writes and EINTR
+
+Status mapToFile(int fd, View, rx::func<u32(u32)>, size_t bufferSize = 1024 * 1024);
+Status mapToFile(int fd, const MappedFile&, rx::func<u32(u32)>, size_t bufferSize = 1024 * 1024);
+Status normalizeToFile(int fd, View, size_t bufferSize = 1024 * 1024);
+Status normalizeToFile(int fd, const MappedFile&, size_t bufferSize = 1024 * 1024);
+  // Versions of map and normalize which write their output to a file descriptor. The input is
+  // processed `bufferSize` bytes at a time, so memory use stays bounded however large the input
+  // is. The MappedFile versions also release input pages once they have been processed. For
+  // output to a caller buffer, see mapInto(char*, size_t, View, F).
+
+}} // namespace rx::text
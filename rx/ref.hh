@@ -165,11 +165,12 @@ static inline RX_UNUSED bool refcount_release(volatile refcount_t& __refcount) {
     return std::move(p); \
   } \
   T& operator=(T&& rhs) { \
-    if (self != rhs.self) { \
-      __release(self); \
+    if (this != &rhs) { \
+      Imp* old = self; \
       self = rhs.self; \
+      rhs.self = 0; \
+      __release(old); /* also when rhs referenced the same object, as its reference moved here */ \
     } \
-    rhs.self = 0; \
     return *this; \
   } \
   T& operator=(const T& rhs) { return reset_self(rhs.self); } \
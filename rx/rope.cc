@@ -0,0 +1,329 @@
+// Copyright (c) 2012-2014 Rasmus Andersson <http://rsms.me/> See README.md for full MIT license.
+#include "rx.h"
+#include "rope.hh"
+#include <vector>
+
+namespace rx {
+namespace text {
+
+// Ropes are AVL trees. Leaves hold up to maxLeafSize bytes of text, and branches hold the sum of
+// their children's metrics so that positions can be found without visiting the leaves.
+struct Rope::Imp : rx::ref_counted {
+  size_t      bytes      = 0;
+  size_t      codepoints = 0;
+  size_t      newlines   = 0;
+  u8          height     = 0; // 0 for leaves
+  Rope        left;           // branches only
+  Rope        right;          // branches only
+  std::string text;           // leaves only
+};
+
+static const size_t maxLeafSize = 2048;
+
+static inline bool isTrail(u8 b) { return (b & 0xc0) == 0x80; }
+
+static inline u8 height(const Rope& r) { return r ? r->height : 0; }
+
+static Rope makeLeaf(std::string text) {
+  auto n = new Rope::Imp;
+  for (char c : text) {
+    n->codepoints += !isTrail((u8)c);
+    n->newlines += c == '\n';
+  }
+  n->bytes = text.size();
+  n->text = std::move(text);
+  return Rope{n};
+}
+
+static Rope makeBranch(const Rope& l, const Rope& r) {
+  auto n = new Rope::Imp;
+  n->bytes = l->bytes + r->bytes;
+  n->codepoints = l->codepoints + r->codepoints;
+  n->newlines = l->newlines + r->newlines;
+  n->height = RX_MAX(l->height, r->height) + 1;
+  n->left = l;
+  n->right = r;
+  return Rope{n};
+}
+
+static void makeLeaves(View s, std::vector<Rope>& leaves) {
+  // Splits `s` into leaves which end at code point boundaries
+  const char* p = s.begin();
+  const char* e = s.end();
+  while (p != e) {
+    const char* z = p + RX_MIN((size_t)(e - p), maxLeafSize);
+    if (z != e) {
+      // Move back to the start of a code point, unless invalid input has none within reach
+      const char* b = z;
+      while (b != p && z - b < 3 && isTrail((u8)*b)) {
+        --b;
+      }
+      if (b != p && !isTrail((u8)*b)) {
+        z = b;
+      }
+    }
+    leaves.push_back(makeLeaf(std::string{p, (size_t)(z - p)}));
+    p = z;
+  }
+}
+
+static Rope buildBalanced(const std::vector<Rope>& leaves, size_t lo, size_t hi) {
+  if (hi - lo == 1) {
+    return leaves[lo];
+  }
+  size_t mid = lo + (hi - lo) / 2;
+  return makeBranch(buildBalanced(leaves, lo, mid), buildBalanced(leaves, mid, hi));
+}
+
+static Rope buildBalanced(const std::vector<Rope>& leaves) {
+  return leaves.empty() ? Rope{} : buildBalanced(leaves, 0, leaves.size());
+}
+
+static Rope balance(const Rope& a, const Rope& b) {
+  // Joins two trees whose heights differ by at most two
+  int ha = height(a), hb = height(b);
+  if (ha > hb + 1) {
+    if (height(a->left) >= height(a->right)) {
+      return makeBranch(a->left, makeBranch(a->right, b));
+    }
+    return makeBranch(makeBranch(a->left, a->right->left), makeBranch(a->right->right, b));
+  }
+  if (hb > ha + 1) {
+    if (height(b->right) >= height(b->left)) {
+      return makeBranch(makeBranch(a, b->left), b->right);
+    }
+    return makeBranch(makeBranch(a, b->left->left), makeBranch(b->left->right, b->right));
+  }
+  return makeBranch(a, b);
+}
+
+static Rope join(const Rope& l, const Rope& r) {
+  if (!l) {
+    return r;
+  }
+  if (!r) {
+    return l;
+  }
+  int hl = l->height, hr = r->height;
+  if (hl == 0 && hr == 0 && l->bytes + r->bytes <= maxLeafSize) {
+    return makeLeaf(l->text + r->text);
+  }
+  if (hl > hr + 1) {
+    return balance(l->left, join(l->right, r));
+  }
+  if (hr > hl + 1) {
+    return balance(join(l, r->left), r->right);
+  }
+  return makeBranch(l, r);
+}
+
+static size_t leafByteOffset(const std::string& s, size_t index) {
+  // Byte offset of the code point at `index` in a leaf, or its size if past the end
+  size_t i = 0, z = s.size();
+  for (; i != z; ++i) {
+    if (!isTrail((u8)s[i])) {
+      if (index == 0) {
+        break;
+      }
+      --index;
+    }
+  }
+  return i;
+}
+
+static void split(const Rope& n, size_t index, Rope& l, Rope& r) {
+  // Splits `n` into the code points before and from `index`
+  if (!n || index == 0) {
+    l = nullptr;
+    r = n;
+  } else if (index >= n->codepoints) {
+    l = n;
+    r = nullptr;
+  } else if (n->height == 0) {
+    size_t i = leafByteOffset(n->text, index);
+    l = makeLeaf(n->text.substr(0, i));
+    r = makeLeaf(n->text.substr(i));
+  } else if (index < n->left->codepoints) {
+    Rope r2;
+    split(n->left, index, l, r2);
+    r = join(r2, n->right);
+  } else {
+    Rope l2;
+    split(n->right, index - n->left->codepoints, l2, r);
+    l = join(n->left, l2);
+  }
+}
+
+
+Rope::Rope() : self{nullptr} {}
+
+Rope::Rope(View s) : self{nullptr} {
+  std::vector<Rope> leaves;
+  makeLeaves(s, leaves);
+  *this = buildBalanced(leaves);
+}
+
+size_t Rope::size() const { return self ? self->bytes : 0; }
+size_t Rope::length() const { return self ? self->codepoints : 0; }
+size_t Rope::lines() const { return self ? self->newlines : 0; }
+
+u32 Rope::at(size_t index) const {
+  assert(index < length());
+  const Imp* n = self;
+  while (n->height != 0) {
+    if (index < n->left->codepoints) {
+      n = n->left.self;
+    } else {
+      index -= n->left->codepoints;
+      n = n->right.self;
+    }
+  }
+  const char* p = n->text.data() + leafByteOffset(n->text, index);
+  const char* e = p + 1;
+  while (e != n->text.data() + n->text.size() && isTrail((u8)*e)) {
+    ++e;
+  }
+  if (!isValidUTF8(p, e - p)) {
+    // Let decodeUTF8 deal with (and report) the invalid input
+    return decodeUTF8(std::string{p, (size_t)(e - p)})[0];
+  }
+  return _nextValidUTF8(p);
+}
+
+Rope Rope::concat(const Rope& a, const Rope& b) {
+  return join(a, b);
+}
+
+Rope Rope::insert(size_t index, const Rope& r) const {
+  Rope a, b;
+  split(*this, index, a, b);
+  return join(join(a, r), b);
+}
+
+Rope Rope::insert(size_t index, View s) const {
+  return insert(index, Rope{s});
+}
+
+Rope Rope::erase(size_t index, size_t count) const {
+  Rope a, b, c, d;
+  split(*this, index, a, b);
+  split(b, count, c, d);
+  return join(a, d);
+}
+
+Rope Rope::slice(size_t index, size_t count) const {
+  Rope a, b, c, d;
+  split(*this, index, a, b);
+  split(b, count, c, d);
+  return c;
+}
+
+size_t Rope::lineStart(size_t line) const {
+  if (line == 0) {
+    return 0;
+  }
+  if (line > lines()) {
+    return length();
+  }
+  // Find the line'th newline and return the index after it
+  size_t index = 0;
+  const Imp* n = self;
+  while (n->height != 0) {
+    if (line <= n->left->newlines) {
+      n = n->left.self;
+    } else {
+      line -= n->left->newlines;
+      index += n->left->codepoints;
+      n = n->right.self;
+    }
+  }
+  for (char c : n->text) {
+    index += !isTrail((u8)c);
+    if (c == '\n' && --line == 0) {
+      break;
+    }
+  }
+  return index;
+}
+
+size_t Rope::lineOf(size_t index) const {
+  if (index >= length()) {
+    return lines();
+  }
+  size_t line = 0;
+  const Imp* n = self;
+  while (n->height != 0) {
+    if (index < n->left->codepoints) {
+      n = n->left.self;
+    } else {
+      index -= n->left->codepoints;
+      line += n->left->newlines;
+      n = n->right.self;
+    }
+  }
+  const char* p = n->text.data();
+  const char* e = p + leafByteOffset(n->text, index);
+  for (; p != e; ++p) {
+    line += *p == '\n';
+  }
+  return line;
+}
+
+static bool eachLeaf(const Rope& n, const rx::func<bool(const Rope&)>& fun) {
+  if (n->height == 0) {
+    return fun(n);
+  }
+  return eachLeaf(n->left, fun) && eachLeaf(n->right, fun);
+}
+
+bool Rope::_eachChunk(const rx::func<bool(View)>& fun) const {
+  return !self || eachLeaf(*this, [&](const Rope& leaf) { return fun(View{leaf->text}); });
+}
+
+std::string Rope::str() const {
+  std::string s;
+  s.reserve(size());
+  eachChunk([&](View v) { s.append(v.begin(), v.end()); return true; });
+  return s;
+}
+
+
+Rope map(const Rope& r, rx::func<u32(u32)> fun) {
+  // Each leaf is mapped separately, so early stops need to be carried over to the rest of the
+  // leaves: MapIncludeAll and MapIncludeRest keep them as-is, while MapIgnoreAll and
+  // MapIgnoreRest drop them.
+  enum { Continue, IncludeRest, IgnoreRest } stop = Continue;
+  auto f = [&](u32 c) -> u32 {
+    u32 mapped = fun(c);
+    if (mapped == MapIncludeAll || mapped == MapIncludeRest) {
+      stop = IncludeRest;
+    } else if (mapped == MapIgnoreAll || mapped == MapIgnoreRest) {
+      stop = IgnoreRest;
+    }
+    return mapped;
+  };
+  std::vector<Rope> leaves;
+  std::string pending;
+  if (r) {
+    eachLeaf(r, [&](const Rope& leaf) {
+      if (stop == IncludeRest) {
+        leaves.push_back(leaf);
+        return true;
+      }
+      mapInto(pending, View{leaf->text}, f);
+      if (pending.size() >= maxLeafSize || stop != Continue) {
+        makeLeaves(pending, leaves);
+        pending.clear();
+      }
+      return stop != IgnoreRest;
+    });
+  }
+  makeLeaves(pending, leaves);
+  return buildBalanced(leaves);
+}
+
+Rope filter(const Rope& r, rx::func<bool(u32)> f) {
+  return map(r, [&](u32 c) -> u32 { return f(c) ? c : (u32)MapIgnore; });
+}
+
+}} // namespace rx::text
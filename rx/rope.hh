@@ -0,0 +1,58 @@
+// Copyright (c) 2012-2014 Rasmus Andersson <http://rsms.me/> See README.md for full MIT license.
+#pragma once
+#include "text.hh"
+
+namespace rx {
+namespace text {
+
+struct Rope { RX_REF_MIXIN(Rope)
+  // Immutable UTF8 text stored as a balanced tree of reference-counted chunks, for large
+  // documents which are edited often. Edits return a new rope which shares all unchanged chunks
+  // with the original, so keeping snapshots around is cheap. Positions are code point indices.
+  // Edits and lookups take O(log n) time.
+  Rope(); // == nullptr, the empty rope
+  explicit Rope(View);
+
+  size_t size() const;   // length in bytes
+  size_t length() const; // length in code points
+  size_t lines() const;  // number of '\n' characters
+  bool empty() const { return self == nullptr; }
+
+  u32 at(size_t index) const;
+    // Code point at `index`, which must be less than length()
+
+  Rope insert(size_t index, const Rope&) const;
+  Rope insert(size_t index, View) const;
+  Rope erase(size_t index, size_t count) const;
+  Rope slice(size_t index, size_t count) const;
+    // Indices and counts are clamped to the length of the rope
+
+  static Rope concat(const Rope&, const Rope&);
+
+  size_t lineStart(size_t line) const;
+    // Index of the first code point on zero-based `line`, or length() if there's no such line
+  size_t lineOf(size_t index) const;
+    // Zero-based line of the code point at `index`, that is the number of '\n' before it
+
+  template <typename F> void eachChunk(F fun) const;
+    // Calls fun(View) for each chunk of text in order. Chunks always end at code point
+    // boundaries. Iteration stops early if `fun` returns false.
+
+  std::string str() const;
+
+  // Internal
+  bool _eachChunk(const rx::func<bool(View)>&) const;
+};
+
+Rope map(const Rope&, rx::func<u32(u32)>);
+Rope filter(const Rope&, rx::func<bool(u32)>);
+  // Versions of map and filter for ropes, with the same semantics as for UTF8 strings. Chunks
+  // which follow an early stop like MapIncludeRest are shared with the input rope.
+
+// ------------------------------------------------------------------------------------------------
+
+template <typename F> inline void Rope::eachChunk(F fun) const {
+  _eachChunk([&](View v) { return fun(v); });
+}
+
+}} // namespace rx::text
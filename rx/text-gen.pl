@@ -1,23 +1,37 @@
 #!/usr/bin/env perl
+#
+# Usage: text-gen.pl <ucddir> > out.cc
+#
+# Reads UnicodeData.txt, LineBreak.txt, CaseFolding.txt, DerivedNormalizationProps.txt and
+# EastAsianWidth.txt from <ucddir>, and emoji/emoji-data.txt if there is one. These can be
+# downloaded from http://www.unicode.org/Public/<version>/ucd/
+#
 use strict;
 use warnings;
-use LWP::Simple;
-use Cwd 'chdir';
 use File::Basename;
-use File::Slurp 'read_file';
 
+my $ucddir = shift(@ARGV) || '.';
 my $s;
 
-print "// Generated by ".basename(__FILE__)."\n";
-
 sub fmtcp {
   return sprintf("%x", hex($_[0]));
 }
 
+sub read_ucd {
+  my $filename = "$ucddir/$_[0]";
+  open(my $fh, '<', $filename) or die "$filename: $!";
+  local $/;
+  return <$fh>;
+}
+
+# UnicodeData.txt has no header, so take the version from the first line of CaseFolding.txt, e.g.
+# "# CaseFolding-14.0.0.txt"
+my ($version) = read_ucd('CaseFolding.txt') =~ m/^# CaseFolding-([\d.]+)\.txt/;
+print "// Generated by ".basename(__FILE__)." from Unicode ".($version // 'unknown')." data\n";
+
 # ===============================================================================================
 
-$s = LWP::Simple::get('http://www.unicode.org/Public/7.0.0/ucd/UnicodeData.txt') or die;
-# $s = read_file('UnicodeData.txt');
+$s = read_ucd('UnicodeData.txt');
 
 my @whitespaceCodepoints = ();
 my @controlCodepoints = ();
@@ -53,8 +67,7 @@ for (split /^/, $s) {
 
 # ===============================================================================================
 
-$s = LWP::Simple::get('http://www.unicode.org/Public/7.0.0/ucd/LineBreak.txt') or die;
-# $s = read_file('LineBreak.txt');
+$s = read_ucd('LineBreak.txt');
 
 my @linebreakCodepoints = ();
 
@@ -115,39 +128,311 @@ print "\n};\n\n";
 
 # ===============================================================================================
 
-$s = LWP::Simple::get('http://www.unicode.org/Public/UNIDATA/CaseFolding.txt') or die;
-# $s = read_file('CaseFolding.txt');
+$s = read_ucd('CaseFolding.txt');
 
-# Remove whole-line comments and empty lines
-$s =~ s/^#.*\n//mg;
-$s =~ s/^[\s\t ]*\n//mg;
+# Common and simple folds (status C and S.) Full folds (F) would cause strings to grow in length
+# and we are performing simple point-to-point folds. Special-case Turkic folds (T) are not used in
+# other languages.
+my %folds = ();
+for (split /^/, $s) {
+  if (m/^([0-9A-F]+); [CS]; ([0-9A-F]+); #/) {
+    $folds{hex($1)} = hex($2);
+  }
+}
 
-# Remove full folds (we are performing simple folds aka point-to-point folds)
-# Mappings that cause strings to grow in length. Multiple characters are separated by spaces.
-$s =~ s/^.+ F; .+\n//mg;
+# Two-stage table: code points are split into blocks of 128, and each distinct block of deltas
+# (folded minus original code point) is stored once. Code points at or above the limit (the end of
+# the last block containing a fold) are never folded. Block 0 is the identity block.
+my $foldBlockShift = 7;
+my $foldBlockSize = 1 << $foldBlockShift;
+my $foldMax = 0;
+for (keys %folds) {
+  $foldMax = $_ if $_ > $foldMax;
+}
+my $foldLimit = (($foldMax >> $foldBlockShift) + 1) << $foldBlockShift;
 
-# Remove special-case Turkic uppercase I and dotted uppercase I folding not used in other languages.
-$s =~ s/^.+ T; .+\n//mg;
+my @foldBlocks = (join(',', (0) x $foldBlockSize)); # block 0 folds nothing
+my %foldBlockIds = ($foldBlocks[0] => 0);
+my @foldIndex = ();
+for (my $start = 0; $start != $foldLimit; $start += $foldBlockSize) {
+  my @deltas = map { exists $folds{$_} ? $folds{$_} - $_ : 0 } ($start .. $start + $foldBlockSize - 1);
+  my $key = join(',', @deltas);
+  if (!exists $foldBlockIds{$key}) {
+    $foldBlockIds{$key} = scalar(@foldBlocks);
+    push(@foldBlocks, join(',', @deltas));
+  }
+  push(@foldIndex, $foldBlockIds{$key});
+}
 
-# Common and simple folds
-my $s_constexpr = $s;
-$s           =~ s/^(.+); [CS]; (.+); # (.+)\n/    case 0x$1: return 0x$2; \/\/ $3\n/gm;
-$s_constexpr =~ s/^(.+); [CS]; (.+); # (.+)\n/    uc == 0x$1 ? 0x$2 : \/\/ $3\n/gm;
+sub print_rows {
+  my ($indent, $perRow, @v) = @_;
+  for (my $i = 0; $i < @v; $i += $perRow) {
+    my $end = $i + $perRow - 1;
+    $end = $#v if $end > $#v;
+    print $indent.join(',', @v[$i..$end]).",\n";
+  }
+}
 
 # Print results to stdout
+printf("static const u32 caseFoldLimit = 0x%X;\n\n", $foldLimit);
+printf("static const %s caseFoldIndex[%d] = {\n", (@foldBlocks > 256 ? 'u16' : 'u8'), scalar(@foldIndex));
+print_rows('  ', 32, @foldIndex);
+print("};\n\n");
+printf("static const i32 caseFoldDeltas[%d][%d] = {\n", scalar(@foldBlocks), $foldBlockSize);
+for (@foldBlocks) {
+  print("  {\n");
+  print_rows('    ', 16, split(/,/, $_));
+  print("  },\n");
+}
+print("};\n\n");
 print("u32 normalize(u32 uc) {\n");
-print("  switch (uc) {\n");
-print($s);
-print("    default: return uc; // Not folded\n");
-print("  }\n");
-print("}\n");
+printf("  return (uc < caseFoldLimit) ? uc + caseFoldDeltas[caseFoldIndex[uc >> %d]][uc & 0x%x] : uc;\n",
+  $foldBlockShift, $foldBlockSize - 1);
+print("}\n\n");
 
-# Constexpr version:
-# print("\n");
-# print("// Generated by ".basename(__FILE__)."\n");
-# print("constexpr u32 toLowerCX(u32 uc) {\n");
-# print("  return \n");
-# print($s_constexpr);
-# print("    uc; // Not folded\n");
-# print("}\n");
+# The inverse of the folds, for finding all characters which fold to a given one: pairs of folded
+# and original code points, sorted by folded and then original code point for binary search.
+my @unfolds = sort { $a->[0] <=> $b->[0] || $a->[1] <=> $b->[1] } map { [$folds{$_}, $_] } keys %folds;
+printf("static const u32 caseUnfoldKeys[%d] = {\n", scalar(@unfolds));
+print_rows('  ', 12, map { sprintf("0x%X", $_->[0]) } @unfolds);
+print("};\n\n");
+printf("static const u32 caseUnfoldValues[%d] = {\n", scalar(@unfolds));
+print_rows('  ', 12, map { sprintf("0x%X", $_->[1]) } @unfolds);
+print("};\n");
+
+# ===============================================================================================
 
+# Normalization forms. Canonical combining classes and decompositions come from UnicodeData.txt,
+# and quick check values and composition exclusions from DerivedNormalizationProps.txt. Hangul
+# syllables are decomposed and composed algorithmically and have no entries in these tables.
+#
+#  Example line: "00C0;LATIN CAPITAL LETTER A WITH GRAVE;Lu;0;L;0041 0300;;;;N;..."
+#  Field:            0;                                 1; 2;3;4;        5;...
+#
+$s = read_ucd('UnicodeData.txt');
+
+my %ccc = ();
+my %canonicalMapping = ();
+my %compatMapping = ();
+for (split /^/, $s) {
+  my @entry = split(/;/, $_);
+  my $cp = hex($entry[0]);
+  $ccc{$cp} = int($entry[3]) if $entry[3] ne '0';
+  if ($entry[5] =~ m/^<\w+>\s*(.+)$/) {
+    $compatMapping{$cp} = [map { hex($_) } split(/ /, $1)];
+  } elsif ($entry[5] ne '') {
+    $canonicalMapping{$cp} = [map { hex($_) } split(/ /, $entry[5])];
+  }
+}
+
+$s = read_ucd('DerivedNormalizationProps.txt');
+
+#  Example lines: "0340..0341    ; Full_Composition_Exclusion # Mn   [2] COMBINING GRAVE..."
+#                 "0300..0304    ; NFC_QC; M # Mn   [5] COMBINING GRAVE ACCENT..."
+my %compositionExcluded = ();
+my %quickCheck = (); # "NFC_QC" => { cp => "N" or "M" }
+for (split /^/, $s) {
+  if (m/^([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*(\w+)(?:\s*;\s*(\w+))?/) {
+    my ($first, $last, $prop, $value) = (hex($1), hex($2 // $1), $3, $4);
+    for my $cp ($first .. $last) {
+      if ($prop eq 'Full_Composition_Exclusion') {
+        $compositionExcluded{$cp} = 1;
+      } elsif ($prop =~ m/^NFK?[CD]_QC$/) {
+        $quickCheck{$prop}{$cp} = $value;
+      }
+    }
+  }
+}
+
+sub decompose {
+  # Full decomposition of a code point, applying compatibility mappings too if $compat is set
+  my ($cp, $compat) = @_;
+  my $m = $canonicalMapping{$cp} // ($compat ? $compatMapping{$cp} : undef);
+  return ($cp) if !defined $m;
+  return map { decompose($_, $compat) } @$m;
+}
+
+# Per code point properties: the combining class in the low 8 bits, followed by two bits each for
+# NFC_QC, NFD_QC, NFKC_QC and NFKD_QC (in the order of NormalizationForm): 0 for yes, 1 for maybe
+# and 2 for no.
+my %qcValues = ('Y' => 0, 'M' => 1, 'N' => 2);
+my %props = ();
+for my $cp (keys %ccc) {
+  $props{$cp} = $ccc{$cp};
+}
+my @qcProps = ('NFC_QC', 'NFD_QC', 'NFKC_QC', 'NFKD_QC');
+for my $i (0 .. $#qcProps) {
+  my $qc = $quickCheck{$qcProps[$i]};
+  for my $cp (keys %$qc) {
+    $props{$cp} |= $qcValues{$qc->{$cp}} << (8 + 2 * $i);
+  }
+}
+
+# Decompositions are stored back to back. Each starts with a header of the canonical length in the
+# low 8 bits, the compatibility length in bits 8-15 and the offset of the compatibility mapping
+# from the first mapped code point in bits 16-23. A canonical length of zero means that the code
+# point only has a compatibility mapping. Entry 0 is unused so that offset 0 means no mapping.
+my @decompData = (0);
+my %decompOffsets = ();
+for my $cp (sort { $a <=> $b } (keys %canonicalMapping, grep { !exists $canonicalMapping{$_} } keys %compatMapping)) {
+  my @canonical = exists $canonicalMapping{$cp} ? decompose($cp, 0) : ();
+  my @compat = decompose($cp, 1);
+  my $shared = join(',', @canonical) eq join(',', @compat);
+  $decompOffsets{$cp} = scalar(@decompData);
+  push(@decompData, scalar(@canonical) | (scalar(@compat) << 8) | (($shared ? 0 : scalar(@canonical)) << 16));
+  push(@decompData, @canonical);
+  push(@decompData, @compat) if !$shared;
+}
+
+# Primary composites: canonical mappings of two code points which are not excluded from
+# composition, sorted by (first << 21 | second) for binary search.
+my @compositions = ();
+for my $cp (keys %canonicalMapping) {
+  my $m = $canonicalMapping{$cp};
+  if (@$m == 2 && !$compositionExcluded{$cp}) {
+    push(@compositions, [($m->[0] << 21) | $m->[1], $cp]);
+  }
+}
+@compositions = sort { $a->[0] <=> $b->[0] } @compositions;
+
+sub print_two_stage {
+  # Prints a two-stage lookup table for %$values (code point => value, missing values are 0) as
+  # $name.Index and $name.Blocks, with an inline function $name(u32) to look up a code point.
+  my ($name, $type, $shift, $values) = @_;
+  my $blockSize = 1 << $shift;
+  my $max = 0;
+  for (keys %$values) {
+    $max = $_ if $_ > $max;
+  }
+  my $limit = (($max >> $shift) + 1) << $shift;
+  my @blocks = (join(',', (0) x $blockSize));
+  my %blockIds = ($blocks[0] => 0);
+  my @index = ();
+  for (my $start = 0; $start != $limit; $start += $blockSize) {
+    my $key = join(',', map { $values->{$_} // 0 } ($start .. $start + $blockSize - 1));
+    if (!exists $blockIds{$key}) {
+      $blockIds{$key} = scalar(@blocks);
+      push(@blocks, $key);
+    }
+    push(@index, $blockIds{$key});
+  }
+  printf("static const %s %sIndex[%d] = {\n", (@blocks > 256 ? 'u16' : 'u8'), $name, scalar(@index));
+  print_rows('  ', 32, @index);
+  print("};\n\n");
+  printf("static const %s %sBlocks[%d][%d] = {\n", $type, $name, scalar(@blocks), $blockSize);
+  for (@blocks) {
+    print("  {\n");
+    print_rows('    ', 16, split(/,/, $_));
+    print("  },\n");
+  }
+  print("};\n\n");
+  printf("static inline %s %s(u32 uc) {\n", $type, $name);
+  printf("  return (uc < 0x%X) ? %sBlocks[%sIndex[uc >> %d]][uc & 0x%x] : 0;\n",
+    $limit, $name, $name, $shift, $blockSize - 1);
+  print("}\n\n");
+}
+
+print("\n");
+print_two_stage('normProps', 'u16', 6, \%props);
+print_two_stage('normDecompOffset', 'u16', 6, \%decompOffsets);
+printf("static const u32 normDecompData[%d] = {\n", scalar(@decompData));
+print_rows('  ', 8, map { sprintf("0x%X", $_) } @decompData);
+print("};\n\n");
+printf("static const u64 normCompositionKeys[%d] = {\n", scalar(@compositions));
+print_rows('  ', 6, map { sprintf("0x%Xull", $_->[0]) } @compositions);
+print("};\n\n");
+printf("static const u32 normCompositionValues[%d] = {\n", scalar(@compositions));
+print_rows('  ', 12, map { sprintf("0x%X", $_->[1]) } @compositions);
+print("};\n");
+
+# ===============================================================================================
+
+# Display widths in terminal columns. Nonspacing and enclosing marks, format characters (except
+# soft hyphen), controls and Hangul medial vowels and final consonants take no columns. Wide and
+# fullwidth characters, and emoji which are presented as such by default, take two columns.
+# Everything else takes one column.
+#
+#  Example lines: "0020;Na         # Zs         SPACE"
+#                 "1F300..1F320;W  # So    [33] CYCLONE..SHOOTING STAR"
+my %widths = ();
+$s = read_ucd('EastAsianWidth.txt');
+for (split /^/, $s) {
+  if (m/^([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*(\w+)/ && ($3 eq 'W' || $3 eq 'F')) {
+    $widths{$_} = 2 for (hex($1) .. hex($2 // $1));
+  }
+}
+if (-e "$ucddir/emoji/emoji-data.txt") {
+  $s = read_ucd('emoji/emoji-data.txt');
+  for (split /^/, $s) {
+    if (m/^([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*Emoji_Presentation\b/) {
+      $widths{$_} = 2 for (hex($1) .. hex($2 // $1));
+    }
+  }
+}
+$s = read_ucd('UnicodeData.txt');
+for (split /^/, $s) {
+  my @entry = split(/;/, $_);
+  my $cp = hex($entry[0]);
+  if ($entry[2] =~ m/^(Mn|Me|Cf|Cc)$/ && $cp != 0xAD) {
+    $widths{$cp} = 0;
+  }
+}
+$widths{$_} = 0 for (0x1160 .. 0x11FF, 0xD7B0 .. 0xD7FF, 0x200B);
+
+# Three-stage table of 2-bit widths: 4096 code point planes (stage 1) are split into 32 blocks of
+# 128 code points (stage 2), whose widths are packed four to a byte. Identical rows and blocks are
+# stored once.
+my %rowIds = ();
+my @rows = ();
+my %widthBlockIds = ();
+my @widthBlocks = ();
+my @stage1 = ();
+for (my $plane = 0; $plane != 0x110000; $plane += 4096) {
+  my @row = ();
+  for (my $start = $plane; $start != $plane + 4096; $start += 128) {
+    my @bytes = ();
+    for (my $i = $start; $i != $start + 128; $i += 4) {
+      my $b = 0;
+      $b |= ($widths{$i + $_} // 1) << (2 * $_) for (0 .. 3);
+      push(@bytes, $b);
+    }
+    my $key = join(',', @bytes);
+    if (!exists $widthBlockIds{$key}) {
+      $widthBlockIds{$key} = scalar(@widthBlocks);
+      push(@widthBlocks, $key);
+    }
+    push(@row, $widthBlockIds{$key});
+  }
+  my $key = join(',', @row);
+  if (!exists $rowIds{$key}) {
+    $rowIds{$key} = scalar(@rows);
+    push(@rows, $key);
+  }
+  push(@stage1, $rowIds{$key});
+}
+
+print("\n");
+printf("static const u8 charWidthStage1[%d] = {\n", scalar(@stage1));
+print_rows('  ', 32, @stage1);
+print("};\n\n");
+printf("static const %s charWidthStage2[%d][32] = {\n", (@widthBlocks > 256 ? 'u16' : 'u8'), scalar(@rows));
+for (@rows) {
+  print("  {\n");
+  print_rows('    ', 16, split(/,/, $_));
+  print("  },\n");
+}
+print("};\n\n");
+printf("static const u8 charWidthBlocks[%d][32] = {\n", scalar(@widthBlocks));
+for (@widthBlocks) {
+  print("  {\n");
+  print_rows('    ', 16, map { sprintf("0x%02x", $_) } split(/,/, $_));
+  print("  },\n");
+}
+print("};\n\n");
+print("static inline u32 charWidth(u32 uc) {\n");
+print("  if (uc >= 0x110000) {\n");
+print("    return 1;\n");
+print("  }\n");
+print("  u32 block = charWidthStage2[charWidthStage1[uc >> 12]][(uc >> 7) & 31];\n");
+print("  return (charWidthBlocks[block][(uc >> 2) & 31] >> ((uc & 3) * 2)) & 3;\n");
+print("}\n");
@@ -1,9 +1,10 @@
 // Copyright (c) 2012-2014 Rasmus Andersson <http://rsms.me/> See README.md for full MIT license.
 #include "rx.h"
 #include "text.hh"
+#include "thread.hh"
 
+#include "utf8/unchecked.h"
 #ifdef RX_TARGET_BUILD_NO_CXX_EXCEPTIONS
-  #include "utf8/unchecked.h"
   namespace _utf8 = utf8::unchecked;
   #define UTF8_NEXT(inI, inE) _utf8::next((inI))
 #else
@@ -14,156 +15,2984 @@
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <exception>
 using std::cerr;
 using std::endl;
 
+
+// SIMD code paths. SSE2 is part of the x86-64 baseline; SSSE3 and AVX2 are selected at runtime on
+// CPUs that support them. NEON is part of the arm64 baseline. Other targets use scalar code.
+#if defined(__SSE2__)
+  #include <emmintrin.h>
+  #define RX_TEXT_SIMD_SSE2 1
+  #if defined(__GNUC__) && __has_attribute(target)
+    #include <immintrin.h>
+    #include <tmmintrin.h>
+    #define RX_TEXT_SIMD_AVX2 1
+    #define RX_TEXT_TARGET_AVX2 __attribute__((target("avx2")))
+    #define RX_TEXT_SIMD_SSSE3 1
+    #define RX_TEXT_TARGET_SSSE3 __attribute__((target("ssse3")))
+  #endif
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(__arm64__))
+  #include <arm_neon.h>
+  #define RX_TEXT_SIMD_NEON 1
+#endif
+
+
+namespace rx {
+namespace text {
+namespace simd {
+
+#if RX_TEXT_SIMD_AVX2
+static bool cpuHasAVX2() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+}
+static bool cpuHasSSSE3() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("ssse3");
+}
+static const bool hasAVX2 = cpuHasAVX2();
+static const bool hasSSSE3 = cpuHasSSSE3();
+  // Zero-initialized (false) until static initialization of this unit has run, so any calls
+  // made from other static initializers before then simply take the SSE2 or scalar paths.
+#endif
+
+
+static inline bool isTrail(u8 b) { return (b & 0xc0) == 0x80; }
+
+
+// Returns the number of code points in a UTF8 string, that is the number of bytes which are not
+// continuation bytes. The result is exact for valid UTF8.
+#if RX_TEXT_SIMD_AVX2
+RX_TEXT_TARGET_AVX2
+static size_t countCodepointsAVX2(const u8* p, size_t z) {
+  size_t n = 0, i = 0;
+  const __m256i trail = _mm256_set1_epi8(-65); // (i8)0xbf; bytes > this are not 10xxxxxx
+  for (; i + 32 <= z; i += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+    n += __builtin_popcount((u32)_mm256_movemask_epi8(_mm256_cmpgt_epi8(v, trail)));
+  }
+  for (; i != z; ++i) {
+    n += !isTrail(p[i]);
+  }
+  return n;
+}
+#endif
+
+static size_t countCodepoints(const char* s, size_t z) {
+  auto p = (const u8*)s;
+  size_t n = 0, i = 0;
+  #if RX_TEXT_SIMD_AVX2
+  if (hasAVX2) {
+    return countCodepointsAVX2(p, z);
+  }
+  #endif
+  #if RX_TEXT_SIMD_SSE2
+  const __m128i trail = _mm_set1_epi8(-65);
+  for (; i + 16 <= z; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+    n += __builtin_popcount((u32)_mm_movemask_epi8(_mm_cmpgt_epi8(v, trail)));
+  }
+  #elif RX_TEXT_SIMD_NEON
+  const int8x16_t trail = vdupq_n_s8(-65);
+  for (; i + 16 <= z; i += 16) {
+    uint8x16_t m = vcgtq_s8(vreinterpretq_s8_u8(vld1q_u8(p + i)), trail);
+    n += vaddvq_u8(vshrq_n_u8(m, 7));
+  }
+  #endif
+  for (; i != z; ++i) {
+    n += !isTrail(p[i]);
+  }
+  return n;
+}
+
+
+// Returns a mask of the bytes in p[0..63] which start a code point, i.e. are not continuation
+// bytes. Bit N is for p[N].
+static inline u64 leadMask64(const u8* p) {
+  #if RX_TEXT_SIMD_SSE2
+  const __m128i trail = _mm_set1_epi8(-65);
+  u64 m = 0;
+  for (int i = 0; i != 4; ++i) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p + i * 16));
+    m |= (u64)(u16)_mm_movemask_epi8(_mm_cmpgt_epi8(v, trail)) << (i * 16);
+  }
+  return m;
+  #else
+  u64 m = 0;
+  for (int i = 0; i != 64; ++i) {
+    m |= (u64)!isTrail(p[i]) << i;
+  }
+  return m;
+  #endif
+}
+
+// Widens the leading ASCII bytes of `s` into `out`. Stops at the first non-ASCII byte or after
+// `z` bytes. Returns the number of bytes widened.
+#if RX_TEXT_SIMD_AVX2
+RX_TEXT_TARGET_AVX2
+static size_t widenASCIIAVX2(const u8* p, size_t z, u32* out) {
+  size_t i = 0;
+  for (; i + 32 <= z; i += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+    if (_mm256_movemask_epi8(v) != 0) {
+      break;
+    }
+    __m128i lo = _mm256_castsi256_si128(v);
+    __m128i hi = _mm256_extracti128_si256(v, 1);
+    _mm256_storeu_si256((__m256i*)(out + i),      _mm256_cvtepu8_epi32(lo));
+    _mm256_storeu_si256((__m256i*)(out + i + 8),  _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+    _mm256_storeu_si256((__m256i*)(out + i + 16), _mm256_cvtepu8_epi32(hi));
+    _mm256_storeu_si256((__m256i*)(out + i + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+  }
+  for (; i != z && p[i] < 0x80; ++i) {
+    out[i] = p[i];
+  }
+  return i;
+}
+#endif
+
+static size_t widenASCII(const char* s, size_t z, u32* out) {
+  auto p = (const u8*)s;
+  size_t i = 0;
+  #if RX_TEXT_SIMD_AVX2
+  if (hasAVX2) {
+    return widenASCIIAVX2(p, z, out);
+  }
+  #endif
+  #if RX_TEXT_SIMD_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= z; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+    if (_mm_movemask_epi8(v) != 0) {
+      break;
+    }
+    __m128i lo = _mm_unpacklo_epi8(v, zero);
+    __m128i hi = _mm_unpackhi_epi8(v, zero);
+    _mm_storeu_si128((__m128i*)(out + i),      _mm_unpacklo_epi16(lo, zero));
+    _mm_storeu_si128((__m128i*)(out + i + 4),  _mm_unpackhi_epi16(lo, zero));
+    _mm_storeu_si128((__m128i*)(out + i + 8),  _mm_unpacklo_epi16(hi, zero));
+    _mm_storeu_si128((__m128i*)(out + i + 12), _mm_unpackhi_epi16(hi, zero));
+  }
+  #elif RX_TEXT_SIMD_NEON
+  for (; i + 16 <= z; i += 16) {
+    uint8x16_t v = vld1q_u8(p + i);
+    if (vmaxvq_u8(v) >= 0x80) {
+      break;
+    }
+    uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+    uint16x8_t hi = vmovl_high_u8(v);
+    vst1q_u32(out + i,      vmovl_u16(vget_low_u16(lo)));
+    vst1q_u32(out + i + 4,  vmovl_high_u16(lo));
+    vst1q_u32(out + i + 8,  vmovl_u16(vget_low_u16(hi)));
+    vst1q_u32(out + i + 12, vmovl_high_u16(hi));
+  }
+  #endif
+  for (; i != z && p[i] < 0x80; ++i) {
+    out[i] = p[i];
+  }
+  return i;
+}
+
+
+// Narrows the leading ASCII code points of `p` into `out`. Stops at the first code point which is
+// not ASCII or after `z` code points. Returns the number of code points narrowed.
+#if RX_TEXT_SIMD_AVX2
+RX_TEXT_TARGET_AVX2
+static size_t narrowASCIIAVX2(const u32* p, size_t z, char* out) {
+  size_t i = 0;
+  const __m256i nonASCII = _mm256_set1_epi32(~0x7f);
+  const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+  for (; i + 32 <= z; i += 32) {
+    __m256i a = _mm256_loadu_si256((const __m256i*)(p + i));
+    __m256i b = _mm256_loadu_si256((const __m256i*)(p + i + 8));
+    __m256i c = _mm256_loadu_si256((const __m256i*)(p + i + 16));
+    __m256i d = _mm256_loadu_si256((const __m256i*)(p + i + 24));
+    __m256i any = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+    if (!_mm256_testz_si256(any, nonASCII)) {
+      break;
+    }
+    // Packing works within 128-bit lanes, so the result needs to be put back in order
+    __m256i v = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+    _mm256_storeu_si256((__m256i*)(out + i), _mm256_permutevar8x32_epi32(v, order));
+  }
+  for (; i != z && p[i] < 0x80; ++i) {
+    out[i] = (char)p[i];
+  }
+  return i;
+}
+#endif
+
+static size_t narrowASCII(const u32* p, size_t z, char* out) {
+  size_t i = 0;
+  #if RX_TEXT_SIMD_AVX2
+  if (hasAVX2) {
+    return narrowASCIIAVX2(p, z, out);
+  }
+  #endif
+  #if RX_TEXT_SIMD_SSE2
+  const __m128i nonASCII = _mm_set1_epi32(~0x7f);
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= z; i += 16) {
+    __m128i a = _mm_loadu_si128((const __m128i*)(p + i));
+    __m128i b = _mm_loadu_si128((const __m128i*)(p + i + 4));
+    __m128i c = _mm_loadu_si128((const __m128i*)(p + i + 8));
+    __m128i d = _mm_loadu_si128((const __m128i*)(p + i + 12));
+    __m128i any = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), nonASCII);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, zero)) != 0xffff) {
+      break;
+    }
+    __m128i v = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+    _mm_storeu_si128((__m128i*)(out + i), v);
+  }
+  #elif RX_TEXT_SIMD_NEON
+  for (; i + 16 <= z; i += 16) {
+    uint32x4_t a = vld1q_u32(p + i);
+    uint32x4_t b = vld1q_u32(p + i + 4);
+    uint32x4_t c = vld1q_u32(p + i + 8);
+    uint32x4_t d = vld1q_u32(p + i + 12);
+    if (vmaxvq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d))) >= 0x80) {
+      break;
+    }
+    uint16x8_t ab = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+    uint16x8_t cd = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+    vst1q_u8((u8*)(out + i), vcombine_u8(vmovn_u16(ab), vmovn_u16(cd)));
+  }
+  #endif
+  for (; i != z && p[i] < 0x80; ++i) {
+    out[i] = (char)p[i];
+  }
+  return i;
+}
+
+
+// Returns the number of bytes needed to encode `z` code points as UTF8
+static size_t encodedLength(const u32* p, size_t z) {
+  size_t n = z, i = 0;
+  #if RX_TEXT_SIMD_SSE2
+  // Unsigned compares are done as signed compares on values with their sign bit flipped. Counts
+  // are accumulated per lane and flushed before they can overflow.
+  const __m128i sign = _mm_set1_epi32((int)0x80000000u);
+  const __m128i min2 = _mm_set1_epi32((int)(0x7fu ^ 0x80000000u));
+  const __m128i min3 = _mm_set1_epi32((int)(0x7ffu ^ 0x80000000u));
+  const __m128i min4 = _mm_set1_epi32((int)(0xffffu ^ 0x80000000u));
+  while (i + 4 <= z) {
+    __m128i acc = _mm_setzero_si128();
+    size_t blockEnd = i + RX_MIN(z - i, (size_t)0x10000000) / 4 * 4;
+    for (; i != blockEnd; i += 4) {
+      __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(p + i)), sign);
+      acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(v, min2));
+      acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(v, min3));
+      acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(v, min4));
+    }
+    u32 lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    n += (size_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  }
+  #elif RX_TEXT_SIMD_NEON
+  while (i + 4 <= z) {
+    uint32x4_t acc = vdupq_n_u32(0);
+    size_t blockEnd = i + RX_MIN(z - i, (size_t)0x10000000) / 4 * 4;
+    for (; i != blockEnd; i += 4) {
+      uint32x4_t v = vld1q_u32(p + i);
+      acc = vsubq_u32(acc, vcgtq_u32(v, vdupq_n_u32(0x7f)));
+      acc = vsubq_u32(acc, vcgtq_u32(v, vdupq_n_u32(0x7ff)));
+      acc = vsubq_u32(acc, vcgtq_u32(v, vdupq_n_u32(0xffff)));
+    }
+    n += vaddlvq_u32(acc);
+  }
+  #endif
+  for (; i != z; ++i) {
+    n += (p[i] > 0x7f) + (p[i] > 0x7ff) + (p[i] > 0xffff);
+  }
+  return n;
+}
+
+
+// Membership of a byte in an ASCII set expressed as a nibble table (see CharacterSet::_nibbles.)
+// Bytes >= 0x80 are never members.
+static inline bool inASCIISet(u8 b, const u8* nibbles) {
+  return b < 0x80 && ((nibbles[b & 0xf] >> (b >> 4)) & 1);
+}
+
+// The vectorized versions look up each byte's low nibble in `nibbles` and its high nibble in a
+// table of single bits (zero for 8..15) and test the two for overlap.
+#if RX_TEXT_SIMD_AVX2
+RX_TEXT_TARGET_AVX2
+static inline u32 asciiSetMaskAVX2(__m256i v, __m256i lo, __m256i hi) {
+  const __m256i nib = _mm256_set1_epi8(0x0f);
+  __m256i l = _mm256_shuffle_epi8(lo, _mm256_and_si256(v, nib));
+  __m256i h = _mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi16(v, 4), nib));
+  __m256i none = _mm256_cmpeq_epi8(_mm256_and_si256(l, h), _mm256_setzero_si256());
+  return ~(u32)_mm256_movemask_epi8(none);
+}
+
+RX_TEXT_TARGET_AVX2
+static size_t spanASCIISetAVX2(const u8* p, size_t z, const u8* nibbles) {
+  const __m256i lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)nibbles));
+  const __m256i hi = _mm256_setr_epi8(1,2,4,8,16,32,64,-128,0,0,0,0,0,0,0,0,
+                                      1,2,4,8,16,32,64,-128,0,0,0,0,0,0,0,0);
+  size_t i = 0;
+  for (; i + 32 <= z; i += 32) {
+    u32 m = ~asciiSetMaskAVX2(_mm256_loadu_si256((const __m256i*)(p + i)), lo, hi);
+    if (m != 0) {
+      return i + __builtin_ctz(m);
+    }
+  }
+  for (; i != z && inASCIISet(p[i], nibbles); ++i) {}
+  return i;
+}
+
+RX_TEXT_TARGET_AVX2
+static size_t rspanASCIISetAVX2(const u8* p, size_t z, const u8* nibbles) {
+  const __m256i lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)nibbles));
+  const __m256i hi = _mm256_setr_epi8(1,2,4,8,16,32,64,-128,0,0,0,0,0,0,0,0,
+                                      1,2,4,8,16,32,64,-128,0,0,0,0,0,0,0,0);
+  size_t i = z;
+  for (; i >= 32; i -= 32) {
+    u32 m = ~asciiSetMaskAVX2(_mm256_loadu_si256((const __m256i*)(p + i - 32)), lo, hi);
+    if (m != 0) {
+      return z - i + __builtin_clz(m);
+    }
+  }
+  for (; i != 0 && inASCIISet(p[i - 1], nibbles); --i) {}
+  return z - i;
+}
+#endif
+
+#if RX_TEXT_SIMD_SSSE3
+RX_TEXT_TARGET_SSSE3
+static inline u32 asciiSetMaskSSSE3(__m128i v, __m128i lo, __m128i hi) {
+  const __m128i nib = _mm_set1_epi8(0x0f);
+  __m128i l = _mm_shuffle_epi8(lo, _mm_and_si128(v, nib));
+  __m128i h = _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi16(v, 4), nib));
+  __m128i none = _mm_cmpeq_epi8(_mm_and_si128(l, h), _mm_setzero_si128());
+  return ~(u32)_mm_movemask_epi8(none) & 0xffff;
+}
+
+RX_TEXT_TARGET_SSSE3
+static size_t spanASCIISetSSSE3(const u8* p, size_t z, const u8* nibbles) {
+  const __m128i lo = _mm_loadu_si128((const __m128i*)nibbles);
+  const __m128i hi = _mm_setr_epi8(1,2,4,8,16,32,64,-128,0,0,0,0,0,0,0,0);
+  size_t i = 0;
+  for (; i + 16 <= z; i += 16) {
+    u32 m = ~asciiSetMaskSSSE3(_mm_loadu_si128((const __m128i*)(p + i)), lo, hi) & 0xffff;
+    if (m != 0) {
+      return i + __builtin_ctz(m);
+    }
+  }
+  for (; i != z && inASCIISet(p[i], nibbles); ++i) {}
+  return i;
+}
+
+RX_TEXT_TARGET_SSSE3
+static size_t rspanASCIISetSSSE3(const u8* p, size_t z, const u8* nibbles) {
+  const __m128i lo = _mm_loadu_si128((const __m128i*)nibbles);
+  const __m128i hi = _mm_setr_epi8(1,2,4,8,16,32,64,-128,0,0,0,0,0,0,0,0);
+  size_t i = z;
+  for (; i >= 16; i -= 16) {
+    u32 m = ~asciiSetMaskSSSE3(_mm_loadu_si128((const __m128i*)(p + i - 16)), lo, hi) & 0xffff;
+    if (m != 0) {
+      return z - i + (__builtin_clz(m) - 16);
+    }
+  }
+  for (; i != 0 && inASCIISet(p[i - 1], nibbles); --i) {}
+  return z - i;
+}
+#endif
+
+#if RX_TEXT_SIMD_NEON
+static inline uint8x16_t asciiSetMaskNEON(uint8x16_t v, uint8x16_t lo, uint8x16_t hi) {
+  uint8x16_t l = vqtbl1q_u8(lo, vandq_u8(v, vdupq_n_u8(0x0f)));
+  uint8x16_t h = vqtbl1q_u8(hi, vshrq_n_u8(v, 4));
+  return vtstq_u8(l, h); // 0xff for members
+}
+
+static const u8 nibbleBitsNEON[16] = {1,2,4,8,16,32,64,128,0,0,0,0,0,0,0,0};
+#endif
+
+// Returns the number of leading bytes of `s` which are members of an ASCII set
+static size_t spanASCIISet(const char* s, size_t z, const u8* nibbles) {
+  auto p = (const u8*)s;
+  size_t i = 0;
+  if (z == 0 || !inASCIISet(p[0], nibbles)) {
+    return 0; // common case
+  }
+  #if RX_TEXT_SIMD_AVX2
+  if (hasAVX2) {
+    return spanASCIISetAVX2(p, z, nibbles);
+  } else if (hasSSSE3) {
+    return spanASCIISetSSSE3(p, z, nibbles);
+  }
+  #elif RX_TEXT_SIMD_NEON
+  const uint8x16_t lo = vld1q_u8(nibbles);
+  const uint8x16_t hi = vld1q_u8(nibbleBitsNEON);
+  for (; i + 16 <= z; i += 16) {
+    uint8x16_t m = asciiSetMaskNEON(vld1q_u8(p + i), lo, hi);
+    if (vminvq_u8(m) == 0) {
+      break;
+    }
+  }
+  #endif
+  for (; i != z && inASCIISet(p[i], nibbles); ++i) {}
+  return i;
+}
+
+// Returns the number of trailing bytes of `s` which are members of an ASCII set
+static size_t rspanASCIISet(const char* s, size_t z, const u8* nibbles) {
+  auto p = (const u8*)s;
+  size_t i = z;
+  if (z == 0 || !inASCIISet(p[z - 1], nibbles)) {
+    return 0; // common case
+  }
+  #if RX_TEXT_SIMD_AVX2
+  if (hasAVX2) {
+    return rspanASCIISetAVX2(p, z, nibbles);
+  } else if (hasSSSE3) {
+    return rspanASCIISetSSSE3(p, z, nibbles);
+  }
+  #elif RX_TEXT_SIMD_NEON
+  const uint8x16_t lo = vld1q_u8(nibbles);
+  const uint8x16_t hi = vld1q_u8(nibbleBitsNEON);
+  for (; i >= 16; i -= 16) {
+    uint8x16_t m = asciiSetMaskNEON(vld1q_u8(p + i - 16), lo, hi);
+    if (vminvq_u8(m) == 0) {
+      break;
+    }
+  }
+  #endif
+  for (; i != 0 && inASCIISet(p[i - 1], nibbles); --i) {}
+  return z - i;
+}
+
+// Returns the offset of the first byte of `s` which is a member of an ASCII set, or, when
+// `stopAtNonASCII` is true, is >= 0x80. Returns `z` if there's no such byte.
+#if RX_TEXT_SIMD_AVX2
+RX_TEXT_TARGET_AVX2
+static size_t findASCIISetAVX2(const u8* p, size_t z, const u8* nibbles, bool stopAtNonASCII) {
+  const __m256i lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)nibbles));
+  const __m256i hi = _mm256_setr_epi8(1,2,4,8,16,32,64,-128,0,0,0,0,0,0,0,0,
+                                      1,2,4,8,16,32,64,-128,0,0,0,0,0,0,0,0);
+  const u32 nonASCII = stopAtNonASCII ? 0xffffffffu : 0;
+  size_t i = 0;
+  for (; i + 32 <= z; i += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+    u32 m = asciiSetMaskAVX2(v, lo, hi) | ((u32)_mm256_movemask_epi8(v) & nonASCII);
+    if (m != 0) {
+      return i + __builtin_ctz(m);
+    }
+  }
+  for (; i != z && !inASCIISet(p[i], nibbles) && !(stopAtNonASCII && p[i] > 0x7f); ++i) {}
+  return i;
+}
+#endif
+
+#if RX_TEXT_SIMD_SSSE3
+RX_TEXT_TARGET_SSSE3
+static size_t findASCIISetSSSE3(const u8* p, size_t z, const u8* nibbles, bool stopAtNonASCII) {
+  const __m128i lo = _mm_loadu_si128((const __m128i*)nibbles);
+  const __m128i hi = _mm_setr_epi8(1,2,4,8,16,32,64,-128,0,0,0,0,0,0,0,0);
+  const u32 nonASCII = stopAtNonASCII ? 0xffffu : 0;
+  size_t i = 0;
+  for (; i + 16 <= z; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+    u32 m = asciiSetMaskSSSE3(v, lo, hi) | ((u32)_mm_movemask_epi8(v) & nonASCII);
+    if (m != 0) {
+      return i + __builtin_ctz(m);
+    }
+  }
+  for (; i != z && !inASCIISet(p[i], nibbles) && !(stopAtNonASCII && p[i] > 0x7f); ++i) {}
+  return i;
+}
+#endif
+
+static size_t findASCIISet(const char* s, size_t z, const u8* nibbles, bool stopAtNonASCII) {
+  auto p = (const u8*)s;
+  size_t i = 0;
+  #if RX_TEXT_SIMD_AVX2
+  if (hasAVX2) {
+    return findASCIISetAVX2(p, z, nibbles, stopAtNonASCII);
+  } else if (hasSSSE3) {
+    return findASCIISetSSSE3(p, z, nibbles, stopAtNonASCII);
+  }
+  #elif RX_TEXT_SIMD_NEON
+  const uint8x16_t lo = vld1q_u8(nibbles);
+  const uint8x16_t hi = vld1q_u8(nibbleBitsNEON);
+  const uint8x16_t nonASCII = vdupq_n_u8(stopAtNonASCII ? 0x80 : 0);
+  for (; i + 16 <= z; i += 16) {
+    uint8x16_t v = vld1q_u8(p + i);
+    uint8x16_t m = vorrq_u8(asciiSetMaskNEON(v, lo, hi), vandq_u8(v, nonASCII));
+    if (vmaxvq_u8(m) != 0) {
+      break;
+    }
+  }
+  #endif
+  for (; i != z && !inASCIISet(p[i], nibbles) && !(stopAtNonASCII && p[i] > 0x7f); ++i) {}
+  return i;
+}
+
+// Returns the offset of the first byte of `s` which is equal to one of bytes[0..3], or `z` if
+// there's no such byte. Unused slots of `bytes` should repeat one of the others.
+#if RX_TEXT_SIMD_AVX2
+RX_TEXT_TARGET_AVX2
+static size_t findAnyOf4AVX2(const u8* p, size_t z, const u8* bytes) {
+  const __m256i b0 = _mm256_set1_epi8((char)bytes[0]);
+  const __m256i b1 = _mm256_set1_epi8((char)bytes[1]);
+  const __m256i b2 = _mm256_set1_epi8((char)bytes[2]);
+  const __m256i b3 = _mm256_set1_epi8((char)bytes[3]);
+  size_t i = 0;
+  for (; i + 32 <= z; i += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+    __m256i m = _mm256_or_si256(
+      _mm256_or_si256(_mm256_cmpeq_epi8(v, b0), _mm256_cmpeq_epi8(v, b1)),
+      _mm256_or_si256(_mm256_cmpeq_epi8(v, b2), _mm256_cmpeq_epi8(v, b3)));
+    u32 bits = (u32)_mm256_movemask_epi8(m);
+    if (bits != 0) {
+      return i + __builtin_ctz(bits);
+    }
+  }
+  for (; i != z && p[i] != bytes[0] && p[i] != bytes[1] && p[i] != bytes[2] && p[i] != bytes[3];
+       ++i) {}
+  return i;
+}
+#endif
+
+static size_t findAnyOf4(const char* s, size_t z, const u8* bytes) {
+  auto p = (const u8*)s;
+  size_t i = 0;
+  #if RX_TEXT_SIMD_AVX2
+  if (hasAVX2) {
+    return findAnyOf4AVX2(p, z, bytes);
+  }
+  #endif
+  #if RX_TEXT_SIMD_SSE2
+  const __m128i b0 = _mm_set1_epi8((char)bytes[0]);
+  const __m128i b1 = _mm_set1_epi8((char)bytes[1]);
+  const __m128i b2 = _mm_set1_epi8((char)bytes[2]);
+  const __m128i b3 = _mm_set1_epi8((char)bytes[3]);
+  for (; i + 16 <= z; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+    __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, b0), _mm_cmpeq_epi8(v, b1)),
+                             _mm_or_si128(_mm_cmpeq_epi8(v, b2), _mm_cmpeq_epi8(v, b3)));
+    u32 bits = (u32)_mm_movemask_epi8(m);
+    if (bits != 0) {
+      return i + __builtin_ctz(bits);
+    }
+  }
+  #elif RX_TEXT_SIMD_NEON
+  for (; i + 16 <= z; i += 16) {
+    uint8x16_t v = vld1q_u8(p + i);
+    uint8x16_t m = vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8(bytes[0])), vceqq_u8(v, vdupq_n_u8(bytes[1]))),
+                            vorrq_u8(vceqq_u8(v, vdupq_n_u8(bytes[2])), vceqq_u8(v, vdupq_n_u8(bytes[3]))));
+    if (vmaxvq_u8(m) != 0) {
+      break;
+    }
+  }
+  #endif
+  for (; i != z && p[i] != bytes[0] && p[i] != bytes[1] && p[i] != bytes[2] && p[i] != bytes[3];
+       ++i) {}
+  return i;
+}
+
+
+// Returns the number of leading bytes of `s` which are less than `limit`, which must be > 0
+#if RX_TEXT_SIMD_AVX2
+RX_TEXT_TARGET_AVX2
+static size_t spanBelowAVX2(const u8* p, size_t z, u8 limit) {
+  const __m256i max = _mm256_set1_epi8((char)(limit - 1));
+  size_t i = 0;
+  for (; i + 32 <= z; i += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+    u32 bits = (u32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(v, max), v));
+    if (bits != 0xffffffffu) {
+      return i + __builtin_ctz(~bits);
+    }
+  }
+  for (; i != z && p[i] < limit; ++i) {}
+  return i;
+}
+#endif
+
+static size_t spanBelow(const char* s, size_t z, u8 limit) {
+  auto p = (const u8*)s;
+  size_t i = 0;
+  #if RX_TEXT_SIMD_AVX2
+  if (hasAVX2) {
+    return spanBelowAVX2(p, z, limit);
+  }
+  #endif
+  #if RX_TEXT_SIMD_SSE2
+  const __m128i max = _mm_set1_epi8((char)(limit - 1));
+  for (; i + 16 <= z; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+    u32 bits = (u32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(v, max), v));
+    if (bits != 0xffff) {
+      return i + __builtin_ctz(~bits);
+    }
+  }
+  #elif RX_TEXT_SIMD_NEON
+  const uint8x16_t lim = vdupq_n_u8(limit);
+  for (; i + 16 <= z; i += 16) {
+    if (vmaxvq_u8(vcgeq_u8(vld1q_u8(p + i), lim)) != 0) {
+      break;
+    }
+  }
+  #endif
+  for (; i != z && p[i] < limit; ++i) {}
+  return i;
+}
+
+// Returns the number of leading bytes of `s` which are printable ASCII, i.e. 0x20..0x7E
+#if RX_TEXT_SIMD_AVX2
+RX_TEXT_TARGET_AVX2
+static size_t spanPrintableASCIIAVX2(const u8* p, size_t z) {
+  const __m256i lo = _mm256_set1_epi8(0x1f);
+  const __m256i hi = _mm256_set1_epi8(0x7f);
+  size_t i = 0;
+  for (; i + 32 <= z; i += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+    // Bytes >= 0x80 are negative, so fail the first comparison
+    __m256i m = _mm256_and_si256(_mm256_cmpgt_epi8(v, lo), _mm256_cmpgt_epi8(hi, v));
+    u32 bits = (u32)_mm256_movemask_epi8(m);
+    if (bits != 0xffffffffu) {
+      return i + __builtin_ctz(~bits);
+    }
+  }
+  for (; i != z && p[i] - 0x20u < 0x5f; ++i) {}
+  return i;
+}
+#endif
+
+static size_t spanPrintableASCII(const char* s, size_t z) {
+  auto p = (const u8*)s;
+  size_t i = 0;
+  #if RX_TEXT_SIMD_AVX2
+  if (hasAVX2) {
+    return spanPrintableASCIIAVX2(p, z);
+  }
+  #endif
+  #if RX_TEXT_SIMD_SSE2
+  const __m128i lo = _mm_set1_epi8(0x1f);
+  const __m128i hi = _mm_set1_epi8(0x7f);
+  for (; i + 16 <= z; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+    u32 bits = (u32)_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(v, lo), _mm_cmpgt_epi8(hi, v)));
+    if (bits != 0xffff) {
+      return i + __builtin_ctz(~bits);
+    }
+  }
+  #elif RX_TEXT_SIMD_NEON
+  const uint8x16_t offset = vdupq_n_u8(0x20);
+  const uint8x16_t count = vdupq_n_u8(0x5f);
+  for (; i + 16 <= z; i += 16) {
+    if (vmaxvq_u8(vcgeq_u8(vsubq_u8(vld1q_u8(p + i), offset), count)) != 0) {
+      break;
+    }
+  }
+  #endif
+  for (; i != z && p[i] - 0x20u < 0x5f; ++i) {}
+  return i;
+}
+
+// Returns the offset of the first byte of `s` which may need escaping in JSON, or `z` if there's no
+// such byte: controls, quote, backslash, DEL and C2, which starts both U+0080..U+009F (controls)
+// and U+00A0..U+00BF (not escaped.)
+#if RX_TEXT_SIMD_AVX2
+RX_TEXT_TARGET_AVX2
+static size_t findJSONEscapeAVX2(const u8* p, size_t z) {
+  const __m256i control = _mm256_set1_epi8(0x1f);
+  const __m256i quote = _mm256_set1_epi8('"');
+  const __m256i backslash = _mm256_set1_epi8('\\');
+  const __m256i del = _mm256_set1_epi8(0x7f);
+  const __m256i c2 = _mm256_set1_epi8((char)0xc2);
+  size_t i = 0;
+  for (; i + 32 <= z; i += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+    __m256i m = _mm256_or_si256(
+      _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(v, control), v), _mm256_cmpeq_epi8(v, quote)),
+      _mm256_or_si256(_mm256_cmpeq_epi8(v, backslash),
+                      _mm256_or_si256(_mm256_cmpeq_epi8(v, del), _mm256_cmpeq_epi8(v, c2))));
+    u32 bits = (u32)_mm256_movemask_epi8(m);
+    if (bits != 0) {
+      return i + __builtin_ctz(bits);
+    }
+  }
+  for (; i != z && p[i] >= 0x20 && p[i] != '"' && p[i] != '\\' && p[i] != 0x7f && p[i] != 0xc2;
+       ++i) {}
+  return i;
+}
+#endif
+
+static size_t findJSONEscape(const char* s, size_t z) {
+  auto p = (const u8*)s;
+  size_t i = 0;
+  #if RX_TEXT_SIMD_AVX2
+  if (hasAVX2) {
+    return findJSONEscapeAVX2(p, z);
+  }
+  #endif
+  #if RX_TEXT_SIMD_SSE2
+  const __m128i control = _mm_set1_epi8(0x1f);
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i del = _mm_set1_epi8(0x7f);
+  const __m128i c2 = _mm_set1_epi8((char)0xc2);
+  for (; i + 16 <= z; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+    __m128i m = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(v, control), v), _mm_cmpeq_epi8(v, quote)),
+      _mm_or_si128(_mm_cmpeq_epi8(v, backslash),
+                   _mm_or_si128(_mm_cmpeq_epi8(v, del), _mm_cmpeq_epi8(v, c2))));
+    u32 bits = (u32)_mm_movemask_epi8(m);
+    if (bits != 0) {
+      return i + __builtin_ctz(bits);
+    }
+  }
+  #elif RX_TEXT_SIMD_NEON
+  for (; i + 16 <= z; i += 16) {
+    uint8x16_t v = vld1q_u8(p + i);
+    uint8x16_t m = vorrq_u8(
+      vorrq_u8(vcltq_u8(v, vdupq_n_u8(0x20)), vceqq_u8(v, vdupq_n_u8('"'))),
+      vorrq_u8(vceqq_u8(v, vdupq_n_u8('\\')),
+               vorrq_u8(vceqq_u8(v, vdupq_n_u8(0x7f)), vceqq_u8(v, vdupq_n_u8(0xc2)))));
+    if (vmaxvq_u8(m) != 0) {
+      break;
+    }
+  }
+  #endif
+  for (; i != z && p[i] >= 0x20 && p[i] != '"' && p[i] != '\\' && p[i] != 0x7f && p[i] != 0xc2;
+       ++i) {}
+  return i;
+}
+
+// Copies the leading bytes of `s` which are graphic ASCII, i.e. 0x21..0x7E, to `out` and returns
+// how many there were. A..Z are lowercased when `fold` is set. Bytes past the span may be written
+// to `out` too, but never more than `z` in all.
+#if RX_TEXT_SIMD_AVX2
+RX_TEXT_TARGET_AVX2
+static size_t copyGraphicASCIIAVX2(const u8* p, size_t z, u8* out, bool fold) {
+  const __m256i lo = _mm256_set1_epi8(0x20);
+  const __m256i hi = _mm256_set1_epi8(0x7f);
+  const __m256i upperLo = _mm256_set1_epi8('A' - 1);
+  const __m256i upperHi = _mm256_set1_epi8('Z' + 1);
+  const __m256i flip = _mm256_set1_epi8(fold ? 0x20 : 0);
+  size_t i = 0;
+  for (; i + 32 <= z; i += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+    // Bytes >= 0x80 are negative, so fail the lower bound comparisons
+    __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(v, upperLo), _mm256_cmpgt_epi8(upperHi, v));
+    _mm256_storeu_si256((__m256i*)(out + i), _mm256_add_epi8(v, _mm256_and_si256(upper, flip)));
+    __m256i m = _mm256_and_si256(_mm256_cmpgt_epi8(v, lo), _mm256_cmpgt_epi8(hi, v));
+    u32 bits = (u32)_mm256_movemask_epi8(m);
+    if (bits != 0xffffffffu) {
+      return i + __builtin_ctz(~bits);
+    }
+  }
+  for (; i != z && p[i] - 0x21u < 0x5e; ++i) {
+    out[i] = p[i] + ((fold && p[i] - 0x41u < 26) ? 0x20 : 0);
+  }
+  return i;
+}
+#endif
+
+static size_t copyGraphicASCII(const char* s, size_t z, char* outs, bool fold) {
+  auto p = (const u8*)s;
+  auto out = (u8*)outs;
+  size_t i = 0;
+  #if RX_TEXT_SIMD_AVX2
+  if (hasAVX2) {
+    return copyGraphicASCIIAVX2(p, z, out, fold);
+  }
+  #endif
+  #if RX_TEXT_SIMD_SSE2
+  const __m128i lo = _mm_set1_epi8(0x20);
+  const __m128i hi = _mm_set1_epi8(0x7f);
+  const __m128i upperLo = _mm_set1_epi8('A' - 1);
+  const __m128i upperHi = _mm_set1_epi8('Z' + 1);
+  const __m128i flip = _mm_set1_epi8(fold ? 0x20 : 0);
+  for (; i + 16 <= z; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+    __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, upperLo), _mm_cmpgt_epi8(upperHi, v));
+    _mm_storeu_si128((__m128i*)(out + i), _mm_add_epi8(v, _mm_and_si128(upper, flip)));
+    u32 bits = (u32)_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(v, lo), _mm_cmpgt_epi8(hi, v)));
+    if (bits != 0xffff) {
+      return i + __builtin_ctz(~bits);
+    }
+  }
+  #elif RX_TEXT_SIMD_NEON
+  const uint8x16_t offset = vdupq_n_u8(0x21);
+  const uint8x16_t count = vdupq_n_u8(0x5e);
+  const uint8x16_t upperOffset = vdupq_n_u8('A');
+  const uint8x16_t upperCount = vdupq_n_u8(26);
+  const uint8x16_t flip = vdupq_n_u8(fold ? 0x20 : 0);
+  for (; i + 16 <= z; i += 16) {
+    uint8x16_t v = vld1q_u8(p + i);
+    if (vmaxvq_u8(vcgeq_u8(vsubq_u8(v, offset), count)) != 0) {
+      break;
+    }
+    uint8x16_t upper = vcltq_u8(vsubq_u8(v, upperOffset), upperCount);
+    vst1q_u8(out + i, vaddq_u8(v, vandq_u8(upper, flip)));
+  }
+  #endif
+  for (; i != z && p[i] - 0x21u < 0x5e; ++i) {
+    out[i] = p[i] + ((fold && p[i] - 0x41u < 26) ? 0x20 : 0);
+  }
+  return i;
+}
+
+// Line breaks: LF, VT, FF, CR, CR LF, U+2028 (E2 80 A8) and U+2029 (E2 80 A9). Blocks of bytes
+// are searched for the bytes 0A..0D and E2, and each such byte is then checked individually.
+// Returns the offset just past the line break at p[i], or 0 if there's none.
+static inline size_t linebreakEnd(const u8* p, size_t z, size_t i) {
+  u8 b = p[i];
+  if (b == 0x0d) {
+    return (i + 1 != z && p[i + 1] == 0x0a) ? i + 2 : i + 1;
+  } else if (b >= 0x0a && b <= 0x0c) {
+    return i + 1;
+  } else if (b == 0xe2 && i + 2 < z && p[i + 1] == 0x80 && (p[i + 2] | 1) == 0xa9) {
+    return i + 3;
+  }
+  return 0;
+}
+
+// Scans p[i..z) and writes the offset just past each line break to `out`, up to `n` offsets.
+// Returns the number of offsets written and sets `i` to where scanning should continue.
+#if RX_TEXT_SIMD_AVX2
+RX_TEXT_TARGET_AVX2
+static size_t scanLinebreaksAVX2(const u8* p, size_t z, size_t& i, size_t* out, size_t n) {
+  const __m256i shift = _mm256_set1_epi8(0x76); // moves 0A..0D to -128..-125
+  const __m256i limit = _mm256_set1_epi8(-124);
+  const __m256i e2 = _mm256_set1_epi8((char)0xe2);
+  size_t count = 0;
+  while (i + 32 <= z && count != n) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+    __m256i m = _mm256_or_si256(_mm256_cmpgt_epi8(limit, _mm256_add_epi8(v, shift)),
+                                _mm256_cmpeq_epi8(v, e2));
+    u32 bits = (u32)_mm256_movemask_epi8(m);
+    if (bits == 0) {
+      i += 32;
+      continue;
+    }
+    size_t k = i + __builtin_ctz(bits);
+    size_t e = linebreakEnd(p, z, k);
+    if (e != 0) {
+      out[count++] = e;
+      i = e;
+    } else {
+      i = k + 1;
+    }
+  }
+  return count;
+}
+#endif
+
+static size_t scanLinebreaks(const u8* p, size_t z, size_t& i, size_t* out, size_t n) {
+  size_t count = 0;
+  #if RX_TEXT_SIMD_AVX2
+  if (hasAVX2) {
+    count = scanLinebreaksAVX2(p, z, i, out, n);
+  }
+  #endif
+  #if RX_TEXT_SIMD_SSE2
+  const __m128i shift = _mm_set1_epi8(0x76);
+  const __m128i limit = _mm_set1_epi8(-124);
+  const __m128i e2 = _mm_set1_epi8((char)0xe2);
+  while (i + 16 <= z && count != n) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+    __m128i m = _mm_or_si128(_mm_cmpgt_epi8(limit, _mm_add_epi8(v, shift)), _mm_cmpeq_epi8(v, e2));
+    u32 bits = (u32)_mm_movemask_epi8(m);
+    if (bits == 0) {
+      i += 16;
+      continue;
+    }
+    size_t k = i + __builtin_ctz(bits);
+    size_t e = linebreakEnd(p, z, k);
+    if (e != 0) {
+      out[count++] = e;
+      i = e;
+    } else {
+      i = k + 1;
+    }
+  }
+  #elif RX_TEXT_SIMD_NEON
+  const int8x16_t shift = vdupq_n_s8(0x76);
+  const int8x16_t limit = vdupq_n_s8(-124);
+  while (i + 16 <= z && count != n) {
+    uint8x16_t v = vld1q_u8(p + i);
+    uint8x16_t m = vorrq_u8(vcltq_s8(vaddq_s8(vreinterpretq_s8_u8(v), shift), limit),
+                            vceqq_u8(v, vdupq_n_u8(0xe2)));
+    if (vmaxvq_u8(m) == 0) {
+      i += 16;
+      continue;
+    }
+    size_t end = i + 16;
+    for (; i != end && count != n; ++i) {
+      size_t e = linebreakEnd(p, z, i);
+      if (e != 0) {
+        out[count++] = e;
+        i = e - 1;
+        end = RX_MAX(end, e);
+      }
+    }
+  }
+  #endif
+  while (i != z && count != n) {
+    size_t e = linebreakEnd(p, z, i);
+    if (e != 0) {
+      out[count++] = e;
+      i = e;
+    } else {
+      ++i;
+    }
+  }
+  return count;
+}
+
+
+// UTF8 validation using lookup tables, after Keiser & Lemire, "Validating UTF-8 in less than one
+// instruction per byte" (2020.) The high and low nibbles of each byte and the high nibble of the
+// byte after it are looked up in three tables whose bits each flag one kind of error. An error
+// exists where all three lookups have a bit in common. Continuation bytes expected after 3- and
+// 4-byte leads are checked separately by looking two and three bytes back.
+enum : u8 {
+  UTF8TooShort     = 1 << 0, // 11______ 0_______  or  11______ 11______
+  UTF8TooLong      = 1 << 1, // 0_______ 10______
+  UTF8Overlong3    = 1 << 2, // 11100000 100_____
+  UTF8TooLarge     = 1 << 3, // 11110100 1001____ and similar, > U+10FFFF
+  UTF8Surrogate    = 1 << 4, // 11101101 101_____
+  UTF8Overlong2    = 1 << 5, // 1100000_ 10______
+  UTF8TooLarge1000 = 1 << 6, // 11110101 1000____ and similar, > U+10FFFF
+  UTF8Overlong4    = 1 << 6, // 11110000 1000____
+  UTF8TwoConts     = 1 << 7, // 10______ 10______
+  UTF8Carry        = UTF8TooShort | UTF8TooLong | UTF8TwoConts,
+};
+
+RX_UNUSED static const u8 utf8Byte1High[16] = {
+  // 0_______ ASCII
+  UTF8TooLong, UTF8TooLong, UTF8TooLong, UTF8TooLong,
+  UTF8TooLong, UTF8TooLong, UTF8TooLong, UTF8TooLong,
+  // 10______ continuation
+  UTF8TwoConts, UTF8TwoConts, UTF8TwoConts, UTF8TwoConts,
+  // 1100____ 2-byte lead
+  UTF8TooShort | UTF8Overlong2,
+  // 1101____ 2-byte lead
+  UTF8TooShort,
+  // 1110____ 3-byte lead
+  UTF8TooShort | UTF8Overlong3 | UTF8Surrogate,
+  // 1111____ 4-byte lead
+  UTF8TooShort | UTF8TooLarge | UTF8TooLarge1000 | UTF8Overlong4,
+};
+
+RX_UNUSED static const u8 utf8Byte1Low[16] = {
+  UTF8Carry | UTF8Overlong3 | UTF8Overlong2 | UTF8Overlong4, // ____0000
+  UTF8Carry | UTF8Overlong2,                                 // ____0001
+  UTF8Carry,                                                 // ____001_
+  UTF8Carry,
+  UTF8Carry | UTF8TooLarge,                                  // ____0100
+  UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,               // ____0101
+  UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,               // ____011_
+  UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+  UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,               // ____1___
+  UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+  UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+  UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+  UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+  UTF8Carry | UTF8TooLarge | UTF8TooLarge1000 | UTF8Surrogate, // ____1101
+  UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+  UTF8Carry | UTF8TooLarge | UTF8TooLarge1000,
+};
+
+RX_UNUSED static const u8 utf8Byte2High[16] = {
+  // ________ 0_______ ASCII
+  UTF8TooShort, UTF8TooShort, UTF8TooShort, UTF8TooShort,
+  UTF8TooShort, UTF8TooShort, UTF8TooShort, UTF8TooShort,
+  // ________ 1000____
+  UTF8TooLong | UTF8Overlong2 | UTF8TwoConts | UTF8Overlong3 | UTF8TooLarge1000 | UTF8Overlong4,
+  // ________ 1001____
+  UTF8TooLong | UTF8Overlong2 | UTF8TwoConts | UTF8Overlong3 | UTF8TooLarge,
+  // ________ 101_____
+  UTF8TooLong | UTF8Overlong2 | UTF8TwoConts | UTF8Surrogate | UTF8TooLarge,
+  UTF8TooLong | UTF8Overlong2 | UTF8TwoConts | UTF8Surrogate | UTF8TooLarge,
+  // ________ 11______
+  UTF8TooShort, UTF8TooShort, UTF8TooShort, UTF8TooShort,
+};
+
+// Each of the following returns the offset of the first block in which an error was detected, or
+// `z` if the input is valid. The input is processed in blocks with the last, partial block padded
+// with zeros, which makes sequences truncated by the end of input show up as errors.
+
+#if RX_TEXT_SIMD_AVX2
+RX_TEXT_TARGET_AVX2
+static inline __m256i prevBytesAVX2(__m256i input, __m256i prevInput, int n) {
+  __m256i crossed = _mm256_permute2x128_si256(prevInput, input, 0x21);
+  switch (n) {
+    case 1: return _mm256_alignr_epi8(input, crossed, 15);
+    case 2: return _mm256_alignr_epi8(input, crossed, 14);
+    default: return _mm256_alignr_epi8(input, crossed, 13);
+  }
+}
+
+RX_TEXT_TARGET_AVX2
+static size_t checkUTF8AVX2(const u8* p, size_t z) {
+  const __m256i nib = _mm256_set1_epi8(0x0f);
+  const __m256i t1h = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)utf8Byte1High));
+  const __m256i t1l = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)utf8Byte1Low));
+  const __m256i t2h = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)utf8Byte2High));
+  const __m256i maxValue = _mm256_setr_epi8(
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,(char)(0xf0-1),(char)(0xe0-1),(char)(0xc0-1));
+  __m256i prevInput = _mm256_setzero_si256();
+  __m256i prevIncomplete = _mm256_setzero_si256();
+  u8 tail[32];
+  for (size_t i = 0; i <= z; i += 32) {
+    __m256i input;
+    if (i + 32 <= z) {
+      input = _mm256_loadu_si256((const __m256i*)(p + i));
+    } else {
+      memset(tail, 0, sizeof(tail));
+      if (z != i) {
+        memcpy(tail, p + i, z - i);
+      }
+      input = _mm256_loadu_si256((const __m256i*)tail);
+    }
+    __m256i err;
+    if (_mm256_movemask_epi8(input) == 0) {
+      err = prevIncomplete; // ASCII block
+      prevIncomplete = _mm256_setzero_si256();
+    } else {
+      __m256i prev1 = prevBytesAVX2(input, prevInput, 1);
+      __m256i b1h = _mm256_shuffle_epi8(t1h, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nib));
+      __m256i b1l = _mm256_shuffle_epi8(t1l, _mm256_and_si256(prev1, nib));
+      __m256i b2h = _mm256_shuffle_epi8(t2h, _mm256_and_si256(_mm256_srli_epi16(input, 4), nib));
+      __m256i special = _mm256_and_si256(_mm256_and_si256(b1h, b1l), b2h);
+      __m256i is3 = _mm256_subs_epu8(prevBytesAVX2(input, prevInput, 2), _mm256_set1_epi8(0xe0-0x80));
+      __m256i is4 = _mm256_subs_epu8(prevBytesAVX2(input, prevInput, 3), _mm256_set1_epi8(0xf0-0x80));
+      __m256i must23 = _mm256_and_si256(_mm256_or_si256(is3, is4), _mm256_set1_epi8((char)0x80));
+      err = _mm256_xor_si256(must23, special);
+      prevIncomplete = _mm256_subs_epu8(input, maxValue);
+    }
+    if (!_mm256_testz_si256(err, err)) {
+      return RX_MIN(i, z - 1);
+    }
+    prevInput = input;
+    if (i + 32 > z) {
+      break;
+    }
+  }
+  return z;
+}
+#endif
+
+#if RX_TEXT_SIMD_SSSE3
+RX_TEXT_TARGET_SSSE3
+static size_t checkUTF8SSSE3(const u8* p, size_t z) {
+  const __m128i nib = _mm_set1_epi8(0x0f);
+  const __m128i t1h = _mm_loadu_si128((const __m128i*)utf8Byte1High);
+  const __m128i t1l = _mm_loadu_si128((const __m128i*)utf8Byte1Low);
+  const __m128i t2h = _mm_loadu_si128((const __m128i*)utf8Byte2High);
+  const __m128i maxValue = _mm_setr_epi8(
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,(char)(0xf0-1),(char)(0xe0-1),(char)(0xc0-1));
+  const __m128i zero = _mm_setzero_si128();
+  __m128i prevInput = zero;
+  __m128i prevIncomplete = zero;
+  u8 tail[16];
+  for (size_t i = 0; i <= z; i += 16) {
+    __m128i input;
+    if (i + 16 <= z) {
+      input = _mm_loadu_si128((const __m128i*)(p + i));
+    } else {
+      memset(tail, 0, sizeof(tail));
+      if (z != i) {
+        memcpy(tail, p + i, z - i);
+      }
+      input = _mm_loadu_si128((const __m128i*)tail);
+    }
+    __m128i err;
+    if (_mm_movemask_epi8(input) == 0) {
+      err = prevIncomplete; // ASCII block
+      prevIncomplete = zero;
+    } else {
+      __m128i prev1 = _mm_alignr_epi8(input, prevInput, 15);
+      __m128i b1h = _mm_shuffle_epi8(t1h, _mm_and_si128(_mm_srli_epi16(prev1, 4), nib));
+      __m128i b1l = _mm_shuffle_epi8(t1l, _mm_and_si128(prev1, nib));
+      __m128i b2h = _mm_shuffle_epi8(t2h, _mm_and_si128(_mm_srli_epi16(input, 4), nib));
+      __m128i special = _mm_and_si128(_mm_and_si128(b1h, b1l), b2h);
+      __m128i is3 = _mm_subs_epu8(_mm_alignr_epi8(input, prevInput, 14), _mm_set1_epi8(0xe0-0x80));
+      __m128i is4 = _mm_subs_epu8(_mm_alignr_epi8(input, prevInput, 13), _mm_set1_epi8(0xf0-0x80));
+      __m128i must23 = _mm_and_si128(_mm_or_si128(is3, is4), _mm_set1_epi8((char)0x80));
+      err = _mm_xor_si128(must23, special);
+      prevIncomplete = _mm_subs_epu8(input, maxValue);
+    }
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(err, zero)) != 0xffff) {
+      return RX_MIN(i, z - 1);
+    }
+    prevInput = input;
+    if (i + 16 > z) {
+      break;
+    }
+  }
+  return z;
+}
+#endif
+
+#if RX_TEXT_SIMD_NEON
+static size_t checkUTF8NEON(const u8* p, size_t z) {
+  const uint8x16_t nib = vdupq_n_u8(0x0f);
+  const uint8x16_t t1h = vld1q_u8(utf8Byte1High);
+  const uint8x16_t t1l = vld1q_u8(utf8Byte1Low);
+  const uint8x16_t t2h = vld1q_u8(utf8Byte2High);
+  static const u8 maxValueBytes[16] = {
+    255,255,255,255,255,255,255,255,255,255,255,255,255,0xf0-1,0xe0-1,0xc0-1};
+  const uint8x16_t maxValue = vld1q_u8(maxValueBytes);
+  uint8x16_t prevInput = vdupq_n_u8(0);
+  uint8x16_t prevIncomplete = vdupq_n_u8(0);
+  u8 tail[16];
+  for (size_t i = 0; i <= z; i += 16) {
+    uint8x16_t input;
+    if (i + 16 <= z) {
+      input = vld1q_u8(p + i);
+    } else {
+      memset(tail, 0, sizeof(tail));
+      if (z != i) {
+        memcpy(tail, p + i, z - i);
+      }
+      input = vld1q_u8(tail);
+    }
+    uint8x16_t err;
+    if (vmaxvq_u8(input) < 0x80) {
+      err = prevIncomplete; // ASCII block
+      prevIncomplete = vdupq_n_u8(0);
+    } else {
+      uint8x16_t prev1 = vextq_u8(prevInput, input, 15);
+      uint8x16_t b1h = vqtbl1q_u8(t1h, vshrq_n_u8(prev1, 4));
+      uint8x16_t b1l = vqtbl1q_u8(t1l, vandq_u8(prev1, nib));
+      uint8x16_t b2h = vqtbl1q_u8(t2h, vshrq_n_u8(input, 4));
+      uint8x16_t special = vandq_u8(vandq_u8(b1h, b1l), b2h);
+      uint8x16_t is3 = vqsubq_u8(vextq_u8(prevInput, input, 14), vdupq_n_u8(0xe0-0x80));
+      uint8x16_t is4 = vqsubq_u8(vextq_u8(prevInput, input, 13), vdupq_n_u8(0xf0-0x80));
+      uint8x16_t must23 = vandq_u8(vorrq_u8(is3, is4), vdupq_n_u8(0x80));
+      err = veorq_u8(must23, special);
+      prevIncomplete = vqsubq_u8(input, maxValue);
+    }
+    if (vmaxvq_u8(err) != 0) {
+      return RX_MIN(i, z - 1);
+    }
+    prevInput = input;
+    if (i + 16 > z) {
+      break;
+    }
+  }
+  return z;
+}
+#endif
+
+// Returns `z` if `s` is valid UTF8. Otherwise returns an offset at most three bytes past the start
+// of the first invalid sequence, from where the exact position can be found with a scalar decoder
+// after backing up to the start of a sequence.
+static size_t checkUTF8(const char* s, size_t z) {
+  auto p = (const u8*)s;
+  size_t i = 0;
+  #if RX_TEXT_SIMD_AVX2
+  if (hasAVX2) {
+    return checkUTF8AVX2(p, z);
+  } else if (hasSSSE3) {
+    return checkUTF8SSSE3(p, z);
+  }
+  #elif RX_TEXT_SIMD_NEON
+  return checkUTF8NEON(p, z);
+  #endif
+  #if RX_TEXT_SIMD_SSE2
+  // Skip ASCII
+  for (; i + 16 <= z; i += 16) {
+    if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(p + i))) != 0) {
+      break;
+    }
+  }
+  #endif
+  for (; i != z && p[i] < 0x80; ++i) {}
+  return (i == z || utf8::is_valid(p + i, p + z)) ? z : i;
+}
+
+}}} // namespace rx::text::simd
+
+
 namespace std {
 std::string to_string(const ::rx::Text& t) {
-  std::string outs;
-  outs.reserve(t.size());
-  _utf8::utf32to8(t.cbegin(), t.cend(), std::back_inserter(outs));
-  return std::move(outs);
+  namespace simd = ::rx::text::simd;
+  std::string outs(simd::encodedLength(t.data(), t.size()), '\0');
+  const u32* inI = t.data();
+  const u32* inE = inI + t.size();
+  char* outp = &outs[0];
+  char* outI = outp;
+  while (inI != inE) {
+    // ASCII runs are narrowed in bulk, and anything else is encoded one code point at a time
+    size_t n = simd::narrowASCII(inI, inE - inI, outI);
+    inI += n;
+    outI += n;
+    while (inI != inE && *inI > 0x7f) {
+      outI = _utf8::append(*inI++, outI);
+    }
+  }
+  assert((size_t)(outI - outp) == outs.size());
+  return outs;
+}
+
+std::string to_string(const ::rx::CompactText& t) {
+  size_t n = t.size();
+  const std::string& b = t.bytes();
+  if (t.width() == 1) {
+    // Latin-1 characters are one or two bytes long
+    size_t z = n;
+    for (char c : b) {
+      z += (u8)c >> 7;
+    }
+    if (z == n) {
+      return b;
+    }
+    std::string outs(z, '\0');
+    char* outI = &outs[0];
+    for (char c : b) {
+      if ((u8)c < 0x80) {
+        *outI++ = c;
+      } else {
+        *outI++ = (char)(0xc0 | ((u8)c >> 6));
+        *outI++ = (char)(0x80 | ((u8)c & 0x3f));
+      }
+    }
+    return outs;
+  }
+  std::string outs(n * (t.width() == 2 ? 3 : 4), '\0');
+  char* outp = &outs[0];
+  char* outI = outp;
+  for (size_t i = 0; i != n; ++i) {
+    outI = _utf8::append(t[i], outI);
+  }
+  outs.resize(outI - outp);
+  return outs;
+}
+}
+
+
+namespace rx {
+
+static inline u8 compactShift(u32 c) {
+  return c > 0xffff ? 2 : c > 0xff ? 1 : 0;
+}
+
+template <typename T>
+static inline void storeCompact(char* p, size_t i, u32 c) {
+  T v = (T)c;
+  memcpy(p + i * sizeof(T), &v, sizeof(T));
+}
+
+static inline void storeCompact(char* p, size_t i, u32 c, u8 shift) {
+  switch (shift) {
+    case 0: storeCompact<u8>(p, i, c); break;
+    case 1: storeCompact<u16>(p, i, c); break;
+    default: storeCompact<u32>(p, i, c); break;
+  }
+}
+
+CompactText::CompactText(const Text& t) : _shift{0} {
+  u32 maxc = 0;
+  for (u32 c : t) {
+    maxc = RX_MAX(maxc, c);
+  }
+  _shift = compactShift(maxc);
+  _bytes.resize(t.size() << _shift);
+  char* p = &_bytes[0];
+  switch (_shift) {
+    case 0: for (size_t i = 0; i != t.size(); ++i) { storeCompact<u8>(p, i, t[i]); } break;
+    case 1: for (size_t i = 0; i != t.size(); ++i) { storeCompact<u16>(p, i, t[i]); } break;
+    default: memcpy(p, t.data(), t.size() * 4); break;
+  }
+}
+
+CompactText CompactText::fromBytes(std::string bytes, size_t width) {
+  assert(width == 1 || width == 2 || width == 4);
+  assert(bytes.size() % width == 0);
+  CompactText t;
+  t._bytes = std::move(bytes);
+  t._shift = width == 4 ? 2 : width == 2 ? 1 : 0;
+  return t;
+}
+
+void CompactText::widen(u8 shift) {
+  assert(shift > _shift);
+  size_t n = size();
+  std::string bytes(n << shift, '\0');
+  char* p = &bytes[0];
+  for (size_t i = 0; i != n; ++i) {
+    storeCompact(p, i, (*this)[i], shift);
+  }
+  _bytes.swap(bytes);
+  _shift = shift;
+}
+
+void CompactText::set(size_t i, u32 c) {
+  assert(i < size());
+  u8 shift = compactShift(c);
+  if (shift > _shift) {
+    widen(shift);
+  }
+  storeCompact(&_bytes[0], i, c, _shift);
+}
+
+void CompactText::push_back(u32 c) {
+  u8 shift = compactShift(c);
+  if (shift > _shift) {
+    widen(shift);
+  }
+  size_t i = size();
+  _bytes.resize(_bytes.size() + width());
+  storeCompact(&_bytes[0], i, c, _shift);
+}
+
+void CompactText::append(const CompactText& t) {
+  if (t._shift > _shift) {
+    widen(t._shift);
+  }
+  if (t._shift == _shift) {
+    _bytes.append(t._bytes);
+    return;
+  }
+  size_t i = size(), n = t.size();
+  _bytes.resize(_bytes.size() + (n << _shift));
+  char* p = &_bytes[0];
+  for (size_t k = 0; k != n; ++k) {
+    storeCompact(p, i + k, t[k], _shift);
+  }
+}
+
+Text CompactText::text() const {
+  size_t n = size();
+  Text t(n, 0);
+  for (size_t i = 0; i != n; ++i) {
+    t[i] = (*this)[i];
+  }
+  return t;
+}
+
+bool CompactText::operator==(const CompactText& t) const {
+  if (_shift == t._shift) {
+    return _bytes == t._bytes;
+  }
+  size_t n = size();
+  if (n != t.size()) {
+    return false;
+  }
+  for (size_t i = 0; i != n; ++i) {
+    if ((*this)[i] != t[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace rx
+
+
+namespace rx {
+namespace text {
+
+
+size_t findInvalid(const char* p, size_t z) {
+  size_t i = simd::checkUTF8(p, z);
+  if (i == z) {
+    return z;
+  }
+  // Back up to the start of a sequence which is at or before the first invalid one. Everything
+  // before `i` is valid, except possibly for a sequence truncated in its last three bytes.
+  i = (i < 3) ? 0 : i - 3;
+  while (i != 0 && utf8::internal::is_trail(p[i])) {
+    --i;
+  }
+  return utf8::find_invalid(p + i, p + z) - p;
+}
+
+
+bool isValidUTF8(const char* p, size_t z) {
+  return simd::checkUTF8(p, z) == z;
+}
+
+
+static inline bool pointsInto(View s, const std::string& buf) {
+  // True if `s` refers to the contents of `buf`, which writing to `buf` would invalidate
+  auto p = (uintptr_t)s.data(), b = (uintptr_t)buf.data();
+  return p >= b && p < b + buf.size();
+}
+
+View repairUTF8(View s, std::string& buf) {
+  const char* p = s.data();
+  size_t z = s.size();
+  size_t i = findInvalid(p, z);
+  if (i == z) {
+    return s;
+  }
+  if (pointsInto(s, buf)) {
+    std::string tmp;
+    repairUTF8(s, tmp);
+    buf.swap(tmp);
+    return View{buf};
+  }
+  buf.clear();
+  if (buf.capacity() < z + 8) {
+    buf.reserve(z + 8);
+  }
+  size_t start = 0; // start of the valid span before `i`
+  do {
+    buf.append(p + start, i - start);
+    buf.append("\xef\xbf\xbd", 3); // U+FFFD
+    const char* q = p + i;
+    auto err = utf8::internal::validate_next(q, p + z); // leaves q where it was, as this fails
+    ++q;
+    if (err != utf8::internal::INVALID_LEAD) {
+      while (q != p + z && simd::isTrail((u8)*q)) {
+        ++q;
+      }
+    }
+    start = q - p;
+    i = start + findInvalid(q, z - start);
+  } while (i != z);
+  buf.append(p + start, z - start);
+  return View{buf};
+}
+
+
+// Decoders for use as template arguments. When building with exceptions, input is validated up
+// front so that valid input can use the faster unchecked decoder, while invalid input goes
+// through the checked decoder which throws at the first error, just like before.
+struct CheckedNext {
+  template <typename I> u32 operator()(I& inI, I inE) const {
+    (void)inE; // unused by UTF8_NEXT without exceptions
+    return UTF8_NEXT(inI, inE);
+  }
+};
+
+struct UncheckedNext {
+  template <typename I> u32 operator()(I& inI, I) const { return utf8::unchecked::next(inI); }
+};
+
+static inline bool canDecodeUnchecked(const char* p, size_t z) {
+  #ifdef RX_TARGET_BUILD_NO_CXX_EXCEPTIONS
+  (void)p; (void)z;
+  return true;
+  #else
+  return isValidUTF8(p, z);
+  #endif
+}
+
+
+template <typename Next>
+static Text decodeUTF8Imp(View s, Next next) {
+  const char* inI = s.data();
+  const char* inE = inI + s.size();
+  Text t(simd::countCodepoints(inI, s.size()), 0);
+  u32* outp = &t[0];
+  size_t outi = 0;
+  while (inI != inE) {
+    // ASCII runs are widened in bulk, and multi-byte sequences are decoded one at a time
+    size_t n = simd::widenASCII(inI, RX_MIN((size_t)(inE - inI), t.size() - outi), outp + outi);
+    inI += n;
+    outi += n;
+    while (inI != inE && ((u8)*inI > 0x7f || outi == t.size())) {
+      if (outi == t.size()) {
+        // Only happens for invalid input to the unchecked decoder, where stray continuation bytes
+        // decode to code points of their own.
+        t.resize(t.size() + (inE - inI));
+        outp = &t[0];
+      }
+      outp[outi++] = next(inI, inE);
+    }
+  }
+  t.resize(outi);
+  return t;
+}
+
+
+static Text decodeUTF8Imp(View s) {
+  return canDecodeUnchecked(s.data(), s.size()) ?
+    decodeUTF8Imp(s, UncheckedNext{}) :
+    decodeUTF8Imp(s, CheckedNext{}) ;
+}
+
+
+Text decodeUTF8(const std::string& s) {
+  return decodeUTF8Imp(s);
+}
+
+
+Text decodeUTF8(View s) {
+  return decodeUTF8Imp(s);
+}
+
+
+template <typename T>
+static void decodeCompactImp(const char* inI, const char* inE, char* outp) {
+  // Input must be valid UTF8
+  for (size_t i = 0; inI != inE; ++i) {
+    u32 uc = (u8)*inI < 0x80 ? (u8)*inI++ : utf8::unchecked::next(inI);
+    storeCompact<T>(outp, i, uc);
+  }
+}
+
+
+CompactText decodeUTF8Compact(View s) {
+  if (!isValidUTF8(s.data(), s.size())) {
+    return CompactText(decodeUTF8Imp(s));
+  }
+  // The largest lead byte tells the width: C4 starts U+0100 and F0 starts U+10000
+  u8 maxb = 0;
+  for (char c : s) {
+    maxb = RX_MAX(maxb, (u8)c);
+  }
+  if (maxb < 0x80) {
+    return CompactText::fromBytes(s.str(), 1);
+  }
+  size_t width = maxb >= 0xf0 ? 4 : maxb >= 0xc4 ? 2 : 1;
+  std::string bytes(simd::countCodepoints(s.data(), s.size()) * width, '\0');
+  switch (width) {
+    case 1: decodeCompactImp<u8>(s.begin(), s.end(), &bytes[0]); break;
+    case 2: decodeCompactImp<u16>(s.begin(), s.end(), &bytes[0]); break;
+    default: decodeCompactImp<u32>(s.begin(), s.end(), &bytes[0]); break;
+  }
+  return CompactText::fromBytes(std::move(bytes), width);
+}
+
+
+enum class MapStop : u8 {
+  None,        // Iteration reached the end of the input
+  IncludeRest, // Stopped by MapIncludeAll or MapIncludeRest
+  IgnoreRest,  // Stopped by MapIgnoreAll or MapIgnoreRest
+};
+
+template <typename I, typename F, typename Next>
+static inline MapStop mapImp(std::string& outs, I inI, I inE, F& fun, Next next) {
+  // Appends to `outs`. Returns how iteration stopped, which parallel mapping needs to know.
+  // Probably going to be the same size. Only grow, as older libstdc++ shrinks on a smaller reserve,
+  // which would throw away the capacity of reused buffers.
+  if (outs.capacity() < outs.size() + (inE - inI)) {
+    outs.reserve(outs.size() + (inE - inI));
+  }
+  auto outI = std::back_inserter(outs);
+
+  while (inI != inE) {
+    u32 uc = next(inI, inE);
+    u32 mapped = fun(uc);
+
+    switch (mapped) {
+      case MapIgnore: {
+        // Ignore the current character.
+        break;
+      }
+      case MapIncludeAll: {
+        // Include the current and all remaining characters and stop iteration.
+        outI = _utf8::append(uc, outI);
+        outs.append(inI, inE);
+        goto include_rest;
+      }
+      case MapIncludeRest: {
+        // Ignore the current character, but include all remaining characters.
+        outs.append(inI, inE);
+        goto include_rest;
+      }
+      case MapIgnoreAll: {
+        // Ignore the current and any remaining characters and stop iteration.
+        goto ignore_rest;
+      }
+      case MapIgnoreRest: {
+        // Include the current character, but ignore any remaining characters.
+        outI = _utf8::append(uc, outI);
+        goto ignore_rest;
+      }
+      default: {
+        assert(mapped < _MapSpecialMin || mapped > _MapSpecialMax);
+        outI = _utf8::append(mapped, outI);
+        break;
+      }
+    }
+  }
+
+  return MapStop::None;
+
+  include_rest:
+  return MapStop::IncludeRest;
+
+  ignore_rest:
+  return MapStop::IgnoreRest;
+}
+
+
+template <typename F>
+static inline void mapImp(std::string& outs, View ins, F& fun) {
+  if (canDecodeUnchecked(ins.data(), ins.size())) {
+    mapImp(outs, ins.begin(), ins.end(), fun, UncheckedNext{});
+  } else {
+    mapImp(outs, ins.begin(), ins.end(), fun, CheckedNext{});
+  }
+}
+
+char* _appendInvalidUTF8(char* p, u32 uc) {
+  return _utf8::append(uc, p);
+}
+
+std::string mapF(const std::string& ins, u32(*fun)(u32)) {
+  std::string outs;
+  mapImp(outs, ins, fun);
+  return outs;
+}
+
+std::string map(const std::string& ins, rx::func<u32(u32)> fun) {
+  std::string outs;
+  mapImp(outs, ins, fun);
+  return outs;
+}
+
+void mapInto(std::string& outs, View ins, rx::func<u32(u32)> fun) {
+  mapImp(outs, ins, fun);
+}
+
+
+UTF8Index::UTF8Index(View s, size_t interval) : _s{s}, _interval{RX_MAX(interval, (size_t)1)} {
+  // Each 64 byte block is reduced to a mask of code point starts. Blocks which hold a sample point
+  // are searched for the right bit.
+  auto p = (const u8*)s.data();
+  size_t z = s.size(), i = 0, count = 0, next = 0;
+  _samples.reserve(z / _interval + 1);
+  for (; i + 64 <= z; i += 64) {
+    u64 m = simd::leadMask64(p + i);
+    size_t n = __builtin_popcountll(m);
+    while (next < count + n) {
+      u64 mm = m;
+      for (size_t k = next - count; k != 0; --k) {
+        mm &= mm - 1;
+      }
+      _samples.push_back(i + __builtin_ctzll(mm));
+      next += _interval;
+    }
+    count += n;
+  }
+  for (; i != z; ++i) {
+    if (!simd::isTrail(p[i])) {
+      if (count == next) {
+        _samples.push_back(i);
+        next += _interval;
+      }
+      ++count;
+    }
+  }
+  _count = count;
+}
+
+size_t UTF8Index::byteOffset(size_t cpIndex) const {
+  if (cpIndex >= _count) {
+    return _s.size();
+  }
+  auto p = (const u8*)_s.data();
+  size_t i = _samples[cpIndex / _interval];
+  for (size_t n = cpIndex % _interval; n != 0; --n) {
+    do { ++i; } while (simd::isTrail(p[i]));
+  }
+  return i;
+}
+
+size_t UTF8Index::cpIndex(size_t byteOffset) const {
+  if (byteOffset >= _s.size()) {
+    return _count;
+  }
+  auto it = std::upper_bound(_samples.begin(), _samples.end(), byteOffset);
+  if (it == _samples.begin()) {
+    return 0; // leading continuation bytes of invalid input
+  }
+  size_t s = (it - _samples.begin()) - 1;
+  size_t i = _samples[s];
+  return s * _interval + simd::countCodepoints(_s.data() + i + 1, byteOffset - i);
+}
+
+// Parallel processing of large inputs. The input is split into chunks at code point boundaries,
+// the chunks are processed by a set of threads which each claim the next unprocessed chunk, and
+// the results are concatenated in input order. Invalid input is handed to the single-threaded
+// version, so that it's reported in exactly the same way.
+
+static const size_t parallelMinChunkSize = 1024 * 1024;
+static const size_t parallelChunksPerThread = 4; // smooths out uneven chunk processing times
+
+static size_t parallelThreadCount(size_t nthreads) {
+  if (nthreads == 0) {
+    nthreads = rx::thread::hardware_concurrency();
+  }
+  return RX_MAX(nthreads, (size_t)1);
+}
+
+static bool splitChunks(View ins, size_t nthreads, std::vector<const char*>& bounds) {
+  // Stores chunk boundaries in `bounds`, i.e. chunk i is [bounds[i], bounds[i+1]). Returns false
+  // if the input is too small to be worth splitting.
+  size_t nchunks = RX_MIN(ins.size() / parallelMinChunkSize, nthreads * parallelChunksPerThread);
+  if (nthreads < 2 || nchunks < 2) {
+    return false;
+  }
+  bounds.reserve(nchunks + 1);
+  bounds.push_back(ins.begin());
+  for (size_t i = 1; i != nchunks; ++i) {
+    // Move back to the start of a sequence. Invalid input might not have one within reach, but
+    // then it's not going to be processed in parallel anyway.
+    const char* p = ins.begin() + (ins.size() / nchunks) * i;
+    for (const char* e = p - 3; p != e && simd::isTrail((u8)*p); --p) {}
+    bounds.push_back(p);
+  }
+  bounds.push_back(ins.end());
+  return true;
+}
+
+template <typename F>
+static void runParallel(size_t nthreads, size_t nchunks, F& fun) {
+  // Calls fun(chunkIndex) for each chunk, on up to `nthreads` threads including the calling one.
+  // If `fun` throws, chunks which haven't started are skipped, and once all threads are done the
+  // exception from the earliest chunk is rethrown on the calling thread, like a sequential loop
+  // would have thrown it. Chunks are handed out in order, so all earlier chunks have run by then.
+  volatile long next = 0;
+  #ifndef RX_TARGET_BUILD_NO_CXX_EXCEPTIONS
+  Spinlock errorLock;
+  std::exception_ptr error;
+  size_t errorChunk = nchunks;
+  #endif
+  auto work = [&] {
+    size_t i;
+    while ((i = (size_t)rx_atomic_add_fetch(&next, 1L) - 1) < nchunks) {
+      #ifdef RX_TARGET_BUILD_NO_CXX_EXCEPTIONS
+      fun(i);
+      #else
+      try {
+        fun(i);
+      } catch (...) {
+        rx_atomic_add_fetch(&next, (long)nchunks); // skip the rest
+        ScopedSpinlock lock{errorLock};
+        if (i < errorChunk) {
+          error = std::current_exception();
+          errorChunk = i;
+        }
+      }
+      #endif
+    }
+  };
+  std::vector<rx::thread> threads;
+  for (size_t i = 1, n = RX_MIN(nthreads, nchunks); i != n; ++i) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto& t : threads) {
+    t.join();
+  }
+  #ifndef RX_TARGET_BUILD_NO_CXX_EXCEPTIONS
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  #endif
+}
+
+template <typename F>
+static std::string mapParallelImp(View ins, F& fun, size_t nthreads) {
+  nthreads = parallelThreadCount(nthreads);
+  std::vector<const char*> bounds;
+  std::string outs;
+  if (!splitChunks(ins, nthreads, bounds)) {
+    mapImp(outs, ins, fun);
+    return outs;
+  }
+
+  size_t nchunks = bounds.size() - 1;
+  std::vector<std::string> chunkOuts(nchunks);
+  std::vector<MapStop> stops(nchunks, MapStop::None);
+  std::vector<u8> invalid(nchunks, 0);
+  volatile long stopChunk = (long)nchunks; // first chunk known to have stopped iteration
+
+  auto mapChunk = [&](size_t i) {
+    if ((long)i > stopChunk) {
+      return; // output would be discarded
+    }
+    const char* p = bounds[i];
+    size_t z = bounds[i + 1] - p;
+    if (!isValidUTF8(p, z)) {
+      invalid[i] = 1;
+      return;
+    }
+    stops[i] = mapImp(chunkOuts[i], p, p + z, fun, UncheckedNext{});
+    if (stops[i] != MapStop::None) {
+      long prev = stopChunk;
+      while ((long)i < prev && !rx_atomic_cas_bool(&stopChunk, prev, (long)i)) {
+        prev = stopChunk;
+      }
+    }
+  };
+  runParallel(nthreads, nchunks, mapChunk);
+
+  // Chunks after the one which stopped iteration were possibly skipped, but never looked at here
+  size_t i = 0, size = 0;
+  for (; i != nchunks; ++i) {
+    if (invalid[i]) {
+      mapImp(outs, ins, fun);
+      return outs;
+    }
+    size += chunkOuts[i].size();
+    if (stops[i] == MapStop::IncludeRest) {
+      size += ins.end() - bounds[i + 1];
+      break;
+    } else if (stops[i] == MapStop::IgnoreRest) {
+      break;
+    }
+  }
+  outs.reserve(size);
+  for (size_t k = 0; k != nchunks; ++k) {
+    outs.append(chunkOuts[k]);
+    if (k == i) {
+      if (stops[k] == MapStop::IncludeRest) {
+        outs.append(bounds[k + 1], ins.end());
+      }
+      break;
+    }
+  }
+  return outs;
+}
+
+std::string mapParallel(View ins, rx::func<u32(u32)> fun, size_t nthreads) {
+  return mapParallelImp(ins, fun, nthreads);
+}
+
+std::string filterParallel(View ins, rx::func<bool(u32)> f, size_t nthreads) {
+  auto fun = [&](u32 c) -> u32 { return f(c) ? c : (u32)MapIgnore; };
+  return mapParallelImp(ins, fun, nthreads);
+}
+
+std::string normalizeParallel(View ins, size_t nthreads) {
+  u32(*fun)(u32) = normalize;
+  return mapParallelImp(ins, fun, nthreads);
+}
+
+Text decodeUTF8Parallel(View ins, size_t nthreads) {
+  nthreads = parallelThreadCount(nthreads);
+  std::vector<const char*> bounds;
+  if (!splitChunks(ins, nthreads, bounds)) {
+    return decodeUTF8Imp(ins);
+  }
+
+  size_t nchunks = bounds.size() - 1;
+  std::vector<Text> chunkOuts(nchunks);
+  std::vector<u8> invalid(nchunks, 0);
+  auto decodeChunk = [&](size_t i) {
+    View chunk{bounds[i], (size_t)(bounds[i + 1] - bounds[i])};
+    if (!isValidUTF8(chunk.data(), chunk.size())) {
+      invalid[i] = 1;
+      return;
+    }
+    chunkOuts[i] = decodeUTF8Imp(chunk, UncheckedNext{});
+  };
+  runParallel(nthreads, nchunks, decodeChunk);
+
+  size_t size = 0;
+  for (size_t i = 0; i != nchunks; ++i) {
+    if (invalid[i]) {
+      return decodeUTF8Imp(ins);
+    }
+    size += chunkOuts[i].size();
+  }
+  Text t;
+  t.reserve(size);
+  for (auto& chunk : chunkOuts) {
+    t.append(chunk);
+  }
+  return t;
+}
+
+
+// Output for StreamDecoder, either code points or UTF8
+static inline void streamEmit(u32 uc, u32*& outI) {
+  *outI++ = uc;
+}
+
+static inline void streamEmit(u32 uc, char*& outI) {
+  outI = _utf8::append(uc, outI);
+}
+
+static inline size_t streamASCII(const char* inI, size_t z, u32* outI) {
+  return simd::widenASCII(inI, z, outI);
+}
+
+static inline size_t streamASCII(const char*, size_t, char*) {
+  return 0; // UTF8 output goes through the per-character path which validates the input
+}
+
+static inline bool streamRest(const char*, const char*, u32*&) {
+  return false; // code point output decodes the rest of the input
+}
+
+static inline bool streamRest(const char* inI, const char* inE, char*& outI) {
+  memcpy(outI, inI, inE - inI);
+  outI += inE - inI;
+  return true;
+}
+
+
+StreamDecoder::StreamDecoder() : StreamDecoder(nullptr) {}
+
+StreamDecoder::StreamDecoder(rx::func<u32(u32)> fun)
+  : _fun{std::move(fun)}, _mode{Mode::Map}, _npending{0} {}
+
+
+template <typename O>
+inline bool StreamDecoder::put(u32 uc, O*& outI) {
+  if (_mode != Mode::Map || !_fun) {
+    streamEmit(uc, outI);
+    return true;
+  }
+  u32 mapped = _fun(uc);
+  switch (mapped) {
+    case MapIgnore: {
+      return true;
+    }
+    case MapIncludeAll: {
+      streamEmit(uc, outI);
+      _mode = Mode::Pass;
+      return true;
+    }
+    case MapIncludeRest: {
+      _mode = Mode::Pass;
+      return true;
+    }
+    case MapIgnoreAll: {
+      _mode = Mode::Ignore;
+      return false;
+    }
+    case MapIgnoreRest: {
+      streamEmit(uc, outI);
+      _mode = Mode::Ignore;
+      return false;
+    }
+    default: {
+      assert(mapped < _MapSpecialMin || mapped > _MapSpecialMax);
+      streamEmit(mapped, outI);
+      return true;
+    }
+  }
+}
+
+
+template <typename O>
+size_t StreamDecoder::feedImp(const char* inI, size_t z, O* outp) {
+  const char* inE = inI + z;
+  O* outI = outp;
+
+  if (_mode == Mode::Ignore) {
+    return 0;
+  }
+
+  if (_npending != 0) {
+    // Complete the sequence carried over from the previous chunk
+    size_t seqlen = (size_t)utf8::internal::sequence_length(_pending);
+    size_t n = RX_MIN(seqlen - _npending, z);
+    memcpy(_pending + _npending, inI, n);
+    _npending += n;
+    inI += n;
+    if (_npending < seqlen) {
+      return 0;
+    }
+    _npending = 0;
+    const char* seqI = _pending;
+    if (!put(UTF8_NEXT(seqI, (const char*)_pending + seqlen), outI)) {
+      return outI - outp;
+    }
+  }
+
+  // Validate the chunk up to its last complete sequence, so that the unchecked decoder can be
+  // used when it is valid (see canDecodeUnchecked)
+  const char* completeE = inE;
+  for (const char* p = inE; p != inI && inE - p < 4; ) {
+    if (!utf8::internal::is_trail(*--p)) {
+      if ((size_t)utf8::internal::sequence_length(p) > (size_t)(inE - p)) {
+        completeE = p;
+      }
+      break;
+    }
+  }
+  bool unchecked = canDecodeUnchecked(inI, completeE - inI);
+
+  while (inI != inE) {
+    if (_mode == Mode::Pass || !_fun) {
+      if (_mode == Mode::Pass && streamRest(inI, inE, outI)) {
+        break;
+      }
+      size_t n = streamASCII(inI, inE - inI, outI);
+      inI += n;
+      outI += n;
+      if (inI == inE) {
+        break;
+      }
+    }
+    size_t seqlen = (size_t)utf8::internal::sequence_length(inI);
+    if (seqlen > (size_t)(inE - inI)) {
+      // Sequence continues in the next chunk
+      _npending = (u8)(inE - inI);
+      memcpy(_pending, inI, _npending);
+      break;
+    }
+    if (!put(unchecked ? utf8::unchecked::next(inI) : UTF8_NEXT(inI, inE), outI)) {
+      break;
+    }
+  }
+
+  return outI - outp;
+}
+
+
+size_t StreamDecoder::feed(const char* p, size_t z, u32* out) {
+  return feedImp(p, z, out);
+}
+
+size_t StreamDecoder::feed(const char* p, size_t z, char* out) {
+  return feedImp(p, z, out);
+}
+
+bool StreamDecoder::finish() {
+  bool complete = _npending == 0;
+  _npending = 0;
+  _mode = Mode::Map;
+  return complete;
+}
+
+bool StreamDecoder::stopped() const {
+  return _mode == Mode::Ignore;
+}
+
+
+static inline u32 foldASCII(u32 c) {
+  return c + ((c - 'A' < 26) ? 32 : 0);
+}
+
+
+int compareFolded(View a, View b) {
+  const char* aI = a.begin();
+  const char* aE = a.end();
+  const char* bI = b.begin();
+  const char* bE = b.end();
+  while (aI != aE && bI != bE) {
+    u32 ac = (u8)*aI;
+    u32 bc = (u8)*bI;
+    if ((ac | bc) < 0x80) {
+      ac = foldASCII(ac);
+      bc = foldASCII(bc);
+      ++aI;
+      ++bI;
+    } else {
+      // Identical sequences fold identically, so there's no need to fold them or decode the
+      // second one. The first is still decoded so that invalid input is reported like FoldedHash
+      // does.
+      const char* charI = aI;
+      u32 uc = UTF8_NEXT(aI, aE);
+      size_t n = aI - charI;
+      if (n <= (size_t)(bE - bI) && memcmp(charI, bI, n) == 0) {
+        bI += n;
+        continue;
+      }
+      ac = normalize(uc);
+      bc = normalize(UTF8_NEXT(bI, bE));
+    }
+    if (ac != bc) {
+      return (ac < bc) ? -1 : 1;
+    }
+  }
+  return (aI != aE) ? 1 : (bI != bE) ? -1 : 0;
+}
+
+
+bool equalsFolded(View a, View b) {
+  return compareFolded(a, b) == 0;
+}
+
+
+size_t FoldedHash::operator()(View s) const {
+  // FNV-1a over folded characters
+  u64 h = 0xcbf29ce484222325ull;
+  const char* inI = s.begin();
+  const char* inE = s.end();
+  while (inI != inE) {
+    u32 uc = (u8)*inI;
+    if (uc < 0x80) {
+      uc = foldASCII(uc);
+      ++inI;
+    } else {
+      uc = normalize(UTF8_NEXT(inI, inE));
+    }
+    h = (h ^ uc) * 0x100000001b3ull;
+  }
+  return (size_t)h;
+}
+
+
+static void unfold(u32 folded, std::vector<u32>& out);
+  // Appends `folded` and all characters which normalize to it
+
+static inline u32 nextFolded(const char*& inI, const char* inE) {
+  (void)inE; // unused by UTF8_NEXT without exceptions
+  u32 uc = (u8)*inI;
+  if (uc < 0x80) {
+    ++inI;
+    return foldASCII(uc);
+  }
+  return normalize(UTF8_NEXT(inI, inE));
+}
+
+static const char* matchFolded(const char* inI, const char* inE, const u32* needle, size_t m) {
+  // Returns the end of the match if `needle` matches at inI, or nullptr
+  for (size_t i = 0; i != m; ++i) {
+    if (inI == inE || nextFolded(inI, inE) != needle[i]) {
+      return nullptr;
+    }
+  }
+  return inI;
+}
+
+static inline const char* nextChar(const char* p, const char* e) {
+  do { ++p; } while (p != e && simd::isTrail((u8)*p));
+  return p;
+}
+
+static inline const char* prevChar(const char* p, const char* b) {
+  do { --p; } while (p != b && simd::isTrail((u8)*p));
+  return p;
+}
+
+
+FoldedSearcher::FoldedSearcher(View needle) : _nfirst{0} {
+  const char* inI = needle.begin();
+  while (inI != needle.end()) {
+    _needle.push_back(nextFolded(inI, needle.end()));
+  }
+  size_t m = _needle.size();
+  for (auto& shift : _skip) {
+    shift = (u32)RX_MAX(m, (size_t)1);
+  }
+  for (size_t i = 0; i + 1 < m; ++i) {
+    _skip[_needle[i] & 0xff] = (u32)(m - 1 - i);
+  }
+  if (m != 0) {
+    // Collect the bytes which can start a match
+    std::vector<u32> first;
+    unfold(_needle[0], first);
+    for (u32 c : first) {
+      char b[4];
+      _appendUTF8(b, c);
+      u8 lead = (u8)b[0];
+      if (std::find(_first, _first + _nfirst, lead) == _first + _nfirst) {
+        if (_nfirst == 4) {
+          _nfirst = 0; // too many to be worth it
+          break;
+        }
+        _first[_nfirst++] = lead;
+      }
+    }
+    for (size_t i = _nfirst; i != 0 && i != 4; ++i) {
+      _first[i] = _first[0];
+    }
+  }
+}
+
+
+size_t FoldedSearcher::find(View haystack, size_t* matchSize) const {
+  const char* inB = haystack.begin();
+  const char* inE = haystack.end();
+  const u32* n = _needle.data();
+  size_t m = _needle.size();
+  const char* matchE = inB;
+  if (m == 0) {
+    goto found;
+  }
+
+  if (_nfirst != 0 && m < 8) {
+    // Short needles: look for bytes which can start a match and check each of them
+    for (const char* inI = inB; ; ++inI) {
+      inI += simd::findAnyOf4(inI, inE - inI, _first);
+      if (inI == inE) {
+        break;
+      }
+      if ((matchE = matchFolded(inI, inE, n, m)) != nullptr) {
+        inB = inI;
+        goto found;
+      }
+    }
+  } else {
+    // Horspool: look at the last character of each window, and skip ahead as far as the needle
+    // allows when it can't be the end of a match. The window is tracked by its last character.
+    const char* lastI = inB;
+    for (size_t i = 1; i < m && lastI != inE; ++i) {
+      lastI = nextChar(lastI, inE);
+    }
+    while (lastI != inE) {
+      const char* p = lastI;
+      u32 c = nextFolded(p, inE);
+      if (c == n[m - 1]) {
+        // Invalid input can have fewer than m characters before lastI, which can't be a match
+        const char* startI = lastI;
+        for (size_t i = 1; i < m && startI != nullptr; ++i) {
+          startI = startI == inB ? nullptr : prevChar(startI, inB);
+        }
+        if (startI != nullptr && (matchE = matchFolded(startI, inE, n, m)) != nullptr) {
+          inB = startI;
+          goto found;
+        }
+      }
+      for (u32 shift = _skip[c & 0xff]; shift != 0 && lastI != inE; --shift) {
+        lastI = nextChar(lastI, inE);
+      }
+    }
+  }
+  return npos;
+
+  found:
+  if (matchSize != nullptr) {
+    *matchSize = matchE - inB;
+  }
+  return inB - haystack.begin();
+}
+
+
+size_t findFolded(View haystack, View needle, size_t* matchSize) {
+  return FoldedSearcher{needle}.find(haystack, matchSize);
+}
+
+
+// Aho-Corasick automaton over the UTF8 bytes of the folded patterns. Transitions are stored as a
+// double array: state s has a transition on byte c to state t = base(s) + c if check(t) == s.
+// State 0 is the root.
+struct MultiMatcher::Imp : rx::ref_counted {
+  static const u32 none = 0xffffffffu;
+  struct State {
+    u32 base    = 0;
+    u32 check   = none;
+    u32 fail    = 0;    // state of the longest proper suffix which is in the trie
+    u32 output  = none; // first entry in `outputs` for patterns which end here
+    u32 outLink = 0;    // nearest state on the fail chain with an output, or 0 for none
+  };
+  struct Output {
+    u32 pattern;
+    u32 next;
+  };
+  std::vector<State>  states;
+  std::vector<Output> outputs;
+  std::vector<u32>    patternChars; // length of each pattern in characters
+  size_t              maxChars = 0;
+
+  u32 step(u32 s, u8 c) const {
+    while (true) {
+      u32 t = states[s].base + c;
+      if (states[t].check == s) {
+        return t;
+      }
+      if (s == 0) {
+        return 0;
+      }
+      s = states[s].fail;
+    }
+  }
+};
+
+
+MultiMatcher::MultiMatcher() : self{nullptr} {}
+
+MultiMatcher::MultiMatcher(const std::vector<std::string>& patterns) : self{new Imp} {
+  Imp& a = *self;
+
+  // Build a trie of the folded patterns
+  struct TrieNode {
+    std::vector<std::pair<u8,u32>> children; // (byte, node), sorted by byte
+    u32                            output = Imp::none;
+  };
+  std::vector<TrieNode> trie(1);
+  a.patternChars.resize(patterns.size());
+  for (u32 i = 0; i != patterns.size(); ++i) {
+    u32 node = 0;
+    u32 nchars = 0;
+    const char* inI = patterns[i].data();
+    const char* inE = inI + patterns[i].size();
+    while (inI != inE) {
+      char b[4];
+      size_t n = _appendUTF8(b, nextFolded(inI, inE)) - b;
+      for (size_t k = 0; k != n; ++k) {
+        auto& children = trie[node].children;
+        auto I = std::lower_bound(children.begin(), children.end(), std::make_pair((u8)b[k], (u32)0));
+        if (I != children.end() && I->first == (u8)b[k]) {
+          node = I->second;
+        } else {
+          children.insert(I, std::make_pair((u8)b[k], (u32)trie.size()));
+          node = (u32)trie.size();
+          trie.emplace_back();
+        }
+      }
+      ++nchars;
+    }
+    a.patternChars[i] = nchars;
+    a.maxChars = RX_MAX(a.maxChars, (size_t)nchars);
+    if (node != 0) {
+      a.outputs.push_back(Imp::Output{i, trie[node].output});
+      trie[node].output = (u32)(a.outputs.size() - 1);
+    }
+  }
+
+  // Place the trie in the double array, in breadth-first order. For each node, find the lowest
+  // base at which all of its children's cells are free. Free cells form a doubly linked list
+  // headed by the root's cell, which is never free; cells past the end of the array are all free.
+  std::vector<u32> order{0};   // states in breadth-first order
+  std::vector<u32> nodeOf{0};  // trie node of each state in `order`
+  std::vector<u32> nextFree{1};
+  std::vector<u32> prevFree{0};
+  u32 lastFree = 0;
+  u32 maxBase = 0;
+  a.states.resize(1);
+  auto grow = [&](size_t z) {
+    for (size_t t = a.states.size(); t < z; ++t) {
+      nextFree.push_back((u32)t + 1);
+      prevFree.push_back(lastFree);
+      lastFree = (u32)t;
+    }
+    a.states.resize(RX_MAX(a.states.size(), z));
+  };
+  auto take = [&](u32 t) {
+    nextFree[prevFree[t]] = nextFree[t];
+    if (nextFree[t] < nextFree.size()) {
+      prevFree[nextFree[t]] = prevFree[t];
+    } else {
+      lastFree = prevFree[t];
+    }
+  };
+  for (size_t i = 0; i != order.size(); ++i) {
+    u32 s = order[i];
+    const TrieNode& node = trie[nodeOf[i]];
+    a.states[s].output = node.output;
+    if (node.children.empty()) {
+      continue;
+    }
+    u8 c0 = node.children[0].first;
+    u32 base = 0;
+    for (u32 t = nextFree[0]; ; t = (t < nextFree.size()) ? nextFree[t] : t + 1) {
+      if (t <= c0) {
+        continue;
+      }
+      base = t - c0;
+      bool fits = true;
+      for (auto& child : node.children) {
+        size_t t2 = base + child.first;
+        if (t2 < a.states.size() && a.states[t2].check != Imp::none) {
+          fits = false;
+          break;
+        }
+      }
+      if (fits) {
+        break;
+      }
+    }
+    a.states[s].base = base;
+    maxBase = RX_MAX(maxBase, base);
+    grow((size_t)base + node.children.back().first + 1);
+    for (auto& child : node.children) {
+      take(base + child.first);
+      a.states[base + child.first].check = s;
+      order.push_back(base + child.first);
+      nodeOf.push_back(child.second);
+    }
+  }
+  // Pad the array so that step() never needs to check bounds
+  a.states.resize((size_t)maxBase + 256);
+
+  // Fail links, in breadth-first order so that shorter suffixes are done first
+  for (size_t i = 0; i != order.size(); ++i) {
+    u32 s = order[i];
+    for (auto& child : trie[nodeOf[i]].children) {
+      u32 t = a.states[s].base + child.first;
+      u32 f = (s == 0) ? 0 : a.step(a.states[s].fail, child.first);
+      a.states[t].fail = f;
+      a.states[t].outLink = (a.states[f].output != Imp::none) ? f : a.states[f].outLink;
+    }
+  }
+  a.states.shrink_to_fit();
+}
+
+
+bool MultiMatcher::match(View s, rx::func<bool(const Match&)> fun) const {
+  if (self == nullptr || self->maxChars == 0) {
+    return true;
+  }
+  const Imp& a = *self;
+  // Start offsets of the last maxChars characters, for finding where matches begin
+  size_t mask = 1;
+  while (mask < a.maxChars) {
+    mask <<= 1;
+  }
+  std::vector<size_t> starts(mask--);
+
+  const char* inB = s.begin();
+  const char* inI = inB;
+  const char* inE = s.end();
+  size_t nchars = 0;
+  u32 state = 0;
+  while (inI != inE) {
+    starts[nchars++ & mask] = inI - inB;
+    u32 c = nextFolded(inI, inE);
+    if (c < 0x80) {
+      state = a.step(state, (u8)c);
+    } else {
+      char b[4];
+      const char* bE = _appendUTF8(b, c);
+      for (const char* bI = b; bI != bE; ++bI) {
+        state = a.step(state, (u8)*bI);
+      }
+    }
+    u32 o = (a.states[state].output != Imp::none) ? state : a.states[state].outLink;
+    while (o != 0) {
+      for (u32 i = a.states[o].output; i != Imp::none; i = a.outputs[i].next) {
+        u32 pattern = a.outputs[i].pattern;
+        Match m{pattern, starts[(nchars - a.patternChars[pattern]) & mask], (size_t)(inI - inB)};
+        if (!fun(m)) {
+          return false;
+        }
+      }
+      o = a.states[o].outLink;
+    }
+  }
+  return true;
+}
+
+std::vector<MultiMatcher::Match> MultiMatcher::matchAll(View s) const {
+  std::vector<Match> matches;
+  match(s, [&](const Match& m) { matches.push_back(m); return true; });
+  return matches;
+}
+
+bool MultiMatcher::matchesAny(View s) const {
+  return !match(s, [](const Match&) { return false; });
+}
+
+
+static void appendSortKey(std::string& outs, View s) {
+  const char* inI = s.begin();
+  const char* inE = s.end();
+  while (inI != inE) {
+    u32 c = (u8)*inI;
+    if (c < 0x80) {
+      ++inI;
+      if (c == 0) {
+        outs.append("\0\1", 2);
+      } else {
+        outs.push_back((char)foldASCII(c));
+      }
+    } else {
+      char b[4];
+      outs.append(b, _appendUTF8(b, normalize(UTF8_NEXT(inI, inE))) - b);
+    }
+  }
+  outs.append("\0\0", 2);
+}
+
+std::string sortKey(View s) {
+  std::string key;
+  key.reserve(s.size() + 2);
+  appendSortKey(key, s);
+  return key;
+}
+
+SortKeys sortKeys(const std::vector<std::string>& v) {
+  SortKeys keys;
+  size_t z = 0;
+  for (auto& s : v) {
+    z += s.size() + 2;
+  }
+  keys.arena.reserve(z);
+  keys.offsets.reserve(v.size() + 1);
+  keys.offsets.push_back(0);
+  for (auto& s : v) {
+    appendSortKey(keys.arena, s);
+    keys.offsets.push_back(keys.arena.size());
+  }
+  return keys;
 }
+
+
+// JSON escaping. Runs of bytes which need no escaping are found with SIMD and copied as they are.
+
+template <typename Sink>
+static void escapeJSONImp(Sink& out, View s) {
+  static const char hex[] = "0123456789abcdef";
+  const char* inI = s.begin();
+  const char* inE = s.end();
+  while (true) {
+    size_t n = simd::findJSONEscape(inI, inE - inI);
+    if (n != 0) {
+      out.append(inI, inI + n);
+      inI += n;
+    }
+    if (inI == inE) {
+      break;
+    }
+    u8 c = (u8)*inI;
+    if (c == 0xc2) {
+      if (inE - inI < 2 || (u8)inI[1] < 0x80 || (u8)inI[1] >= 0xa0) {
+        // U+00A0..U+00BF, or invalid input, which is copied as-is
+        size_t z = (inE - inI < 2 || !simd::isTrail((u8)inI[1])) ? 1 : 2;
+        out.append(inI, inI + z);
+        inI += z;
+        continue;
+      }
+      c = (u8)inI[1]; // U+0080..U+009F
+      ++inI;
+    }
+    ++inI;
+    char b[6] = {'\\', 0, 0, 0, 0, 0};
+    switch (c) {
+      case '"':  b[1] = '"'; break;
+      case '\\': b[1] = '\\'; break;
+      case '\b': b[1] = 'b'; break;
+      case '\f': b[1] = 'f'; break;
+      case '\n': b[1] = 'n'; break;
+      case '\r': b[1] = 'r'; break;
+      case '\t': b[1] = 't'; break;
+      default:
+        b[1] = 'u';
+        b[2] = '0';
+        b[3] = '0';
+        b[4] = hex[c >> 4];
+        b[5] = hex[c & 0xf];
+        out.write(b, 6);
+        continue;
+    }
+    out.write(b, 2);
+  }
 }
 
+size_t escapeJSON(char* out, size_t outsize, View s) {
+  _SpanSink sink{out, outsize};
+  escapeJSONImp(sink, s);
+  return sink.n;
+}
 
-namespace rx {
-namespace text {
+void escapeJSON(std::string& outs, View s) {
+  // Escape into room for some escapes, and again into the exact size if that wasn't enough
+  size_t n = outs.size();
+  outs.resize(n + s.size() + s.size() / 4 + 16);
+  size_t z = escapeJSON(&outs[n], outs.size() - n, s);
+  if (z > outs.size() - n) {
+    outs.resize(n + z);
+    escapeJSON(&outs[n], z, s);
+  }
+  outs.resize(n + z);
+}
 
+static inline bool parseHex4(const char* p, const char* e, u32& value) {
+  if (e - p < 4) {
+    return false;
+  }
+  value = 0;
+  for (size_t i = 0; i != 4; ++i) {
+    u32 c = (u8)p[i];
+    u32 d = (c - '0' < 10) ? c - '0' : ((c | 0x20) - 'a' < 6) ? (c | 0x20) - 'a' + 10 : 16;
+    if (d == 16) {
+      return false;
+    }
+    value = (value << 4) | d;
+  }
+  return true;
+}
 
-Text decodeUTF8(const std::string& s) {
-  Text t;
-  _utf8::utf8to32(s.cbegin(), s.cend(), std::back_inserter(t));
-  return std::move(t);
+size_t unescapeJSON(char* out, View s, size_t* invalid) {
+  const char* inI = s.begin();
+  const char* inE = s.end();
+  const char* bad = nullptr;
+  char* outI = out;
+  while (true) {
+    auto e = (const char*)memchr(inI, '\\', inE - inI);
+    if (e == nullptr) {
+      e = inE;
+    }
+    memmove(outI, inI, e - inI); // `out` may be the input
+    outI += e - inI;
+    inI = e;
+    if (inI == inE) {
+      break;
+    }
+    u32 uc = 0;
+    switch ((inE - inI < 2) ? 0 : inI[1]) {
+      case '"':  *outI++ = '"'; inI += 2; continue;
+      case '\\': *outI++ = '\\'; inI += 2; continue;
+      case '/':  *outI++ = '/'; inI += 2; continue;
+      case 'b':  *outI++ = '\b'; inI += 2; continue;
+      case 'f':  *outI++ = '\f'; inI += 2; continue;
+      case 'n':  *outI++ = '\n'; inI += 2; continue;
+      case 'r':  *outI++ = '\r'; inI += 2; continue;
+      case 't':  *outI++ = '\t'; inI += 2; continue;
+      case 'u':
+        if (!parseHex4(inI + 2, inE, uc)) {
+          break;
+        }
+        inI += 6;
+        if (uc - 0xd800 < 0x800) {
+          u32 lo;
+          if (uc < 0xdc00 && inE - inI >= 6 && inI[0] == '\\' && inI[1] == 'u' &&
+              parseHex4(inI + 2, inE, lo) && lo - 0xdc00 < 0x400) {
+            uc = 0x10000 + ((uc - 0xd800) << 10) + (lo - 0xdc00);
+            inI += 6;
+          } else {
+            uc = 0xfffd;
+          }
+        }
+        outI = _appendUTF8(outI, uc);
+        continue;
+    }
+    // Malformed escape. Copy the backslash and carry on with what follows it as normal text.
+    if (bad == nullptr) {
+      bad = inI;
+    }
+    *outI++ = *inI++;
+  }
+  if (invalid) {
+    *invalid = bad ? bad - s.begin() : s.size();
+  }
+  return outI - out;
 }
 
 
-template <typename I, typename F>
-static inline std::string mapImp(size_t initialCapacity, I inI, I inE, F fun) {
-  std::string outs;
-  outs.reserve(initialCapacity); // probably going to be the same size
-  auto outI = std::back_inserter(outs);
+enum class TrimType { L, R, LR };
+static View trimImp(TrimType trimType, View s, const CharacterSet& cs) {
+  const char* inI = s.begin();
+  const char* inE = s.end();
 
-  while (inI != inE) {
-    u32 uc = UTF8_NEXT(inI, inE);
+  // "  lol cat  "
+  //  ^          ^
+  //  +- inI     +- inE
 
-    switch (fun(uc)) {
-      case MapIgnore: {
-        // Ignore the current character.
+  if (trimType != TrimType::R) {
+    // Advance inI past leading characters in `cs`. Runs of ASCII are scanned in bulk.
+    while (inI != inE) {
+      inI += simd::spanASCIISet(inI, inE - inI, cs._asciiNibbles());
+      if (inI == inE || (u8)*inI < 0x80) {
         break;
       }
-      case MapIncludeAll: {
-        // Include the current and all remaining characters and stop iteration.
-        outI = _utf8::append(uc, outI);
-        outs.append(inI, inE);
-        goto return_outs;
-      }
-      case MapIncludeRest: {
-        // Ignore the current character, but include all remaining characters.
-        outs.append(inI, inE);
-        goto return_outs;
+      auto nextI = inI;
+      if (!cs.contains(UTF8_NEXT(nextI, inE))) {
+        break;
       }
-      case MapIgnoreAll: {
-        // Ignore the current and any remaining characters and stop iteration.
-        goto return_outs;
+      inI = nextI;
+    }
+  }
+
+  if (trimType != TrimType::L) {
+    // Move inE back past trailing characters in `cs`
+    while (inE != inI) {
+      inE -= simd::rspanASCIISet(inI, inE - inI, cs._asciiNibbles());
+      if (inE == inI || (u8)inE[-1] < 0x80) {
+        break;
       }
-      case MapIgnoreRest: {
-        // Include the current character, but ignore any remaining characters.
-        outI = _utf8::append(uc, outI);
-        goto return_outs;
+      // Find the start of the last character and decode it
+      auto startI = inE - 1;
+      while (startI != inI && utf8::internal::is_trail(*startI) && inE - startI < 4) {
+        --startI;
       }
-      default: {
-        assert(uc < _MapSpecialMin || uc > _MapSpecialMax);
-        outI = _utf8::append(uc, outI);
+      auto nextI = startI;
+      u32 uc = UTF8_NEXT(nextI, inE);
+      if (nextI != inE || !cs.contains(uc)) {
         break;
       }
+      inE = startI;
     }
   }
 
-  return_outs:
-  return std::move(outs);
+  // "  lol cat  "
+  //    ^      ^
+  //    |      +- inE
+  //    +- inI
+
+  return View{inI, (size_t)(inE - inI)};
 }
 
 
-std::string mapF(const std::string& ins, u32(*fun)(u32)) {
-  return mapImp(ins.size(), ins.begin(), ins.end(), fun);
+View rtrim(View s, const CharacterSet& cs) {
+  return trimImp(TrimType::R, s, cs);
 }
 
-std::string map(const std::string& ins, rx::func<u32(u32)> fun) {
-  return mapImp(ins.size(), ins.begin(), ins.end(), fun);
+View ltrim(View s, const CharacterSet& cs) {
+  return trimImp(TrimType::L, s, cs);
 }
 
+View trim(View s, const CharacterSet& cs) {
+  return trimImp(TrimType::LR, s, cs);
+}
 
-enum class TrimType { L, R, LR };
-std::string trimImp(TrimType trimType, const std::string& s, const CharacterSet& cs) {
-  auto inI = s.cbegin();
-  auto inE = s.cend();
-
-  // "  lol cat  "
-  // ^
-  // +- inI
-
-  decltype(inI) inFirst;
 
-  // Find first char not in `cs`
-  do {
+static const char* findDelimiter(const char* inI, const char* inE, const CharacterSet& cs,
+                                 size_t& size) {
+  // Returns the start of the first character in `cs`, and its size, or inE. Sets with only ASCII
+  // members need not look at non-ASCII characters at all.
+  bool asciiOnly = cs._asciiOnly();
+  while (inI != inE) {
+    inI += simd::findASCIISet(inI, inE - inI, cs._asciiNibbles(), !asciiOnly);
     if (inI == inE) {
-      // whole string matches cs
-      return {};
+      break;
     }
-    inFirst = inI;
-  } while (cs.contains(UTF8_NEXT(inI, inE)));
+    if ((u8)*inI < 0x80) {
+      size = 1;
+      return inI;
+    }
+    auto nextI = inI;
+    if (cs.contains(UTF8_NEXT(nextI, inE))) {
+      size = nextI - inI;
+      return inI;
+    }
+    inI = nextI;
+  }
+  size = 0;
+  return inE;
+}
 
-  if (trimType == TrimType::L) {
-    return std::string{inFirst, inE};
+
+void SplitRange::iterator::_next() {
+  while (true) {
+    if (!_delim.empty()) {
+      _token = _delim;
+      _delim = View{};
+      return;
+    }
+    if (_last) {
+      _done = true;
+      _token = View{};
+      return;
+    }
+    size_t delimSize;
+    const char* delimI = findDelimiter(_p, _e, *_cs, delimSize);
+    _token = View{_p, (size_t)(delimI - _p)};
+    _last = delimI == _e;
+    if (_options & SplitKeepDelimiters) {
+      _delim = View{delimI, delimSize};
+    }
+    _p = delimI + delimSize;
+    if (!_token.empty() || !(_options & SplitSkipEmpty)) {
+      return;
+    }
   }
+}
 
-  auto inEnd = inI;
 
-  // "  lol cat  "
-  //   ^^
-  //   |+- inI, inEnd
-  //   |
-  //   +- inFirst
+SplitRange::iterator SplitRange::begin() const {
+  iterator it{_cs, _s.begin(), _s.end(), View{}, View{}, _options, false, false};
+  it._next();
+  return it;
+}
+
+
+SplitRange split(View s, const CharacterSet& cs, u8 options) {
+  return SplitRange{s, &cs, options};
+}
+
+
+void canonicalize(View s, std::string& outs, u8 options) {
+  // A run of whitespace and controls is held back until the next character shows whether it's
+  // trailing. Members of the set fold to themselves, so a run which is kept as-is can be copied
+  // from the input. `outs` always has room for the rest of the input, which graphic ASCII never
+  // outgrows, and is grown ahead of characters whose folded version may be longer.
+  const CharacterSet& cs = WhitespaceLinebreakAndControlCharacterSet;
+  bool fold = options & CanonicalizeFold;
+  bool collapse = options & CanonicalizeCollapse;
+  bool trim = options & CanonicalizeTrim;
+  const char* inI = s.begin();
+  const char* inE = s.end();
+  const char* runI = nullptr; // start of the held back run, if any
+  const char* runE = nullptr;
+  bool leading = true;
+  outs.resize(s.size() + 4);
+  char* out = &outs[0];
+  size_t n = 0;
+
+  auto flushRun = [&]() {
+    if (!(leading && trim)) {
+      if (collapse) {
+        out[n++] = ' ';
+      } else {
+        memcpy(out + n, runI, runE - runI);
+        n += runE - runI;
+      }
+    }
+    runI = nullptr;
+  };
 
-  // Find last non-matching character
   while (inI != inE) {
-    if (!cs.contains(UTF8_NEXT(inI, inE))) {
-      inEnd = inI;
+    u8 b = (u8)*inI;
+    if (b < 0x80) {
+      if (b <= 0x20 || b == 0x7f) {
+        if (runI == nullptr) {
+          runI = inI;
+        }
+        runE = ++inI;
+        continue;
+      }
+      if (runI != nullptr) {
+        flushRun();
+      }
+      leading = false;
+      size_t k = simd::copyGraphicASCII(inI, inE - inI, out + n, fold);
+      inI += k;
+      n += k;
+      continue;
+    }
+    const char* charE = inI;
+    u32 uc = UTF8_NEXT(charE, inE);
+    if (cs.contains(uc)) {
+      if (runI == nullptr) {
+        runI = inI;
+      }
+      runE = inI = charE;
+      continue;
     }
+    if (runI != nullptr) {
+      flushRun();
+    }
+    leading = false;
+    if (outs.size() - n < (size_t)(inE - inI) + 2) {
+      outs.resize(outs.size() + (inE - inI) / 4 + 16);
+      out = &outs[0];
+    }
+    if (fold) {
+      n = _appendUTF8(out + n, normalize(uc)) - out;
+    } else {
+      memcpy(out + n, inI, charE - inI);
+      n += charE - inI;
+    }
+    inI = charE;
+  }
+  if (runI != nullptr && !trim) {
+    flushRun();
   }
+  outs.resize(n);
+}
 
-  // "  lol cat  "
-  //    ^      ^ ^
-  //    |      | +- inI == inE
-  //    |      |
-  //    |      +- inEnd
-  //    |
-  //    +- inFirst
 
-  return (trimType == TrimType::LR) ?
-    std::string{inFirst, inEnd} :
-    std::string{s.cbegin(), inEnd} ;
+bool findLinebreaks(const char* s, size_t z, rx::func<bool(const size_t*, size_t)> fun) {
+  size_t batch[256];
+  size_t i = 0;
+  while (i != z) {
+    size_t n = simd::scanLinebreaks((const u8*)s, z, i, batch, sizeof(batch) / sizeof(batch[0]));
+    if (n != 0 && !fun(batch, n)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+void findLinebreaks(const char* s, size_t z, std::vector<size_t>& offsets) {
+  size_t i = 0;
+  while (i != z) {
+    size_t n = offsets.size();
+    size_t batchSize = RX_MAX(n, (size_t)256);
+    offsets.resize(n + batchSize);
+    offsets.resize(n + simd::scanLinebreaks((const u8*)s, z, i, &offsets[n], batchSize));
+  }
 }
 
 
 std::string rtrim(const std::string& s, const CharacterSet& cs) {
-  return trimImp(TrimType::R, s, cs);
+  return trimImp(TrimType::R, s, cs).str();
 }
 
 std::string ltrim(const std::string& s, const CharacterSet& cs) {
-  return trimImp(TrimType::L, s, cs);
+  return trimImp(TrimType::L, s, cs).str();
 }
 
 std::string trim(const std::string& s, const CharacterSet& cs) {
-  return trimImp(TrimType::LR, s, cs);
+  return trimImp(TrimType::LR, s, cs).str();
+}
+
+
+CharacterSet::CharacterSet(std::initializer_list<u32> chars)
+  : _ascii{0, 0}, _bmpLeaves(4, 0) {
+  memset(_bmpIndex, 0, sizeof(_bmpIndex));
+  memset(_nibbles, 0, sizeof(_nibbles));
+  for (u32 uc : chars) {
+    insert(uc);
+  }
+}
+
+
+void CharacterSet::insert(u32 uc) {
+  if (uc < 0x80) {
+    _ascii[uc >> 6] |= (u64)1 << (uc & 63);
+    _nibbles[uc & 0xf] |= (u8)(1 << (uc >> 4));
+  } else if (uc < 0x10000) {
+    u16& leafIndex = _bmpIndex[uc >> 8];
+    if (leafIndex == 0) {
+      leafIndex = (u16)(_bmpLeaves.size() / 4);
+      _bmpLeaves.resize(_bmpLeaves.size() + 4, 0);
+    }
+    _bmpLeaves[((size_t)leafIndex * 4) + ((uc >> 6) & 3)] |= (u64)1 << (uc & 63);
+  } else {
+    // Find the first range which ends no earlier than just before `uc`
+    auto I = std::lower_bound(_astral.begin(), _astral.end(), uc,
+      [](const Range& r, u32 c) { return r.last + 1 < c; });
+    if (I == _astral.end() || I->first > uc + 1) {
+      _astral.insert(I, Range{uc, uc});
+    } else {
+      // Extend the range, and merge it with the next range if they now touch
+      I->first = std::min(I->first, uc);
+      I->last = std::max(I->last, uc);
+      auto nextI = I + 1;
+      if (nextI != _astral.end() && nextI->first <= I->last + 1) {
+        I->last = std::max(I->last, nextI->last);
+        _astral.erase(nextI);
+      }
+    }
+  }
+}
+
+
+bool CharacterSet::containsAstral(u32 uc) const {
+  // Find the last range starting at or before `uc`
+  auto I = std::upper_bound(_astral.cbegin(), _astral.cend(), uc,
+    [](u32 c, const Range& r) { return c < r.first; });
+  return I != _astral.cbegin() && (--I)->last >= uc;
+}
+
+
+void CharacterSet::_each(const rx::func<void(u32)>& fun) const {
+  for (u32 uc = 0; uc != 0x80; ++uc) {
+    if ((_ascii[uc >> 6] >> (uc & 63)) & 1) {
+      fun(uc);
+    }
+  }
+  for (u32 block = 0; block != 256; ++block) {
+    if (_bmpIndex[block] == 0) {
+      continue;
+    }
+    const u64* leaf = _bmpLeaves.data() + ((size_t)_bmpIndex[block] * 4);
+    for (u32 i = 0; i != 4; ++i) {
+      for (u64 bits = leaf[i]; bits != 0; bits &= bits - 1) {
+        fun((block << 8) | (i << 6) | (u32)__builtin_ctzll(bits));
+      }
+    }
+  }
+  for (const Range& r : _astral) {
+    for (u32 uc = r.first; uc <= r.last; ++uc) {
+      fun(uc);
+    }
+  }
+}
+
+
+const std::set<u32> CharacterSet::characters() const {
+  std::set<u32> chars;
+  _each([&](u32 c) { chars.insert(chars.end(), c); });
+  return chars;
 }
 
 
 const CharacterSet WhitespaceAndNewlineCharacterSet{' ','\t','\r','\n'};
 
 
-// Generated by text-gen.pl
+// Generated by text-gen.pl from Unicode 14.0.0 data
 const CharacterSet WhitespaceCharacterSet{
    0x0020 // SPACE
   ,0x00A0 // NO-BREAK SPACE
@@ -353,1114 +3182,6340 @@ const CharacterSet WhitespaceLinebreakAndControlCharacterSet{
   ,0x009F // APPLICATION PROGRAM COMMAND
 };
 
+static const u32 caseFoldLimit = 0x1E980;
+
+static const u8 caseFoldIndex[979] = {
+  1,2,3,4,5,0,6,7,8,9,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,11,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,14,15,16,17,
+  0,0,18,19,0,0,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,22,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,23,24,25,26,0,0,0,0,0,0,27,28,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,
+  0,0,0,0,0,0,0,0,30,31,32,33,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,
+};
+
+static const i32 caseFoldDeltas[38][128] = {
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,0,32,32,32,32,32,32,32,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    0,0,1,0,1,0,1,0,0,1,0,1,0,1,0,1,
+    0,1,0,1,0,1,0,1,0,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,-121,1,0,1,0,1,0,-268,
+  },
+  {
+    0,210,1,0,1,0,206,1,0,205,205,1,0,0,79,202,
+    203,1,0,205,207,0,211,209,1,0,0,0,211,213,0,214,
+    1,0,1,0,1,0,218,1,0,218,0,0,1,0,218,1,
+    0,217,217,1,0,1,0,219,1,0,0,0,1,0,0,0,
+    0,0,0,0,2,1,0,2,1,0,2,1,0,1,0,1,
+    0,1,0,1,0,1,0,1,0,1,0,1,0,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    0,2,1,0,1,0,-97,-56,1,0,1,0,1,0,1,0,
+  },
+  {
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    -130,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,0,0,0,0,0,0,10795,1,0,-163,10792,0,
+    0,1,0,-195,69,71,1,0,1,0,1,0,1,0,1,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,116,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,116,
+  },
+  {
+    0,0,0,0,0,0,38,0,37,37,37,0,64,0,63,63,
+    0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,0,32,32,32,32,32,32,32,32,32,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,8,
+    -30,-25,0,0,0,-15,-22,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    -54,-48,0,0,-60,-64,0,1,0,-7,1,0,0,-130,-130,-130,
+  },
+  {
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+  },
+  {
+    1,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    15,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+  },
+  {
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,48,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,
+    7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,
+    7264,7264,7264,7264,7264,7264,0,7264,0,0,0,0,0,7264,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,0,0,
+  },
+  {
+    -6222,-6221,-6212,-6210,-6210,-6211,-6204,-6180,35267,0,0,0,0,0,0,0,
+    -3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,
+    -3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,
+    -3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,0,0,-3008,-3008,-3008,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+  },
+  {
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,0,0,0,0,0,-58,0,0,-7615,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,0,0,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,0,0,
+    0,0,0,0,0,0,0,0,0,-8,0,-8,0,-8,0,-8,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+    0,0,0,0,0,0,0,0,-8,-8,-74,-74,-9,0,-7173,0,
+    0,0,0,0,0,0,0,0,-86,-86,-86,-86,-9,0,0,0,
+    0,0,0,0,0,0,0,0,-8,-8,-100,-100,0,0,0,0,
+    0,0,0,0,0,0,0,0,-8,-8,-112,-112,-7,0,0,0,
+    0,0,0,0,0,0,0,0,-128,-128,-126,-126,-9,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,-7517,0,0,0,-8383,-8262,0,0,0,0,
+    0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,-10743,-3814,-10727,0,0,1,0,1,0,1,0,-10780,-10749,-10783,
+    -10782,0,1,0,0,1,0,0,0,0,0,0,0,0,-10815,-10815,
+  },
+  {
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,0,0,0,0,0,0,0,1,0,1,0,0,
+    0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    0,0,0,0,0,0,0,0,0,1,0,1,0,-35332,1,0,
+  },
+  {
+    1,0,1,0,1,0,1,0,0,0,0,1,0,-42280,0,0,
+    1,0,1,0,0,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,-42308,-42319,-42315,-42305,-42308,0,
+    -42258,-42282,-42261,928,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,-48,-42307,-35384,1,0,1,0,0,0,0,0,0,
+    1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    -38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,
+  },
+  {
+    -38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,
+    -38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,
+    -38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,
+    -38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+    40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+    40,40,40,40,40,40,40,40,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+    40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+    40,40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    39,39,39,39,39,39,39,39,39,39,39,0,39,39,39,39,
+  },
+  {
+    39,39,39,39,39,39,39,39,39,39,39,0,39,39,39,39,
+    39,39,39,0,39,39,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+};
+
 u32 normalize(u32 uc) {
-  switch (uc) {
-    case 0x0041: return 0x0061; // LATIN CAPITAL LETTER A
-    case 0x0042: return 0x0062; // LATIN CAPITAL LETTER B
-    case 0x0043: return 0x0063; // LATIN CAPITAL LETTER C
-    case 0x0044: return 0x0064; // LATIN CAPITAL LETTER D
-    case 0x0045: return 0x0065; // LATIN CAPITAL LETTER E
-    case 0x0046: return 0x0066; // LATIN CAPITAL LETTER F
-    case 0x0047: return 0x0067; // LATIN CAPITAL LETTER G
-    case 0x0048: return 0x0068; // LATIN CAPITAL LETTER H
-    case 0x0049: return 0x0069; // LATIN CAPITAL LETTER I
-    case 0x004A: return 0x006A; // LATIN CAPITAL LETTER J
-    case 0x004B: return 0x006B; // LATIN CAPITAL LETTER K
-    case 0x004C: return 0x006C; // LATIN CAPITAL LETTER L
-    case 0x004D: return 0x006D; // LATIN CAPITAL LETTER M
-    case 0x004E: return 0x006E; // LATIN CAPITAL LETTER N
-    case 0x004F: return 0x006F; // LATIN CAPITAL LETTER O
-    case 0x0050: return 0x0070; // LATIN CAPITAL LETTER P
-    case 0x0051: return 0x0071; // LATIN CAPITAL LETTER Q
-    case 0x0052: return 0x0072; // LATIN CAPITAL LETTER R
-    case 0x0053: return 0x0073; // LATIN CAPITAL LETTER S
-    case 0x0054: return 0x0074; // LATIN CAPITAL LETTER T
-    case 0x0055: return 0x0075; // LATIN CAPITAL LETTER U
-    case 0x0056: return 0x0076; // LATIN CAPITAL LETTER V
-    case 0x0057: return 0x0077; // LATIN CAPITAL LETTER W
-    case 0x0058: return 0x0078; // LATIN CAPITAL LETTER X
-    case 0x0059: return 0x0079; // LATIN CAPITAL LETTER Y
-    case 0x005A: return 0x007A; // LATIN CAPITAL LETTER Z
-    case 0x00B5: return 0x03BC; // MICRO SIGN
-    case 0x00C0: return 0x00E0; // LATIN CAPITAL LETTER A WITH GRAVE
-    case 0x00C1: return 0x00E1; // LATIN CAPITAL LETTER A WITH ACUTE
-    case 0x00C2: return 0x00E2; // LATIN CAPITAL LETTER A WITH CIRCUMFLEX
-    case 0x00C3: return 0x00E3; // LATIN CAPITAL LETTER A WITH TILDE
-    case 0x00C4: return 0x00E4; // LATIN CAPITAL LETTER A WITH DIAERESIS
-    case 0x00C5: return 0x00E5; // LATIN CAPITAL LETTER A WITH RING ABOVE
-    case 0x00C6: return 0x00E6; // LATIN CAPITAL LETTER AE
-    case 0x00C7: return 0x00E7; // LATIN CAPITAL LETTER C WITH CEDILLA
-    case 0x00C8: return 0x00E8; // LATIN CAPITAL LETTER E WITH GRAVE
-    case 0x00C9: return 0x00E9; // LATIN CAPITAL LETTER E WITH ACUTE
-    case 0x00CA: return 0x00EA; // LATIN CAPITAL LETTER E WITH CIRCUMFLEX
-    case 0x00CB: return 0x00EB; // LATIN CAPITAL LETTER E WITH DIAERESIS
-    case 0x00CC: return 0x00EC; // LATIN CAPITAL LETTER I WITH GRAVE
-    case 0x00CD: return 0x00ED; // LATIN CAPITAL LETTER I WITH ACUTE
-    case 0x00CE: return 0x00EE; // LATIN CAPITAL LETTER I WITH CIRCUMFLEX
-    case 0x00CF: return 0x00EF; // LATIN CAPITAL LETTER I WITH DIAERESIS
-    case 0x00D0: return 0x00F0; // LATIN CAPITAL LETTER ETH
-    case 0x00D1: return 0x00F1; // LATIN CAPITAL LETTER N WITH TILDE
-    case 0x00D2: return 0x00F2; // LATIN CAPITAL LETTER O WITH GRAVE
-    case 0x00D3: return 0x00F3; // LATIN CAPITAL LETTER O WITH ACUTE
-    case 0x00D4: return 0x00F4; // LATIN CAPITAL LETTER O WITH CIRCUMFLEX
-    case 0x00D5: return 0x00F5; // LATIN CAPITAL LETTER O WITH TILDE
-    case 0x00D6: return 0x00F6; // LATIN CAPITAL LETTER O WITH DIAERESIS
-    case 0x00D8: return 0x00F8; // LATIN CAPITAL LETTER O WITH STROKE
-    case 0x00D9: return 0x00F9; // LATIN CAPITAL LETTER U WITH GRAVE
-    case 0x00DA: return 0x00FA; // LATIN CAPITAL LETTER U WITH ACUTE
-    case 0x00DB: return 0x00FB; // LATIN CAPITAL LETTER U WITH CIRCUMFLEX
-    case 0x00DC: return 0x00FC; // LATIN CAPITAL LETTER U WITH DIAERESIS
-    case 0x00DD: return 0x00FD; // LATIN CAPITAL LETTER Y WITH ACUTE
-    case 0x00DE: return 0x00FE; // LATIN CAPITAL LETTER THORN
-    case 0x0100: return 0x0101; // LATIN CAPITAL LETTER A WITH MACRON
-    case 0x0102: return 0x0103; // LATIN CAPITAL LETTER A WITH BREVE
-    case 0x0104: return 0x0105; // LATIN CAPITAL LETTER A WITH OGONEK
-    case 0x0106: return 0x0107; // LATIN CAPITAL LETTER C WITH ACUTE
-    case 0x0108: return 0x0109; // LATIN CAPITAL LETTER C WITH CIRCUMFLEX
-    case 0x010A: return 0x010B; // LATIN CAPITAL LETTER C WITH DOT ABOVE
-    case 0x010C: return 0x010D; // LATIN CAPITAL LETTER C WITH CARON
-    case 0x010E: return 0x010F; // LATIN CAPITAL LETTER D WITH CARON
-    case 0x0110: return 0x0111; // LATIN CAPITAL LETTER D WITH STROKE
-    case 0x0112: return 0x0113; // LATIN CAPITAL LETTER E WITH MACRON
-    case 0x0114: return 0x0115; // LATIN CAPITAL LETTER E WITH BREVE
-    case 0x0116: return 0x0117; // LATIN CAPITAL LETTER E WITH DOT ABOVE
-    case 0x0118: return 0x0119; // LATIN CAPITAL LETTER E WITH OGONEK
-    case 0x011A: return 0x011B; // LATIN CAPITAL LETTER E WITH CARON
-    case 0x011C: return 0x011D; // LATIN CAPITAL LETTER G WITH CIRCUMFLEX
-    case 0x011E: return 0x011F; // LATIN CAPITAL LETTER G WITH BREVE
-    case 0x0120: return 0x0121; // LATIN CAPITAL LETTER G WITH DOT ABOVE
-    case 0x0122: return 0x0123; // LATIN CAPITAL LETTER G WITH CEDILLA
-    case 0x0124: return 0x0125; // LATIN CAPITAL LETTER H WITH CIRCUMFLEX
-    case 0x0126: return 0x0127; // LATIN CAPITAL LETTER H WITH STROKE
-    case 0x0128: return 0x0129; // LATIN CAPITAL LETTER I WITH TILDE
-    case 0x012A: return 0x012B; // LATIN CAPITAL LETTER I WITH MACRON
-    case 0x012C: return 0x012D; // LATIN CAPITAL LETTER I WITH BREVE
-    case 0x012E: return 0x012F; // LATIN CAPITAL LETTER I WITH OGONEK
-    case 0x0132: return 0x0133; // LATIN CAPITAL LIGATURE IJ
-    case 0x0134: return 0x0135; // LATIN CAPITAL LETTER J WITH CIRCUMFLEX
-    case 0x0136: return 0x0137; // LATIN CAPITAL LETTER K WITH CEDILLA
-    case 0x0139: return 0x013A; // LATIN CAPITAL LETTER L WITH ACUTE
-    case 0x013B: return 0x013C; // LATIN CAPITAL LETTER L WITH CEDILLA
-    case 0x013D: return 0x013E; // LATIN CAPITAL LETTER L WITH CARON
-    case 0x013F: return 0x0140; // LATIN CAPITAL LETTER L WITH MIDDLE DOT
-    case 0x0141: return 0x0142; // LATIN CAPITAL LETTER L WITH STROKE
-    case 0x0143: return 0x0144; // LATIN CAPITAL LETTER N WITH ACUTE
-    case 0x0145: return 0x0146; // LATIN CAPITAL LETTER N WITH CEDILLA
-    case 0x0147: return 0x0148; // LATIN CAPITAL LETTER N WITH CARON
-    case 0x014A: return 0x014B; // LATIN CAPITAL LETTER ENG
-    case 0x014C: return 0x014D; // LATIN CAPITAL LETTER O WITH MACRON
-    case 0x014E: return 0x014F; // LATIN CAPITAL LETTER O WITH BREVE
-    case 0x0150: return 0x0151; // LATIN CAPITAL LETTER O WITH DOUBLE ACUTE
-    case 0x0152: return 0x0153; // LATIN CAPITAL LIGATURE OE
-    case 0x0154: return 0x0155; // LATIN CAPITAL LETTER R WITH ACUTE
-    case 0x0156: return 0x0157; // LATIN CAPITAL LETTER R WITH CEDILLA
-    case 0x0158: return 0x0159; // LATIN CAPITAL LETTER R WITH CARON
-    case 0x015A: return 0x015B; // LATIN CAPITAL LETTER S WITH ACUTE
-    case 0x015C: return 0x015D; // LATIN CAPITAL LETTER S WITH CIRCUMFLEX
-    case 0x015E: return 0x015F; // LATIN CAPITAL LETTER S WITH CEDILLA
-    case 0x0160: return 0x0161; // LATIN CAPITAL LETTER S WITH CARON
-    case 0x0162: return 0x0163; // LATIN CAPITAL LETTER T WITH CEDILLA
-    case 0x0164: return 0x0165; // LATIN CAPITAL LETTER T WITH CARON
-    case 0x0166: return 0x0167; // LATIN CAPITAL LETTER T WITH STROKE
-    case 0x0168: return 0x0169; // LATIN CAPITAL LETTER U WITH TILDE
-    case 0x016A: return 0x016B; // LATIN CAPITAL LETTER U WITH MACRON
-    case 0x016C: return 0x016D; // LATIN CAPITAL LETTER U WITH BREVE
-    case 0x016E: return 0x016F; // LATIN CAPITAL LETTER U WITH RING ABOVE
-    case 0x0170: return 0x0171; // LATIN CAPITAL LETTER U WITH DOUBLE ACUTE
-    case 0x0172: return 0x0173; // LATIN CAPITAL LETTER U WITH OGONEK
-    case 0x0174: return 0x0175; // LATIN CAPITAL LETTER W WITH CIRCUMFLEX
-    case 0x0176: return 0x0177; // LATIN CAPITAL LETTER Y WITH CIRCUMFLEX
-    case 0x0178: return 0x00FF; // LATIN CAPITAL LETTER Y WITH DIAERESIS
-    case 0x0179: return 0x017A; // LATIN CAPITAL LETTER Z WITH ACUTE
-    case 0x017B: return 0x017C; // LATIN CAPITAL LETTER Z WITH DOT ABOVE
-    case 0x017D: return 0x017E; // LATIN CAPITAL LETTER Z WITH CARON
-    case 0x017F: return 0x0073; // LATIN SMALL LETTER LONG S
-    case 0x0181: return 0x0253; // LATIN CAPITAL LETTER B WITH HOOK
-    case 0x0182: return 0x0183; // LATIN CAPITAL LETTER B WITH TOPBAR
-    case 0x0184: return 0x0185; // LATIN CAPITAL LETTER TONE SIX
-    case 0x0186: return 0x0254; // LATIN CAPITAL LETTER OPEN O
-    case 0x0187: return 0x0188; // LATIN CAPITAL LETTER C WITH HOOK
-    case 0x0189: return 0x0256; // LATIN CAPITAL LETTER AFRICAN D
-    case 0x018A: return 0x0257; // LATIN CAPITAL LETTER D WITH HOOK
-    case 0x018B: return 0x018C; // LATIN CAPITAL LETTER D WITH TOPBAR
-    case 0x018E: return 0x01DD; // LATIN CAPITAL LETTER REVERSED E
-    case 0x018F: return 0x0259; // LATIN CAPITAL LETTER SCHWA
-    case 0x0190: return 0x025B; // LATIN CAPITAL LETTER OPEN E
-    case 0x0191: return 0x0192; // LATIN CAPITAL LETTER F WITH HOOK
-    case 0x0193: return 0x0260; // LATIN CAPITAL LETTER G WITH HOOK
-    case 0x0194: return 0x0263; // LATIN CAPITAL LETTER GAMMA
-    case 0x0196: return 0x0269; // LATIN CAPITAL LETTER IOTA
-    case 0x0197: return 0x0268; // LATIN CAPITAL LETTER I WITH STROKE
-    case 0x0198: return 0x0199; // LATIN CAPITAL LETTER K WITH HOOK
-    case 0x019C: return 0x026F; // LATIN CAPITAL LETTER TURNED M
-    case 0x019D: return 0x0272; // LATIN CAPITAL LETTER N WITH LEFT HOOK
-    case 0x019F: return 0x0275; // LATIN CAPITAL LETTER O WITH MIDDLE TILDE
-    case 0x01A0: return 0x01A1; // LATIN CAPITAL LETTER O WITH HORN
-    case 0x01A2: return 0x01A3; // LATIN CAPITAL LETTER OI
-    case 0x01A4: return 0x01A5; // LATIN CAPITAL LETTER P WITH HOOK
-    case 0x01A6: return 0x0280; // LATIN LETTER YR
-    case 0x01A7: return 0x01A8; // LATIN CAPITAL LETTER TONE TWO
-    case 0x01A9: return 0x0283; // LATIN CAPITAL LETTER ESH
-    case 0x01AC: return 0x01AD; // LATIN CAPITAL LETTER T WITH HOOK
-    case 0x01AE: return 0x0288; // LATIN CAPITAL LETTER T WITH RETROFLEX HOOK
-    case 0x01AF: return 0x01B0; // LATIN CAPITAL LETTER U WITH HORN
-    case 0x01B1: return 0x028A; // LATIN CAPITAL LETTER UPSILON
-    case 0x01B2: return 0x028B; // LATIN CAPITAL LETTER V WITH HOOK
-    case 0x01B3: return 0x01B4; // LATIN CAPITAL LETTER Y WITH HOOK
-    case 0x01B5: return 0x01B6; // LATIN CAPITAL LETTER Z WITH STROKE
-    case 0x01B7: return 0x0292; // LATIN CAPITAL LETTER EZH
-    case 0x01B8: return 0x01B9; // LATIN CAPITAL LETTER EZH REVERSED
-    case 0x01BC: return 0x01BD; // LATIN CAPITAL LETTER TONE FIVE
-    case 0x01C4: return 0x01C6; // LATIN CAPITAL LETTER DZ WITH CARON
-    case 0x01C5: return 0x01C6; // LATIN CAPITAL LETTER D WITH SMALL LETTER Z WITH CARON
-    case 0x01C7: return 0x01C9; // LATIN CAPITAL LETTER LJ
-    case 0x01C8: return 0x01C9; // LATIN CAPITAL LETTER L WITH SMALL LETTER J
-    case 0x01CA: return 0x01CC; // LATIN CAPITAL LETTER NJ
-    case 0x01CB: return 0x01CC; // LATIN CAPITAL LETTER N WITH SMALL LETTER J
-    case 0x01CD: return 0x01CE; // LATIN CAPITAL LETTER A WITH CARON
-    case 0x01CF: return 0x01D0; // LATIN CAPITAL LETTER I WITH CARON
-    case 0x01D1: return 0x01D2; // LATIN CAPITAL LETTER O WITH CARON
-    case 0x01D3: return 0x01D4; // LATIN CAPITAL LETTER U WITH CARON
-    case 0x01D5: return 0x01D6; // LATIN CAPITAL LETTER U WITH DIAERESIS AND MACRON
-    case 0x01D7: return 0x01D8; // LATIN CAPITAL LETTER U WITH DIAERESIS AND ACUTE
-    case 0x01D9: return 0x01DA; // LATIN CAPITAL LETTER U WITH DIAERESIS AND CARON
-    case 0x01DB: return 0x01DC; // LATIN CAPITAL LETTER U WITH DIAERESIS AND GRAVE
-    case 0x01DE: return 0x01DF; // LATIN CAPITAL LETTER A WITH DIAERESIS AND MACRON
-    case 0x01E0: return 0x01E1; // LATIN CAPITAL LETTER A WITH DOT ABOVE AND MACRON
-    case 0x01E2: return 0x01E3; // LATIN CAPITAL LETTER AE WITH MACRON
-    case 0x01E4: return 0x01E5; // LATIN CAPITAL LETTER G WITH STROKE
-    case 0x01E6: return 0x01E7; // LATIN CAPITAL LETTER G WITH CARON
-    case 0x01E8: return 0x01E9; // LATIN CAPITAL LETTER K WITH CARON
-    case 0x01EA: return 0x01EB; // LATIN CAPITAL LETTER O WITH OGONEK
-    case 0x01EC: return 0x01ED; // LATIN CAPITAL LETTER O WITH OGONEK AND MACRON
-    case 0x01EE: return 0x01EF; // LATIN CAPITAL LETTER EZH WITH CARON
-    case 0x01F1: return 0x01F3; // LATIN CAPITAL LETTER DZ
-    case 0x01F2: return 0x01F3; // LATIN CAPITAL LETTER D WITH SMALL LETTER Z
-    case 0x01F4: return 0x01F5; // LATIN CAPITAL LETTER G WITH ACUTE
-    case 0x01F6: return 0x0195; // LATIN CAPITAL LETTER HWAIR
-    case 0x01F7: return 0x01BF; // LATIN CAPITAL LETTER WYNN
-    case 0x01F8: return 0x01F9; // LATIN CAPITAL LETTER N WITH GRAVE
-    case 0x01FA: return 0x01FB; // LATIN CAPITAL LETTER A WITH RING ABOVE AND ACUTE
-    case 0x01FC: return 0x01FD; // LATIN CAPITAL LETTER AE WITH ACUTE
-    case 0x01FE: return 0x01FF; // LATIN CAPITAL LETTER O WITH STROKE AND ACUTE
-    case 0x0200: return 0x0201; // LATIN CAPITAL LETTER A WITH DOUBLE GRAVE
-    case 0x0202: return 0x0203; // LATIN CAPITAL LETTER A WITH INVERTED BREVE
-    case 0x0204: return 0x0205; // LATIN CAPITAL LETTER E WITH DOUBLE GRAVE
-    case 0x0206: return 0x0207; // LATIN CAPITAL LETTER E WITH INVERTED BREVE
-    case 0x0208: return 0x0209; // LATIN CAPITAL LETTER I WITH DOUBLE GRAVE
-    case 0x020A: return 0x020B; // LATIN CAPITAL LETTER I WITH INVERTED BREVE
-    case 0x020C: return 0x020D; // LATIN CAPITAL LETTER O WITH DOUBLE GRAVE
-    case 0x020E: return 0x020F; // LATIN CAPITAL LETTER O WITH INVERTED BREVE
-    case 0x0210: return 0x0211; // LATIN CAPITAL LETTER R WITH DOUBLE GRAVE
-    case 0x0212: return 0x0213; // LATIN CAPITAL LETTER R WITH INVERTED BREVE
-    case 0x0214: return 0x0215; // LATIN CAPITAL LETTER U WITH DOUBLE GRAVE
-    case 0x0216: return 0x0217; // LATIN CAPITAL LETTER U WITH INVERTED BREVE
-    case 0x0218: return 0x0219; // LATIN CAPITAL LETTER S WITH COMMA BELOW
-    case 0x021A: return 0x021B; // LATIN CAPITAL LETTER T WITH COMMA BELOW
-    case 0x021C: return 0x021D; // LATIN CAPITAL LETTER YOGH
-    case 0x021E: return 0x021F; // LATIN CAPITAL LETTER H WITH CARON
-    case 0x0220: return 0x019E; // LATIN CAPITAL LETTER N WITH LONG RIGHT LEG
-    case 0x0222: return 0x0223; // LATIN CAPITAL LETTER OU
-    case 0x0224: return 0x0225; // LATIN CAPITAL LETTER Z WITH HOOK
-    case 0x0226: return 0x0227; // LATIN CAPITAL LETTER A WITH DOT ABOVE
-    case 0x0228: return 0x0229; // LATIN CAPITAL LETTER E WITH CEDILLA
-    case 0x022A: return 0x022B; // LATIN CAPITAL LETTER O WITH DIAERESIS AND MACRON
-    case 0x022C: return 0x022D; // LATIN CAPITAL LETTER O WITH TILDE AND MACRON
-    case 0x022E: return 0x022F; // LATIN CAPITAL LETTER O WITH DOT ABOVE
-    case 0x0230: return 0x0231; // LATIN CAPITAL LETTER O WITH DOT ABOVE AND MACRON
-    case 0x0232: return 0x0233; // LATIN CAPITAL LETTER Y WITH MACRON
-    case 0x023A: return 0x2C65; // LATIN CAPITAL LETTER A WITH STROKE
-    case 0x023B: return 0x023C; // LATIN CAPITAL LETTER C WITH STROKE
-    case 0x023D: return 0x019A; // LATIN CAPITAL LETTER L WITH BAR
-    case 0x023E: return 0x2C66; // LATIN CAPITAL LETTER T WITH DIAGONAL STROKE
-    case 0x0241: return 0x0242; // LATIN CAPITAL LETTER GLOTTAL STOP
-    case 0x0243: return 0x0180; // LATIN CAPITAL LETTER B WITH STROKE
-    case 0x0244: return 0x0289; // LATIN CAPITAL LETTER U BAR
-    case 0x0245: return 0x028C; // LATIN CAPITAL LETTER TURNED V
-    case 0x0246: return 0x0247; // LATIN CAPITAL LETTER E WITH STROKE
-    case 0x0248: return 0x0249; // LATIN CAPITAL LETTER J WITH STROKE
-    case 0x024A: return 0x024B; // LATIN CAPITAL LETTER SMALL Q WITH HOOK TAIL
-    case 0x024C: return 0x024D; // LATIN CAPITAL LETTER R WITH STROKE
-    case 0x024E: return 0x024F; // LATIN CAPITAL LETTER Y WITH STROKE
-    case 0x0345: return 0x03B9; // COMBINING GREEK YPOGEGRAMMENI
-    case 0x0370: return 0x0371; // GREEK CAPITAL LETTER HETA
-    case 0x0372: return 0x0373; // GREEK CAPITAL LETTER ARCHAIC SAMPI
-    case 0x0376: return 0x0377; // GREEK CAPITAL LETTER PAMPHYLIAN DIGAMMA
-    case 0x037F: return 0x03F3; // GREEK CAPITAL LETTER YOT
-    case 0x0386: return 0x03AC; // GREEK CAPITAL LETTER ALPHA WITH TONOS
-    case 0x0388: return 0x03AD; // GREEK CAPITAL LETTER EPSILON WITH TONOS
-    case 0x0389: return 0x03AE; // GREEK CAPITAL LETTER ETA WITH TONOS
-    case 0x038A: return 0x03AF; // GREEK CAPITAL LETTER IOTA WITH TONOS
-    case 0x038C: return 0x03CC; // GREEK CAPITAL LETTER OMICRON WITH TONOS
-    case 0x038E: return 0x03CD; // GREEK CAPITAL LETTER UPSILON WITH TONOS
-    case 0x038F: return 0x03CE; // GREEK CAPITAL LETTER OMEGA WITH TONOS
-    case 0x0391: return 0x03B1; // GREEK CAPITAL LETTER ALPHA
-    case 0x0392: return 0x03B2; // GREEK CAPITAL LETTER BETA
-    case 0x0393: return 0x03B3; // GREEK CAPITAL LETTER GAMMA
-    case 0x0394: return 0x03B4; // GREEK CAPITAL LETTER DELTA
-    case 0x0395: return 0x03B5; // GREEK CAPITAL LETTER EPSILON
-    case 0x0396: return 0x03B6; // GREEK CAPITAL LETTER ZETA
-    case 0x0397: return 0x03B7; // GREEK CAPITAL LETTER ETA
-    case 0x0398: return 0x03B8; // GREEK CAPITAL LETTER THETA
-    case 0x0399: return 0x03B9; // GREEK CAPITAL LETTER IOTA
-    case 0x039A: return 0x03BA; // GREEK CAPITAL LETTER KAPPA
-    case 0x039B: return 0x03BB; // GREEK CAPITAL LETTER LAMDA
-    case 0x039C: return 0x03BC; // GREEK CAPITAL LETTER MU
-    case 0x039D: return 0x03BD; // GREEK CAPITAL LETTER NU
-    case 0x039E: return 0x03BE; // GREEK CAPITAL LETTER XI
-    case 0x039F: return 0x03BF; // GREEK CAPITAL LETTER OMICRON
-    case 0x03A0: return 0x03C0; // GREEK CAPITAL LETTER PI
-    case 0x03A1: return 0x03C1; // GREEK CAPITAL LETTER RHO
-    case 0x03A3: return 0x03C3; // GREEK CAPITAL LETTER SIGMA
-    case 0x03A4: return 0x03C4; // GREEK CAPITAL LETTER TAU
-    case 0x03A5: return 0x03C5; // GREEK CAPITAL LETTER UPSILON
-    case 0x03A6: return 0x03C6; // GREEK CAPITAL LETTER PHI
-    case 0x03A7: return 0x03C7; // GREEK CAPITAL LETTER CHI
-    case 0x03A8: return 0x03C8; // GREEK CAPITAL LETTER PSI
-    case 0x03A9: return 0x03C9; // GREEK CAPITAL LETTER OMEGA
-    case 0x03AA: return 0x03CA; // GREEK CAPITAL LETTER IOTA WITH DIALYTIKA
-    case 0x03AB: return 0x03CB; // GREEK CAPITAL LETTER UPSILON WITH DIALYTIKA
-    case 0x03C2: return 0x03C3; // GREEK SMALL LETTER FINAL SIGMA
-    case 0x03CF: return 0x03D7; // GREEK CAPITAL KAI SYMBOL
-    case 0x03D0: return 0x03B2; // GREEK BETA SYMBOL
-    case 0x03D1: return 0x03B8; // GREEK THETA SYMBOL
-    case 0x03D5: return 0x03C6; // GREEK PHI SYMBOL
-    case 0x03D6: return 0x03C0; // GREEK PI SYMBOL
-    case 0x03D8: return 0x03D9; // GREEK LETTER ARCHAIC KOPPA
-    case 0x03DA: return 0x03DB; // GREEK LETTER STIGMA
-    case 0x03DC: return 0x03DD; // GREEK LETTER DIGAMMA
-    case 0x03DE: return 0x03DF; // GREEK LETTER KOPPA
-    case 0x03E0: return 0x03E1; // GREEK LETTER SAMPI
-    case 0x03E2: return 0x03E3; // COPTIC CAPITAL LETTER SHEI
-    case 0x03E4: return 0x03E5; // COPTIC CAPITAL LETTER FEI
-    case 0x03E6: return 0x03E7; // COPTIC CAPITAL LETTER KHEI
-    case 0x03E8: return 0x03E9; // COPTIC CAPITAL LETTER HORI
-    case 0x03EA: return 0x03EB; // COPTIC CAPITAL LETTER GANGIA
-    case 0x03EC: return 0x03ED; // COPTIC CAPITAL LETTER SHIMA
-    case 0x03EE: return 0x03EF; // COPTIC CAPITAL LETTER DEI
-    case 0x03F0: return 0x03BA; // GREEK KAPPA SYMBOL
-    case 0x03F1: return 0x03C1; // GREEK RHO SYMBOL
-    case 0x03F4: return 0x03B8; // GREEK CAPITAL THETA SYMBOL
-    case 0x03F5: return 0x03B5; // GREEK LUNATE EPSILON SYMBOL
-    case 0x03F7: return 0x03F8; // GREEK CAPITAL LETTER SHO
-    case 0x03F9: return 0x03F2; // GREEK CAPITAL LUNATE SIGMA SYMBOL
-    case 0x03FA: return 0x03FB; // GREEK CAPITAL LETTER SAN
-    case 0x03FD: return 0x037B; // GREEK CAPITAL REVERSED LUNATE SIGMA SYMBOL
-    case 0x03FE: return 0x037C; // GREEK CAPITAL DOTTED LUNATE SIGMA SYMBOL
-    case 0x03FF: return 0x037D; // GREEK CAPITAL REVERSED DOTTED LUNATE SIGMA SYMBOL
-    case 0x0400: return 0x0450; // CYRILLIC CAPITAL LETTER IE WITH GRAVE
-    case 0x0401: return 0x0451; // CYRILLIC CAPITAL LETTER IO
-    case 0x0402: return 0x0452; // CYRILLIC CAPITAL LETTER DJE
-    case 0x0403: return 0x0453; // CYRILLIC CAPITAL LETTER GJE
-    case 0x0404: return 0x0454; // CYRILLIC CAPITAL LETTER UKRAINIAN IE
-    case 0x0405: return 0x0455; // CYRILLIC CAPITAL LETTER DZE
-    case 0x0406: return 0x0456; // CYRILLIC CAPITAL LETTER BYELORUSSIAN-UKRAINIAN I
-    case 0x0407: return 0x0457; // CYRILLIC CAPITAL LETTER YI
-    case 0x0408: return 0x0458; // CYRILLIC CAPITAL LETTER JE
-    case 0x0409: return 0x0459; // CYRILLIC CAPITAL LETTER LJE
-    case 0x040A: return 0x045A; // CYRILLIC CAPITAL LETTER NJE
-    case 0x040B: return 0x045B; // CYRILLIC CAPITAL LETTER TSHE
-    case 0x040C: return 0x045C; // CYRILLIC CAPITAL LETTER KJE
-    case 0x040D: return 0x045D; // CYRILLIC CAPITAL LETTER I WITH GRAVE
-    case 0x040E: return 0x045E; // CYRILLIC CAPITAL LETTER SHORT U
-    case 0x040F: return 0x045F; // CYRILLIC CAPITAL LETTER DZHE
-    case 0x0410: return 0x0430; // CYRILLIC CAPITAL LETTER A
-    case 0x0411: return 0x0431; // CYRILLIC CAPITAL LETTER BE
-    case 0x0412: return 0x0432; // CYRILLIC CAPITAL LETTER VE
-    case 0x0413: return 0x0433; // CYRILLIC CAPITAL LETTER GHE
-    case 0x0414: return 0x0434; // CYRILLIC CAPITAL LETTER DE
-    case 0x0415: return 0x0435; // CYRILLIC CAPITAL LETTER IE
-    case 0x0416: return 0x0436; // CYRILLIC CAPITAL LETTER ZHE
-    case 0x0417: return 0x0437; // CYRILLIC CAPITAL LETTER ZE
-    case 0x0418: return 0x0438; // CYRILLIC CAPITAL LETTER I
-    case 0x0419: return 0x0439; // CYRILLIC CAPITAL LETTER SHORT I
-    case 0x041A: return 0x043A; // CYRILLIC CAPITAL LETTER KA
-    case 0x041B: return 0x043B; // CYRILLIC CAPITAL LETTER EL
-    case 0x041C: return 0x043C; // CYRILLIC CAPITAL LETTER EM
-    case 0x041D: return 0x043D; // CYRILLIC CAPITAL LETTER EN
-    case 0x041E: return 0x043E; // CYRILLIC CAPITAL LETTER O
-    case 0x041F: return 0x043F; // CYRILLIC CAPITAL LETTER PE
-    case 0x0420: return 0x0440; // CYRILLIC CAPITAL LETTER ER
-    case 0x0421: return 0x0441; // CYRILLIC CAPITAL LETTER ES
-    case 0x0422: return 0x0442; // CYRILLIC CAPITAL LETTER TE
-    case 0x0423: return 0x0443; // CYRILLIC CAPITAL LETTER U
-    case 0x0424: return 0x0444; // CYRILLIC CAPITAL LETTER EF
-    case 0x0425: return 0x0445; // CYRILLIC CAPITAL LETTER HA
-    case 0x0426: return 0x0446; // CYRILLIC CAPITAL LETTER TSE
-    case 0x0427: return 0x0447; // CYRILLIC CAPITAL LETTER CHE
-    case 0x0428: return 0x0448; // CYRILLIC CAPITAL LETTER SHA
-    case 0x0429: return 0x0449; // CYRILLIC CAPITAL LETTER SHCHA
-    case 0x042A: return 0x044A; // CYRILLIC CAPITAL LETTER HARD SIGN
-    case 0x042B: return 0x044B; // CYRILLIC CAPITAL LETTER YERU
-    case 0x042C: return 0x044C; // CYRILLIC CAPITAL LETTER SOFT SIGN
-    case 0x042D: return 0x044D; // CYRILLIC CAPITAL LETTER E
-    case 0x042E: return 0x044E; // CYRILLIC CAPITAL LETTER YU
-    case 0x042F: return 0x044F; // CYRILLIC CAPITAL LETTER YA
-    case 0x0460: return 0x0461; // CYRILLIC CAPITAL LETTER OMEGA
-    case 0x0462: return 0x0463; // CYRILLIC CAPITAL LETTER YAT
-    case 0x0464: return 0x0465; // CYRILLIC CAPITAL LETTER IOTIFIED E
-    case 0x0466: return 0x0467; // CYRILLIC CAPITAL LETTER LITTLE YUS
-    case 0x0468: return 0x0469; // CYRILLIC CAPITAL LETTER IOTIFIED LITTLE YUS
-    case 0x046A: return 0x046B; // CYRILLIC CAPITAL LETTER BIG YUS
-    case 0x046C: return 0x046D; // CYRILLIC CAPITAL LETTER IOTIFIED BIG YUS
-    case 0x046E: return 0x046F; // CYRILLIC CAPITAL LETTER KSI
-    case 0x0470: return 0x0471; // CYRILLIC CAPITAL LETTER PSI
-    case 0x0472: return 0x0473; // CYRILLIC CAPITAL LETTER FITA
-    case 0x0474: return 0x0475; // CYRILLIC CAPITAL LETTER IZHITSA
-    case 0x0476: return 0x0477; // CYRILLIC CAPITAL LETTER IZHITSA WITH DOUBLE GRAVE ACCENT
-    case 0x0478: return 0x0479; // CYRILLIC CAPITAL LETTER UK
-    case 0x047A: return 0x047B; // CYRILLIC CAPITAL LETTER ROUND OMEGA
-    case 0x047C: return 0x047D; // CYRILLIC CAPITAL LETTER OMEGA WITH TITLO
-    case 0x047E: return 0x047F; // CYRILLIC CAPITAL LETTER OT
-    case 0x0480: return 0x0481; // CYRILLIC CAPITAL LETTER KOPPA
-    case 0x048A: return 0x048B; // CYRILLIC CAPITAL LETTER SHORT I WITH TAIL
-    case 0x048C: return 0x048D; // CYRILLIC CAPITAL LETTER SEMISOFT SIGN
-    case 0x048E: return 0x048F; // CYRILLIC CAPITAL LETTER ER WITH TICK
-    case 0x0490: return 0x0491; // CYRILLIC CAPITAL LETTER GHE WITH UPTURN
-    case 0x0492: return 0x0493; // CYRILLIC CAPITAL LETTER GHE WITH STROKE
-    case 0x0494: return 0x0495; // CYRILLIC CAPITAL LETTER GHE WITH MIDDLE HOOK
-    case 0x0496: return 0x0497; // CYRILLIC CAPITAL LETTER ZHE WITH DESCENDER
-    case 0x0498: return 0x0499; // CYRILLIC CAPITAL LETTER ZE WITH DESCENDER
-    case 0x049A: return 0x049B; // CYRILLIC CAPITAL LETTER KA WITH DESCENDER
-    case 0x049C: return 0x049D; // CYRILLIC CAPITAL LETTER KA WITH VERTICAL STROKE
-    case 0x049E: return 0x049F; // CYRILLIC CAPITAL LETTER KA WITH STROKE
-    case 0x04A0: return 0x04A1; // CYRILLIC CAPITAL LETTER BASHKIR KA
-    case 0x04A2: return 0x04A3; // CYRILLIC CAPITAL LETTER EN WITH DESCENDER
-    case 0x04A4: return 0x04A5; // CYRILLIC CAPITAL LIGATURE EN GHE
-    case 0x04A6: return 0x04A7; // CYRILLIC CAPITAL LETTER PE WITH MIDDLE HOOK
-    case 0x04A8: return 0x04A9; // CYRILLIC CAPITAL LETTER ABKHASIAN HA
-    case 0x04AA: return 0x04AB; // CYRILLIC CAPITAL LETTER ES WITH DESCENDER
-    case 0x04AC: return 0x04AD; // CYRILLIC CAPITAL LETTER TE WITH DESCENDER
-    case 0x04AE: return 0x04AF; // CYRILLIC CAPITAL LETTER STRAIGHT U
-    case 0x04B0: return 0x04B1; // CYRILLIC CAPITAL LETTER STRAIGHT U WITH STROKE
-    case 0x04B2: return 0x04B3; // CYRILLIC CAPITAL LETTER HA WITH DESCENDER
-    case 0x04B4: return 0x04B5; // CYRILLIC CAPITAL LIGATURE TE TSE
-    case 0x04B6: return 0x04B7; // CYRILLIC CAPITAL LETTER CHE WITH DESCENDER
-    case 0x04B8: return 0x04B9; // CYRILLIC CAPITAL LETTER CHE WITH VERTICAL STROKE
-    case 0x04BA: return 0x04BB; // CYRILLIC CAPITAL LETTER SHHA
-    case 0x04BC: return 0x04BD; // CYRILLIC CAPITAL LETTER ABKHASIAN CHE
-    case 0x04BE: return 0x04BF; // CYRILLIC CAPITAL LETTER ABKHASIAN CHE WITH DESCENDER
-    case 0x04C0: return 0x04CF; // CYRILLIC LETTER PALOCHKA
-    case 0x04C1: return 0x04C2; // CYRILLIC CAPITAL LETTER ZHE WITH BREVE
-    case 0x04C3: return 0x04C4; // CYRILLIC CAPITAL LETTER KA WITH HOOK
-    case 0x04C5: return 0x04C6; // CYRILLIC CAPITAL LETTER EL WITH TAIL
-    case 0x04C7: return 0x04C8; // CYRILLIC CAPITAL LETTER EN WITH HOOK
-    case 0x04C9: return 0x04CA; // CYRILLIC CAPITAL LETTER EN WITH TAIL
-    case 0x04CB: return 0x04CC; // CYRILLIC CAPITAL LETTER KHAKASSIAN CHE
-    case 0x04CD: return 0x04CE; // CYRILLIC CAPITAL LETTER EM WITH TAIL
-    case 0x04D0: return 0x04D1; // CYRILLIC CAPITAL LETTER A WITH BREVE
-    case 0x04D2: return 0x04D3; // CYRILLIC CAPITAL LETTER A WITH DIAERESIS
-    case 0x04D4: return 0x04D5; // CYRILLIC CAPITAL LIGATURE A IE
-    case 0x04D6: return 0x04D7; // CYRILLIC CAPITAL LETTER IE WITH BREVE
-    case 0x04D8: return 0x04D9; // CYRILLIC CAPITAL LETTER SCHWA
-    case 0x04DA: return 0x04DB; // CYRILLIC CAPITAL LETTER SCHWA WITH DIAERESIS
-    case 0x04DC: return 0x04DD; // CYRILLIC CAPITAL LETTER ZHE WITH DIAERESIS
-    case 0x04DE: return 0x04DF; // CYRILLIC CAPITAL LETTER ZE WITH DIAERESIS
-    case 0x04E0: return 0x04E1; // CYRILLIC CAPITAL LETTER ABKHASIAN DZE
-    case 0x04E2: return 0x04E3; // CYRILLIC CAPITAL LETTER I WITH MACRON
-    case 0x04E4: return 0x04E5; // CYRILLIC CAPITAL LETTER I WITH DIAERESIS
-    case 0x04E6: return 0x04E7; // CYRILLIC CAPITAL LETTER O WITH DIAERESIS
-    case 0x04E8: return 0x04E9; // CYRILLIC CAPITAL LETTER BARRED O
-    case 0x04EA: return 0x04EB; // CYRILLIC CAPITAL LETTER BARRED O WITH DIAERESIS
-    case 0x04EC: return 0x04ED; // CYRILLIC CAPITAL LETTER E WITH DIAERESIS
-    case 0x04EE: return 0x04EF; // CYRILLIC CAPITAL LETTER U WITH MACRON
-    case 0x04F0: return 0x04F1; // CYRILLIC CAPITAL LETTER U WITH DIAERESIS
-    case 0x04F2: return 0x04F3; // CYRILLIC CAPITAL LETTER U WITH DOUBLE ACUTE
-    case 0x04F4: return 0x04F5; // CYRILLIC CAPITAL LETTER CHE WITH DIAERESIS
-    case 0x04F6: return 0x04F7; // CYRILLIC CAPITAL LETTER GHE WITH DESCENDER
-    case 0x04F8: return 0x04F9; // CYRILLIC CAPITAL LETTER YERU WITH DIAERESIS
-    case 0x04FA: return 0x04FB; // CYRILLIC CAPITAL LETTER GHE WITH STROKE AND HOOK
-    case 0x04FC: return 0x04FD; // CYRILLIC CAPITAL LETTER HA WITH HOOK
-    case 0x04FE: return 0x04FF; // CYRILLIC CAPITAL LETTER HA WITH STROKE
-    case 0x0500: return 0x0501; // CYRILLIC CAPITAL LETTER KOMI DE
-    case 0x0502: return 0x0503; // CYRILLIC CAPITAL LETTER KOMI DJE
-    case 0x0504: return 0x0505; // CYRILLIC CAPITAL LETTER KOMI ZJE
-    case 0x0506: return 0x0507; // CYRILLIC CAPITAL LETTER KOMI DZJE
-    case 0x0508: return 0x0509; // CYRILLIC CAPITAL LETTER KOMI LJE
-    case 0x050A: return 0x050B; // CYRILLIC CAPITAL LETTER KOMI NJE
-    case 0x050C: return 0x050D; // CYRILLIC CAPITAL LETTER KOMI SJE
-    case 0x050E: return 0x050F; // CYRILLIC CAPITAL LETTER KOMI TJE
-    case 0x0510: return 0x0511; // CYRILLIC CAPITAL LETTER REVERSED ZE
-    case 0x0512: return 0x0513; // CYRILLIC CAPITAL LETTER EL WITH HOOK
-    case 0x0514: return 0x0515; // CYRILLIC CAPITAL LETTER LHA
-    case 0x0516: return 0x0517; // CYRILLIC CAPITAL LETTER RHA
-    case 0x0518: return 0x0519; // CYRILLIC CAPITAL LETTER YAE
-    case 0x051A: return 0x051B; // CYRILLIC CAPITAL LETTER QA
-    case 0x051C: return 0x051D; // CYRILLIC CAPITAL LETTER WE
-    case 0x051E: return 0x051F; // CYRILLIC CAPITAL LETTER ALEUT KA
-    case 0x0520: return 0x0521; // CYRILLIC CAPITAL LETTER EL WITH MIDDLE HOOK
-    case 0x0522: return 0x0523; // CYRILLIC CAPITAL LETTER EN WITH MIDDLE HOOK
-    case 0x0524: return 0x0525; // CYRILLIC CAPITAL LETTER PE WITH DESCENDER
-    case 0x0526: return 0x0527; // CYRILLIC CAPITAL LETTER SHHA WITH DESCENDER
-    case 0x0528: return 0x0529; // CYRILLIC CAPITAL LETTER EN WITH LEFT HOOK
-    case 0x052A: return 0x052B; // CYRILLIC CAPITAL LETTER DZZHE
-    case 0x052C: return 0x052D; // CYRILLIC CAPITAL LETTER DCHE
-    case 0x052E: return 0x052F; // CYRILLIC CAPITAL LETTER EL WITH DESCENDER
-    case 0x0531: return 0x0561; // ARMENIAN CAPITAL LETTER AYB
-    case 0x0532: return 0x0562; // ARMENIAN CAPITAL LETTER BEN
-    case 0x0533: return 0x0563; // ARMENIAN CAPITAL LETTER GIM
-    case 0x0534: return 0x0564; // ARMENIAN CAPITAL LETTER DA
-    case 0x0535: return 0x0565; // ARMENIAN CAPITAL LETTER ECH
-    case 0x0536: return 0x0566; // ARMENIAN CAPITAL LETTER ZA
-    case 0x0537: return 0x0567; // ARMENIAN CAPITAL LETTER EH
-    case 0x0538: return 0x0568; // ARMENIAN CAPITAL LETTER ET
-    case 0x0539: return 0x0569; // ARMENIAN CAPITAL LETTER TO
-    case 0x053A: return 0x056A; // ARMENIAN CAPITAL LETTER ZHE
-    case 0x053B: return 0x056B; // ARMENIAN CAPITAL LETTER INI
-    case 0x053C: return 0x056C; // ARMENIAN CAPITAL LETTER LIWN
-    case 0x053D: return 0x056D; // ARMENIAN CAPITAL LETTER XEH
-    case 0x053E: return 0x056E; // ARMENIAN CAPITAL LETTER CA
-    case 0x053F: return 0x056F; // ARMENIAN CAPITAL LETTER KEN
-    case 0x0540: return 0x0570; // ARMENIAN CAPITAL LETTER HO
-    case 0x0541: return 0x0571; // ARMENIAN CAPITAL LETTER JA
-    case 0x0542: return 0x0572; // ARMENIAN CAPITAL LETTER GHAD
-    case 0x0543: return 0x0573; // ARMENIAN CAPITAL LETTER CHEH
-    case 0x0544: return 0x0574; // ARMENIAN CAPITAL LETTER MEN
-    case 0x0545: return 0x0575; // ARMENIAN CAPITAL LETTER YI
-    case 0x0546: return 0x0576; // ARMENIAN CAPITAL LETTER NOW
-    case 0x0547: return 0x0577; // ARMENIAN CAPITAL LETTER SHA
-    case 0x0548: return 0x0578; // ARMENIAN CAPITAL LETTER VO
-    case 0x0549: return 0x0579; // ARMENIAN CAPITAL LETTER CHA
-    case 0x054A: return 0x057A; // ARMENIAN CAPITAL LETTER PEH
-    case 0x054B: return 0x057B; // ARMENIAN CAPITAL LETTER JHEH
-    case 0x054C: return 0x057C; // ARMENIAN CAPITAL LETTER RA
-    case 0x054D: return 0x057D; // ARMENIAN CAPITAL LETTER SEH
-    case 0x054E: return 0x057E; // ARMENIAN CAPITAL LETTER VEW
-    case 0x054F: return 0x057F; // ARMENIAN CAPITAL LETTER TIWN
-    case 0x0550: return 0x0580; // ARMENIAN CAPITAL LETTER REH
-    case 0x0551: return 0x0581; // ARMENIAN CAPITAL LETTER CO
-    case 0x0552: return 0x0582; // ARMENIAN CAPITAL LETTER YIWN
-    case 0x0553: return 0x0583; // ARMENIAN CAPITAL LETTER PIWR
-    case 0x0554: return 0x0584; // ARMENIAN CAPITAL LETTER KEH
-    case 0x0555: return 0x0585; // ARMENIAN CAPITAL LETTER OH
-    case 0x0556: return 0x0586; // ARMENIAN CAPITAL LETTER FEH
-    case 0x10A0: return 0x2D00; // GEORGIAN CAPITAL LETTER AN
-    case 0x10A1: return 0x2D01; // GEORGIAN CAPITAL LETTER BAN
-    case 0x10A2: return 0x2D02; // GEORGIAN CAPITAL LETTER GAN
-    case 0x10A3: return 0x2D03; // GEORGIAN CAPITAL LETTER DON
-    case 0x10A4: return 0x2D04; // GEORGIAN CAPITAL LETTER EN
-    case 0x10A5: return 0x2D05; // GEORGIAN CAPITAL LETTER VIN
-    case 0x10A6: return 0x2D06; // GEORGIAN CAPITAL LETTER ZEN
-    case 0x10A7: return 0x2D07; // GEORGIAN CAPITAL LETTER TAN
-    case 0x10A8: return 0x2D08; // GEORGIAN CAPITAL LETTER IN
-    case 0x10A9: return 0x2D09; // GEORGIAN CAPITAL LETTER KAN
-    case 0x10AA: return 0x2D0A; // GEORGIAN CAPITAL LETTER LAS
-    case 0x10AB: return 0x2D0B; // GEORGIAN CAPITAL LETTER MAN
-    case 0x10AC: return 0x2D0C; // GEORGIAN CAPITAL LETTER NAR
-    case 0x10AD: return 0x2D0D; // GEORGIAN CAPITAL LETTER ON
-    case 0x10AE: return 0x2D0E; // GEORGIAN CAPITAL LETTER PAR
-    case 0x10AF: return 0x2D0F; // GEORGIAN CAPITAL LETTER ZHAR
-    case 0x10B0: return 0x2D10; // GEORGIAN CAPITAL LETTER RAE
-    case 0x10B1: return 0x2D11; // GEORGIAN CAPITAL LETTER SAN
-    case 0x10B2: return 0x2D12; // GEORGIAN CAPITAL LETTER TAR
-    case 0x10B3: return 0x2D13; // GEORGIAN CAPITAL LETTER UN
-    case 0x10B4: return 0x2D14; // GEORGIAN CAPITAL LETTER PHAR
-    case 0x10B5: return 0x2D15; // GEORGIAN CAPITAL LETTER KHAR
-    case 0x10B6: return 0x2D16; // GEORGIAN CAPITAL LETTER GHAN
-    case 0x10B7: return 0x2D17; // GEORGIAN CAPITAL LETTER QAR
-    case 0x10B8: return 0x2D18; // GEORGIAN CAPITAL LETTER SHIN
-    case 0x10B9: return 0x2D19; // GEORGIAN CAPITAL LETTER CHIN
-    case 0x10BA: return 0x2D1A; // GEORGIAN CAPITAL LETTER CAN
-    case 0x10BB: return 0x2D1B; // GEORGIAN CAPITAL LETTER JIL
-    case 0x10BC: return 0x2D1C; // GEORGIAN CAPITAL LETTER CIL
-    case 0x10BD: return 0x2D1D; // GEORGIAN CAPITAL LETTER CHAR
-    case 0x10BE: return 0x2D1E; // GEORGIAN CAPITAL LETTER XAN
-    case 0x10BF: return 0x2D1F; // GEORGIAN CAPITAL LETTER JHAN
-    case 0x10C0: return 0x2D20; // GEORGIAN CAPITAL LETTER HAE
-    case 0x10C1: return 0x2D21; // GEORGIAN CAPITAL LETTER HE
-    case 0x10C2: return 0x2D22; // GEORGIAN CAPITAL LETTER HIE
-    case 0x10C3: return 0x2D23; // GEORGIAN CAPITAL LETTER WE
-    case 0x10C4: return 0x2D24; // GEORGIAN CAPITAL LETTER HAR
-    case 0x10C5: return 0x2D25; // GEORGIAN CAPITAL LETTER HOE
-    case 0x10C7: return 0x2D27; // GEORGIAN CAPITAL LETTER YN
-    case 0x10CD: return 0x2D2D; // GEORGIAN CAPITAL LETTER AEN
-    case 0x1E00: return 0x1E01; // LATIN CAPITAL LETTER A WITH RING BELOW
-    case 0x1E02: return 0x1E03; // LATIN CAPITAL LETTER B WITH DOT ABOVE
-    case 0x1E04: return 0x1E05; // LATIN CAPITAL LETTER B WITH DOT BELOW
-    case 0x1E06: return 0x1E07; // LATIN CAPITAL LETTER B WITH LINE BELOW
-    case 0x1E08: return 0x1E09; // LATIN CAPITAL LETTER C WITH CEDILLA AND ACUTE
-    case 0x1E0A: return 0x1E0B; // LATIN CAPITAL LETTER D WITH DOT ABOVE
-    case 0x1E0C: return 0x1E0D; // LATIN CAPITAL LETTER D WITH DOT BELOW
-    case 0x1E0E: return 0x1E0F; // LATIN CAPITAL LETTER D WITH LINE BELOW
-    case 0x1E10: return 0x1E11; // LATIN CAPITAL LETTER D WITH CEDILLA
-    case 0x1E12: return 0x1E13; // LATIN CAPITAL LETTER D WITH CIRCUMFLEX BELOW
-    case 0x1E14: return 0x1E15; // LATIN CAPITAL LETTER E WITH MACRON AND GRAVE
-    case 0x1E16: return 0x1E17; // LATIN CAPITAL LETTER E WITH MACRON AND ACUTE
-    case 0x1E18: return 0x1E19; // LATIN CAPITAL LETTER E WITH CIRCUMFLEX BELOW
-    case 0x1E1A: return 0x1E1B; // LATIN CAPITAL LETTER E WITH TILDE BELOW
-    case 0x1E1C: return 0x1E1D; // LATIN CAPITAL LETTER E WITH CEDILLA AND BREVE
-    case 0x1E1E: return 0x1E1F; // LATIN CAPITAL LETTER F WITH DOT ABOVE
-    case 0x1E20: return 0x1E21; // LATIN CAPITAL LETTER G WITH MACRON
-    case 0x1E22: return 0x1E23; // LATIN CAPITAL LETTER H WITH DOT ABOVE
-    case 0x1E24: return 0x1E25; // LATIN CAPITAL LETTER H WITH DOT BELOW
-    case 0x1E26: return 0x1E27; // LATIN CAPITAL LETTER H WITH DIAERESIS
-    case 0x1E28: return 0x1E29; // LATIN CAPITAL LETTER H WITH CEDILLA
-    case 0x1E2A: return 0x1E2B; // LATIN CAPITAL LETTER H WITH BREVE BELOW
-    case 0x1E2C: return 0x1E2D; // LATIN CAPITAL LETTER I WITH TILDE BELOW
-    case 0x1E2E: return 0x1E2F; // LATIN CAPITAL LETTER I WITH DIAERESIS AND ACUTE
-    case 0x1E30: return 0x1E31; // LATIN CAPITAL LETTER K WITH ACUTE
-    case 0x1E32: return 0x1E33; // LATIN CAPITAL LETTER K WITH DOT BELOW
-    case 0x1E34: return 0x1E35; // LATIN CAPITAL LETTER K WITH LINE BELOW
-    case 0x1E36: return 0x1E37; // LATIN CAPITAL LETTER L WITH DOT BELOW
-    case 0x1E38: return 0x1E39; // LATIN CAPITAL LETTER L WITH DOT BELOW AND MACRON
-    case 0x1E3A: return 0x1E3B; // LATIN CAPITAL LETTER L WITH LINE BELOW
-    case 0x1E3C: return 0x1E3D; // LATIN CAPITAL LETTER L WITH CIRCUMFLEX BELOW
-    case 0x1E3E: return 0x1E3F; // LATIN CAPITAL LETTER M WITH ACUTE
-    case 0x1E40: return 0x1E41; // LATIN CAPITAL LETTER M WITH DOT ABOVE
-    case 0x1E42: return 0x1E43; // LATIN CAPITAL LETTER M WITH DOT BELOW
-    case 0x1E44: return 0x1E45; // LATIN CAPITAL LETTER N WITH DOT ABOVE
-    case 0x1E46: return 0x1E47; // LATIN CAPITAL LETTER N WITH DOT BELOW
-    case 0x1E48: return 0x1E49; // LATIN CAPITAL LETTER N WITH LINE BELOW
-    case 0x1E4A: return 0x1E4B; // LATIN CAPITAL LETTER N WITH CIRCUMFLEX BELOW
-    case 0x1E4C: return 0x1E4D; // LATIN CAPITAL LETTER O WITH TILDE AND ACUTE
-    case 0x1E4E: return 0x1E4F; // LATIN CAPITAL LETTER O WITH TILDE AND DIAERESIS
-    case 0x1E50: return 0x1E51; // LATIN CAPITAL LETTER O WITH MACRON AND GRAVE
-    case 0x1E52: return 0x1E53; // LATIN CAPITAL LETTER O WITH MACRON AND ACUTE
-    case 0x1E54: return 0x1E55; // LATIN CAPITAL LETTER P WITH ACUTE
-    case 0x1E56: return 0x1E57; // LATIN CAPITAL LETTER P WITH DOT ABOVE
-    case 0x1E58: return 0x1E59; // LATIN CAPITAL LETTER R WITH DOT ABOVE
-    case 0x1E5A: return 0x1E5B; // LATIN CAPITAL LETTER R WITH DOT BELOW
-    case 0x1E5C: return 0x1E5D; // LATIN CAPITAL LETTER R WITH DOT BELOW AND MACRON
-    case 0x1E5E: return 0x1E5F; // LATIN CAPITAL LETTER R WITH LINE BELOW
-    case 0x1E60: return 0x1E61; // LATIN CAPITAL LETTER S WITH DOT ABOVE
-    case 0x1E62: return 0x1E63; // LATIN CAPITAL LETTER S WITH DOT BELOW
-    case 0x1E64: return 0x1E65; // LATIN CAPITAL LETTER S WITH ACUTE AND DOT ABOVE
-    case 0x1E66: return 0x1E67; // LATIN CAPITAL LETTER S WITH CARON AND DOT ABOVE
-    case 0x1E68: return 0x1E69; // LATIN CAPITAL LETTER S WITH DOT BELOW AND DOT ABOVE
-    case 0x1E6A: return 0x1E6B; // LATIN CAPITAL LETTER T WITH DOT ABOVE
-    case 0x1E6C: return 0x1E6D; // LATIN CAPITAL LETTER T WITH DOT BELOW
-    case 0x1E6E: return 0x1E6F; // LATIN CAPITAL LETTER T WITH LINE BELOW
-    case 0x1E70: return 0x1E71; // LATIN CAPITAL LETTER T WITH CIRCUMFLEX BELOW
-    case 0x1E72: return 0x1E73; // LATIN CAPITAL LETTER U WITH DIAERESIS BELOW
-    case 0x1E74: return 0x1E75; // LATIN CAPITAL LETTER U WITH TILDE BELOW
-    case 0x1E76: return 0x1E77; // LATIN CAPITAL LETTER U WITH CIRCUMFLEX BELOW
-    case 0x1E78: return 0x1E79; // LATIN CAPITAL LETTER U WITH TILDE AND ACUTE
-    case 0x1E7A: return 0x1E7B; // LATIN CAPITAL LETTER U WITH MACRON AND DIAERESIS
-    case 0x1E7C: return 0x1E7D; // LATIN CAPITAL LETTER V WITH TILDE
-    case 0x1E7E: return 0x1E7F; // LATIN CAPITAL LETTER V WITH DOT BELOW
-    case 0x1E80: return 0x1E81; // LATIN CAPITAL LETTER W WITH GRAVE
-    case 0x1E82: return 0x1E83; // LATIN CAPITAL LETTER W WITH ACUTE
-    case 0x1E84: return 0x1E85; // LATIN CAPITAL LETTER W WITH DIAERESIS
-    case 0x1E86: return 0x1E87; // LATIN CAPITAL LETTER W WITH DOT ABOVE
-    case 0x1E88: return 0x1E89; // LATIN CAPITAL LETTER W WITH DOT BELOW
-    case 0x1E8A: return 0x1E8B; // LATIN CAPITAL LETTER X WITH DOT ABOVE
-    case 0x1E8C: return 0x1E8D; // LATIN CAPITAL LETTER X WITH DIAERESIS
-    case 0x1E8E: return 0x1E8F; // LATIN CAPITAL LETTER Y WITH DOT ABOVE
-    case 0x1E90: return 0x1E91; // LATIN CAPITAL LETTER Z WITH CIRCUMFLEX
-    case 0x1E92: return 0x1E93; // LATIN CAPITAL LETTER Z WITH DOT BELOW
-    case 0x1E94: return 0x1E95; // LATIN CAPITAL LETTER Z WITH LINE BELOW
-    case 0x1E9B: return 0x1E61; // LATIN SMALL LETTER LONG S WITH DOT ABOVE
-    case 0x1E9E: return 0x00DF; // LATIN CAPITAL LETTER SHARP S
-    case 0x1EA0: return 0x1EA1; // LATIN CAPITAL LETTER A WITH DOT BELOW
-    case 0x1EA2: return 0x1EA3; // LATIN CAPITAL LETTER A WITH HOOK ABOVE
-    case 0x1EA4: return 0x1EA5; // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND ACUTE
-    case 0x1EA6: return 0x1EA7; // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND GRAVE
-    case 0x1EA8: return 0x1EA9; // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND HOOK ABOVE
-    case 0x1EAA: return 0x1EAB; // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND TILDE
-    case 0x1EAC: return 0x1EAD; // LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND DOT BELOW
-    case 0x1EAE: return 0x1EAF; // LATIN CAPITAL LETTER A WITH BREVE AND ACUTE
-    case 0x1EB0: return 0x1EB1; // LATIN CAPITAL LETTER A WITH BREVE AND GRAVE
-    case 0x1EB2: return 0x1EB3; // LATIN CAPITAL LETTER A WITH BREVE AND HOOK ABOVE
-    case 0x1EB4: return 0x1EB5; // LATIN CAPITAL LETTER A WITH BREVE AND TILDE
-    case 0x1EB6: return 0x1EB7; // LATIN CAPITAL LETTER A WITH BREVE AND DOT BELOW
-    case 0x1EB8: return 0x1EB9; // LATIN CAPITAL LETTER E WITH DOT BELOW
-    case 0x1EBA: return 0x1EBB; // LATIN CAPITAL LETTER E WITH HOOK ABOVE
-    case 0x1EBC: return 0x1EBD; // LATIN CAPITAL LETTER E WITH TILDE
-    case 0x1EBE: return 0x1EBF; // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND ACUTE
-    case 0x1EC0: return 0x1EC1; // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND GRAVE
-    case 0x1EC2: return 0x1EC3; // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND HOOK ABOVE
-    case 0x1EC4: return 0x1EC5; // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND TILDE
-    case 0x1EC6: return 0x1EC7; // LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND DOT BELOW
-    case 0x1EC8: return 0x1EC9; // LATIN CAPITAL LETTER I WITH HOOK ABOVE
-    case 0x1ECA: return 0x1ECB; // LATIN CAPITAL LETTER I WITH DOT BELOW
-    case 0x1ECC: return 0x1ECD; // LATIN CAPITAL LETTER O WITH DOT BELOW
-    case 0x1ECE: return 0x1ECF; // LATIN CAPITAL LETTER O WITH HOOK ABOVE
-    case 0x1ED0: return 0x1ED1; // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND ACUTE
-    case 0x1ED2: return 0x1ED3; // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND GRAVE
-    case 0x1ED4: return 0x1ED5; // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND HOOK ABOVE
-    case 0x1ED6: return 0x1ED7; // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND TILDE
-    case 0x1ED8: return 0x1ED9; // LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND DOT BELOW
-    case 0x1EDA: return 0x1EDB; // LATIN CAPITAL LETTER O WITH HORN AND ACUTE
-    case 0x1EDC: return 0x1EDD; // LATIN CAPITAL LETTER O WITH HORN AND GRAVE
-    case 0x1EDE: return 0x1EDF; // LATIN CAPITAL LETTER O WITH HORN AND HOOK ABOVE
-    case 0x1EE0: return 0x1EE1; // LATIN CAPITAL LETTER O WITH HORN AND TILDE
-    case 0x1EE2: return 0x1EE3; // LATIN CAPITAL LETTER O WITH HORN AND DOT BELOW
-    case 0x1EE4: return 0x1EE5; // LATIN CAPITAL LETTER U WITH DOT BELOW
-    case 0x1EE6: return 0x1EE7; // LATIN CAPITAL LETTER U WITH HOOK ABOVE
-    case 0x1EE8: return 0x1EE9; // LATIN CAPITAL LETTER U WITH HORN AND ACUTE
-    case 0x1EEA: return 0x1EEB; // LATIN CAPITAL LETTER U WITH HORN AND GRAVE
-    case 0x1EEC: return 0x1EED; // LATIN CAPITAL LETTER U WITH HORN AND HOOK ABOVE
-    case 0x1EEE: return 0x1EEF; // LATIN CAPITAL LETTER U WITH HORN AND TILDE
-    case 0x1EF0: return 0x1EF1; // LATIN CAPITAL LETTER U WITH HORN AND DOT BELOW
-    case 0x1EF2: return 0x1EF3; // LATIN CAPITAL LETTER Y WITH GRAVE
-    case 0x1EF4: return 0x1EF5; // LATIN CAPITAL LETTER Y WITH DOT BELOW
-    case 0x1EF6: return 0x1EF7; // LATIN CAPITAL LETTER Y WITH HOOK ABOVE
-    case 0x1EF8: return 0x1EF9; // LATIN CAPITAL LETTER Y WITH TILDE
-    case 0x1EFA: return 0x1EFB; // LATIN CAPITAL LETTER MIDDLE-WELSH LL
-    case 0x1EFC: return 0x1EFD; // LATIN CAPITAL LETTER MIDDLE-WELSH V
-    case 0x1EFE: return 0x1EFF; // LATIN CAPITAL LETTER Y WITH LOOP
-    case 0x1F08: return 0x1F00; // GREEK CAPITAL LETTER ALPHA WITH PSILI
-    case 0x1F09: return 0x1F01; // GREEK CAPITAL LETTER ALPHA WITH DASIA
-    case 0x1F0A: return 0x1F02; // GREEK CAPITAL LETTER ALPHA WITH PSILI AND VARIA
-    case 0x1F0B: return 0x1F03; // GREEK CAPITAL LETTER ALPHA WITH DASIA AND VARIA
-    case 0x1F0C: return 0x1F04; // GREEK CAPITAL LETTER ALPHA WITH PSILI AND OXIA
-    case 0x1F0D: return 0x1F05; // GREEK CAPITAL LETTER ALPHA WITH DASIA AND OXIA
-    case 0x1F0E: return 0x1F06; // GREEK CAPITAL LETTER ALPHA WITH PSILI AND PERISPOMENI
-    case 0x1F0F: return 0x1F07; // GREEK CAPITAL LETTER ALPHA WITH DASIA AND PERISPOMENI
-    case 0x1F18: return 0x1F10; // GREEK CAPITAL LETTER EPSILON WITH PSILI
-    case 0x1F19: return 0x1F11; // GREEK CAPITAL LETTER EPSILON WITH DASIA
-    case 0x1F1A: return 0x1F12; // GREEK CAPITAL LETTER EPSILON WITH PSILI AND VARIA
-    case 0x1F1B: return 0x1F13; // GREEK CAPITAL LETTER EPSILON WITH DASIA AND VARIA
-    case 0x1F1C: return 0x1F14; // GREEK CAPITAL LETTER EPSILON WITH PSILI AND OXIA
-    case 0x1F1D: return 0x1F15; // GREEK CAPITAL LETTER EPSILON WITH DASIA AND OXIA
-    case 0x1F28: return 0x1F20; // GREEK CAPITAL LETTER ETA WITH PSILI
-    case 0x1F29: return 0x1F21; // GREEK CAPITAL LETTER ETA WITH DASIA
-    case 0x1F2A: return 0x1F22; // GREEK CAPITAL LETTER ETA WITH PSILI AND VARIA
-    case 0x1F2B: return 0x1F23; // GREEK CAPITAL LETTER ETA WITH DASIA AND VARIA
-    case 0x1F2C: return 0x1F24; // GREEK CAPITAL LETTER ETA WITH PSILI AND OXIA
-    case 0x1F2D: return 0x1F25; // GREEK CAPITAL LETTER ETA WITH DASIA AND OXIA
-    case 0x1F2E: return 0x1F26; // GREEK CAPITAL LETTER ETA WITH PSILI AND PERISPOMENI
-    case 0x1F2F: return 0x1F27; // GREEK CAPITAL LETTER ETA WITH DASIA AND PERISPOMENI
-    case 0x1F38: return 0x1F30; // GREEK CAPITAL LETTER IOTA WITH PSILI
-    case 0x1F39: return 0x1F31; // GREEK CAPITAL LETTER IOTA WITH DASIA
-    case 0x1F3A: return 0x1F32; // GREEK CAPITAL LETTER IOTA WITH PSILI AND VARIA
-    case 0x1F3B: return 0x1F33; // GREEK CAPITAL LETTER IOTA WITH DASIA AND VARIA
-    case 0x1F3C: return 0x1F34; // GREEK CAPITAL LETTER IOTA WITH PSILI AND OXIA
-    case 0x1F3D: return 0x1F35; // GREEK CAPITAL LETTER IOTA WITH DASIA AND OXIA
-    case 0x1F3E: return 0x1F36; // GREEK CAPITAL LETTER IOTA WITH PSILI AND PERISPOMENI
-    case 0x1F3F: return 0x1F37; // GREEK CAPITAL LETTER IOTA WITH DASIA AND PERISPOMENI
-    case 0x1F48: return 0x1F40; // GREEK CAPITAL LETTER OMICRON WITH PSILI
-    case 0x1F49: return 0x1F41; // GREEK CAPITAL LETTER OMICRON WITH DASIA
-    case 0x1F4A: return 0x1F42; // GREEK CAPITAL LETTER OMICRON WITH PSILI AND VARIA
-    case 0x1F4B: return 0x1F43; // GREEK CAPITAL LETTER OMICRON WITH DASIA AND VARIA
-    case 0x1F4C: return 0x1F44; // GREEK CAPITAL LETTER OMICRON WITH PSILI AND OXIA
-    case 0x1F4D: return 0x1F45; // GREEK CAPITAL LETTER OMICRON WITH DASIA AND OXIA
-    case 0x1F59: return 0x1F51; // GREEK CAPITAL LETTER UPSILON WITH DASIA
-    case 0x1F5B: return 0x1F53; // GREEK CAPITAL LETTER UPSILON WITH DASIA AND VARIA
-    case 0x1F5D: return 0x1F55; // GREEK CAPITAL LETTER UPSILON WITH DASIA AND OXIA
-    case 0x1F5F: return 0x1F57; // GREEK CAPITAL LETTER UPSILON WITH DASIA AND PERISPOMENI
-    case 0x1F68: return 0x1F60; // GREEK CAPITAL LETTER OMEGA WITH PSILI
-    case 0x1F69: return 0x1F61; // GREEK CAPITAL LETTER OMEGA WITH DASIA
-    case 0x1F6A: return 0x1F62; // GREEK CAPITAL LETTER OMEGA WITH PSILI AND VARIA
-    case 0x1F6B: return 0x1F63; // GREEK CAPITAL LETTER OMEGA WITH DASIA AND VARIA
-    case 0x1F6C: return 0x1F64; // GREEK CAPITAL LETTER OMEGA WITH PSILI AND OXIA
-    case 0x1F6D: return 0x1F65; // GREEK CAPITAL LETTER OMEGA WITH DASIA AND OXIA
-    case 0x1F6E: return 0x1F66; // GREEK CAPITAL LETTER OMEGA WITH PSILI AND PERISPOMENI
-    case 0x1F6F: return 0x1F67; // GREEK CAPITAL LETTER OMEGA WITH DASIA AND PERISPOMENI
-    case 0x1F88: return 0x1F80; // GREEK CAPITAL LETTER ALPHA WITH PSILI AND PROSGEGRAMMENI
-    case 0x1F89: return 0x1F81; // GREEK CAPITAL LETTER ALPHA WITH DASIA AND PROSGEGRAMMENI
-    case 0x1F8A: return 0x1F82; // GREEK CAPITAL LETTER ALPHA WITH PSILI AND VARIA AND PROSGEGRAMMENI
-    case 0x1F8B: return 0x1F83; // GREEK CAPITAL LETTER ALPHA WITH DASIA AND VARIA AND PROSGEGRAMMENI
-    case 0x1F8C: return 0x1F84; // GREEK CAPITAL LETTER ALPHA WITH PSILI AND OXIA AND PROSGEGRAMMENI
-    case 0x1F8D: return 0x1F85; // GREEK CAPITAL LETTER ALPHA WITH DASIA AND OXIA AND PROSGEGRAMMENI
-    case 0x1F8E: return 0x1F86; // GREEK CAPITAL LETTER ALPHA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
-    case 0x1F8F: return 0x1F87; // GREEK CAPITAL LETTER ALPHA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
-    case 0x1F98: return 0x1F90; // GREEK CAPITAL LETTER ETA WITH PSILI AND PROSGEGRAMMENI
-    case 0x1F99: return 0x1F91; // GREEK CAPITAL LETTER ETA WITH DASIA AND PROSGEGRAMMENI
-    case 0x1F9A: return 0x1F92; // GREEK CAPITAL LETTER ETA WITH PSILI AND VARIA AND PROSGEGRAMMENI
-    case 0x1F9B: return 0x1F93; // GREEK CAPITAL LETTER ETA WITH DASIA AND VARIA AND PROSGEGRAMMENI
-    case 0x1F9C: return 0x1F94; // GREEK CAPITAL LETTER ETA WITH PSILI AND OXIA AND PROSGEGRAMMENI
-    case 0x1F9D: return 0x1F95; // GREEK CAPITAL LETTER ETA WITH DASIA AND OXIA AND PROSGEGRAMMENI
-    case 0x1F9E: return 0x1F96; // GREEK CAPITAL LETTER ETA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
-    case 0x1F9F: return 0x1F97; // GREEK CAPITAL LETTER ETA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
-    case 0x1FA8: return 0x1FA0; // GREEK CAPITAL LETTER OMEGA WITH PSILI AND PROSGEGRAMMENI
-    case 0x1FA9: return 0x1FA1; // GREEK CAPITAL LETTER OMEGA WITH DASIA AND PROSGEGRAMMENI
-    case 0x1FAA: return 0x1FA2; // GREEK CAPITAL LETTER OMEGA WITH PSILI AND VARIA AND PROSGEGRAMMENI
-    case 0x1FAB: return 0x1FA3; // GREEK CAPITAL LETTER OMEGA WITH DASIA AND VARIA AND PROSGEGRAMMENI
-    case 0x1FAC: return 0x1FA4; // GREEK CAPITAL LETTER OMEGA WITH PSILI AND OXIA AND PROSGEGRAMMENI
-    case 0x1FAD: return 0x1FA5; // GREEK CAPITAL LETTER OMEGA WITH DASIA AND OXIA AND PROSGEGRAMMENI
-    case 0x1FAE: return 0x1FA6; // GREEK CAPITAL LETTER OMEGA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI
-    case 0x1FAF: return 0x1FA7; // GREEK CAPITAL LETTER OMEGA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI
-    case 0x1FB8: return 0x1FB0; // GREEK CAPITAL LETTER ALPHA WITH VRACHY
-    case 0x1FB9: return 0x1FB1; // GREEK CAPITAL LETTER ALPHA WITH MACRON
-    case 0x1FBA: return 0x1F70; // GREEK CAPITAL LETTER ALPHA WITH VARIA
-    case 0x1FBB: return 0x1F71; // GREEK CAPITAL LETTER ALPHA WITH OXIA
-    case 0x1FBC: return 0x1FB3; // GREEK CAPITAL LETTER ALPHA WITH PROSGEGRAMMENI
-    case 0x1FBE: return 0x03B9; // GREEK PROSGEGRAMMENI
-    case 0x1FC8: return 0x1F72; // GREEK CAPITAL LETTER EPSILON WITH VARIA
-    case 0x1FC9: return 0x1F73; // GREEK CAPITAL LETTER EPSILON WITH OXIA
-    case 0x1FCA: return 0x1F74; // GREEK CAPITAL LETTER ETA WITH VARIA
-    case 0x1FCB: return 0x1F75; // GREEK CAPITAL LETTER ETA WITH OXIA
-    case 0x1FCC: return 0x1FC3; // GREEK CAPITAL LETTER ETA WITH PROSGEGRAMMENI
-    case 0x1FD8: return 0x1FD0; // GREEK CAPITAL LETTER IOTA WITH VRACHY
-    case 0x1FD9: return 0x1FD1; // GREEK CAPITAL LETTER IOTA WITH MACRON
-    case 0x1FDA: return 0x1F76; // GREEK CAPITAL LETTER IOTA WITH VARIA
-    case 0x1FDB: return 0x1F77; // GREEK CAPITAL LETTER IOTA WITH OXIA
-    case 0x1FE8: return 0x1FE0; // GREEK CAPITAL LETTER UPSILON WITH VRACHY
-    case 0x1FE9: return 0x1FE1; // GREEK CAPITAL LETTER UPSILON WITH MACRON
-    case 0x1FEA: return 0x1F7A; // GREEK CAPITAL LETTER UPSILON WITH VARIA
-    case 0x1FEB: return 0x1F7B; // GREEK CAPITAL LETTER UPSILON WITH OXIA
-    case 0x1FEC: return 0x1FE5; // GREEK CAPITAL LETTER RHO WITH DASIA
-    case 0x1FF8: return 0x1F78; // GREEK CAPITAL LETTER OMICRON WITH VARIA
-    case 0x1FF9: return 0x1F79; // GREEK CAPITAL LETTER OMICRON WITH OXIA
-    case 0x1FFA: return 0x1F7C; // GREEK CAPITAL LETTER OMEGA WITH VARIA
-    case 0x1FFB: return 0x1F7D; // GREEK CAPITAL LETTER OMEGA WITH OXIA
-    case 0x1FFC: return 0x1FF3; // GREEK CAPITAL LETTER OMEGA WITH PROSGEGRAMMENI
-    case 0x2126: return 0x03C9; // OHM SIGN
-    case 0x212A: return 0x006B; // KELVIN SIGN
-    case 0x212B: return 0x00E5; // ANGSTROM SIGN
-    case 0x2132: return 0x214E; // TURNED CAPITAL F
-    case 0x2160: return 0x2170; // ROMAN NUMERAL ONE
-    case 0x2161: return 0x2171; // ROMAN NUMERAL TWO
-    case 0x2162: return 0x2172; // ROMAN NUMERAL THREE
-    case 0x2163: return 0x2173; // ROMAN NUMERAL FOUR
-    case 0x2164: return 0x2174; // ROMAN NUMERAL FIVE
-    case 0x2165: return 0x2175; // ROMAN NUMERAL SIX
-    case 0x2166: return 0x2176; // ROMAN NUMERAL SEVEN
-    case 0x2167: return 0x2177; // ROMAN NUMERAL EIGHT
-    case 0x2168: return 0x2178; // ROMAN NUMERAL NINE
-    case 0x2169: return 0x2179; // ROMAN NUMERAL TEN
-    case 0x216A: return 0x217A; // ROMAN NUMERAL ELEVEN
-    case 0x216B: return 0x217B; // ROMAN NUMERAL TWELVE
-    case 0x216C: return 0x217C; // ROMAN NUMERAL FIFTY
-    case 0x216D: return 0x217D; // ROMAN NUMERAL ONE HUNDRED
-    case 0x216E: return 0x217E; // ROMAN NUMERAL FIVE HUNDRED
-    case 0x216F: return 0x217F; // ROMAN NUMERAL ONE THOUSAND
-    case 0x2183: return 0x2184; // ROMAN NUMERAL REVERSED ONE HUNDRED
-    case 0x24B6: return 0x24D0; // CIRCLED LATIN CAPITAL LETTER A
-    case 0x24B7: return 0x24D1; // CIRCLED LATIN CAPITAL LETTER B
-    case 0x24B8: return 0x24D2; // CIRCLED LATIN CAPITAL LETTER C
-    case 0x24B9: return 0x24D3; // CIRCLED LATIN CAPITAL LETTER D
-    case 0x24BA: return 0x24D4; // CIRCLED LATIN CAPITAL LETTER E
-    case 0x24BB: return 0x24D5; // CIRCLED LATIN CAPITAL LETTER F
-    case 0x24BC: return 0x24D6; // CIRCLED LATIN CAPITAL LETTER G
-    case 0x24BD: return 0x24D7; // CIRCLED LATIN CAPITAL LETTER H
-    case 0x24BE: return 0x24D8; // CIRCLED LATIN CAPITAL LETTER I
-    case 0x24BF: return 0x24D9; // CIRCLED LATIN CAPITAL LETTER J
-    case 0x24C0: return 0x24DA; // CIRCLED LATIN CAPITAL LETTER K
-    case 0x24C1: return 0x24DB; // CIRCLED LATIN CAPITAL LETTER L
-    case 0x24C2: return 0x24DC; // CIRCLED LATIN CAPITAL LETTER M
-    case 0x24C3: return 0x24DD; // CIRCLED LATIN CAPITAL LETTER N
-    case 0x24C4: return 0x24DE; // CIRCLED LATIN CAPITAL LETTER O
-    case 0x24C5: return 0x24DF; // CIRCLED LATIN CAPITAL LETTER P
-    case 0x24C6: return 0x24E0; // CIRCLED LATIN CAPITAL LETTER Q
-    case 0x24C7: return 0x24E1; // CIRCLED LATIN CAPITAL LETTER R
-    case 0x24C8: return 0x24E2; // CIRCLED LATIN CAPITAL LETTER S
-    case 0x24C9: return 0x24E3; // CIRCLED LATIN CAPITAL LETTER T
-    case 0x24CA: return 0x24E4; // CIRCLED LATIN CAPITAL LETTER U
-    case 0x24CB: return 0x24E5; // CIRCLED LATIN CAPITAL LETTER V
-    case 0x24CC: return 0x24E6; // CIRCLED LATIN CAPITAL LETTER W
-    case 0x24CD: return 0x24E7; // CIRCLED LATIN CAPITAL LETTER X
-    case 0x24CE: return 0x24E8; // CIRCLED LATIN CAPITAL LETTER Y
-    case 0x24CF: return 0x24E9; // CIRCLED LATIN CAPITAL LETTER Z
-    case 0x2C00: return 0x2C30; // GLAGOLITIC CAPITAL LETTER AZU
-    case 0x2C01: return 0x2C31; // GLAGOLITIC CAPITAL LETTER BUKY
-    case 0x2C02: return 0x2C32; // GLAGOLITIC CAPITAL LETTER VEDE
-    case 0x2C03: return 0x2C33; // GLAGOLITIC CAPITAL LETTER GLAGOLI
-    case 0x2C04: return 0x2C34; // GLAGOLITIC CAPITAL LETTER DOBRO
-    case 0x2C05: return 0x2C35; // GLAGOLITIC CAPITAL LETTER YESTU
-    case 0x2C06: return 0x2C36; // GLAGOLITIC CAPITAL LETTER ZHIVETE
-    case 0x2C07: return 0x2C37; // GLAGOLITIC CAPITAL LETTER DZELO
-    case 0x2C08: return 0x2C38; // GLAGOLITIC CAPITAL LETTER ZEMLJA
-    case 0x2C09: return 0x2C39; // GLAGOLITIC CAPITAL LETTER IZHE
-    case 0x2C0A: return 0x2C3A; // GLAGOLITIC CAPITAL LETTER INITIAL IZHE
-    case 0x2C0B: return 0x2C3B; // GLAGOLITIC CAPITAL LETTER I
-    case 0x2C0C: return 0x2C3C; // GLAGOLITIC CAPITAL LETTER DJERVI
-    case 0x2C0D: return 0x2C3D; // GLAGOLITIC CAPITAL LETTER KAKO
-    case 0x2C0E: return 0x2C3E; // GLAGOLITIC CAPITAL LETTER LJUDIJE
-    case 0x2C0F: return 0x2C3F; // GLAGOLITIC CAPITAL LETTER MYSLITE
-    case 0x2C10: return 0x2C40; // GLAGOLITIC CAPITAL LETTER NASHI
-    case 0x2C11: return 0x2C41; // GLAGOLITIC CAPITAL LETTER ONU
-    case 0x2C12: return 0x2C42; // GLAGOLITIC CAPITAL LETTER POKOJI
-    case 0x2C13: return 0x2C43; // GLAGOLITIC CAPITAL LETTER RITSI
-    case 0x2C14: return 0x2C44; // GLAGOLITIC CAPITAL LETTER SLOVO
-    case 0x2C15: return 0x2C45; // GLAGOLITIC CAPITAL LETTER TVRIDO
-    case 0x2C16: return 0x2C46; // GLAGOLITIC CAPITAL LETTER UKU
-    case 0x2C17: return 0x2C47; // GLAGOLITIC CAPITAL LETTER FRITU
-    case 0x2C18: return 0x2C48; // GLAGOLITIC CAPITAL LETTER HERU
-    case 0x2C19: return 0x2C49; // GLAGOLITIC CAPITAL LETTER OTU
-    case 0x2C1A: return 0x2C4A; // GLAGOLITIC CAPITAL LETTER PE
-    case 0x2C1B: return 0x2C4B; // GLAGOLITIC CAPITAL LETTER SHTA
-    case 0x2C1C: return 0x2C4C; // GLAGOLITIC CAPITAL LETTER TSI
-    case 0x2C1D: return 0x2C4D; // GLAGOLITIC CAPITAL LETTER CHRIVI
-    case 0x2C1E: return 0x2C4E; // GLAGOLITIC CAPITAL LETTER SHA
-    case 0x2C1F: return 0x2C4F; // GLAGOLITIC CAPITAL LETTER YERU
-    case 0x2C20: return 0x2C50; // GLAGOLITIC CAPITAL LETTER YERI
-    case 0x2C21: return 0x2C51; // GLAGOLITIC CAPITAL LETTER YATI
-    case 0x2C22: return 0x2C52; // GLAGOLITIC CAPITAL LETTER SPIDERY HA
-    case 0x2C23: return 0x2C53; // GLAGOLITIC CAPITAL LETTER YU
-    case 0x2C24: return 0x2C54; // GLAGOLITIC CAPITAL LETTER SMALL YUS
-    case 0x2C25: return 0x2C55; // GLAGOLITIC CAPITAL LETTER SMALL YUS WITH TAIL
-    case 0x2C26: return 0x2C56; // GLAGOLITIC CAPITAL LETTER YO
-    case 0x2C27: return 0x2C57; // GLAGOLITIC CAPITAL LETTER IOTATED SMALL YUS
-    case 0x2C28: return 0x2C58; // GLAGOLITIC CAPITAL LETTER BIG YUS
-    case 0x2C29: return 0x2C59; // GLAGOLITIC CAPITAL LETTER IOTATED BIG YUS
-    case 0x2C2A: return 0x2C5A; // GLAGOLITIC CAPITAL LETTER FITA
-    case 0x2C2B: return 0x2C5B; // GLAGOLITIC CAPITAL LETTER IZHITSA
-    case 0x2C2C: return 0x2C5C; // GLAGOLITIC CAPITAL LETTER SHTAPIC
-    case 0x2C2D: return 0x2C5D; // GLAGOLITIC CAPITAL LETTER TROKUTASTI A
-    case 0x2C2E: return 0x2C5E; // GLAGOLITIC CAPITAL LETTER LATINATE MYSLITE
-    case 0x2C60: return 0x2C61; // LATIN CAPITAL LETTER L WITH DOUBLE BAR
-    case 0x2C62: return 0x026B; // LATIN CAPITAL LETTER L WITH MIDDLE TILDE
-    case 0x2C63: return 0x1D7D; // LATIN CAPITAL LETTER P WITH STROKE
-    case 0x2C64: return 0x027D; // LATIN CAPITAL LETTER R WITH TAIL
-    case 0x2C67: return 0x2C68; // LATIN CAPITAL LETTER H WITH DESCENDER
-    case 0x2C69: return 0x2C6A; // LATIN CAPITAL LETTER K WITH DESCENDER
-    case 0x2C6B: return 0x2C6C; // LATIN CAPITAL LETTER Z WITH DESCENDER
-    case 0x2C6D: return 0x0251; // LATIN CAPITAL LETTER ALPHA
-    case 0x2C6E: return 0x0271; // LATIN CAPITAL LETTER M WITH HOOK
-    case 0x2C6F: return 0x0250; // LATIN CAPITAL LETTER TURNED A
-    case 0x2C70: return 0x0252; // LATIN CAPITAL LETTER TURNED ALPHA
-    case 0x2C72: return 0x2C73; // LATIN CAPITAL LETTER W WITH HOOK
-    case 0x2C75: return 0x2C76; // LATIN CAPITAL LETTER HALF H
-    case 0x2C7E: return 0x023F; // LATIN CAPITAL LETTER S WITH SWASH TAIL
-    case 0x2C7F: return 0x0240; // LATIN CAPITAL LETTER Z WITH SWASH TAIL
-    case 0x2C80: return 0x2C81; // COPTIC CAPITAL LETTER ALFA
-    case 0x2C82: return 0x2C83; // COPTIC CAPITAL LETTER VIDA
-    case 0x2C84: return 0x2C85; // COPTIC CAPITAL LETTER GAMMA
-    case 0x2C86: return 0x2C87; // COPTIC CAPITAL LETTER DALDA
-    case 0x2C88: return 0x2C89; // COPTIC CAPITAL LETTER EIE
-    case 0x2C8A: return 0x2C8B; // COPTIC CAPITAL LETTER SOU
-    case 0x2C8C: return 0x2C8D; // COPTIC CAPITAL LETTER ZATA
-    case 0x2C8E: return 0x2C8F; // COPTIC CAPITAL LETTER HATE
-    case 0x2C90: return 0x2C91; // COPTIC CAPITAL LETTER THETHE
-    case 0x2C92: return 0x2C93; // COPTIC CAPITAL LETTER IAUDA
-    case 0x2C94: return 0x2C95; // COPTIC CAPITAL LETTER KAPA
-    case 0x2C96: return 0x2C97; // COPTIC CAPITAL LETTER LAULA
-    case 0x2C98: return 0x2C99; // COPTIC CAPITAL LETTER MI
-    case 0x2C9A: return 0x2C9B; // COPTIC CAPITAL LETTER NI
-    case 0x2C9C: return 0x2C9D; // COPTIC CAPITAL LETTER KSI
-    case 0x2C9E: return 0x2C9F; // COPTIC CAPITAL LETTER O
-    case 0x2CA0: return 0x2CA1; // COPTIC CAPITAL LETTER PI
-    case 0x2CA2: return 0x2CA3; // COPTIC CAPITAL LETTER RO
-    case 0x2CA4: return 0x2CA5; // COPTIC CAPITAL LETTER SIMA
-    case 0x2CA6: return 0x2CA7; // COPTIC CAPITAL LETTER TAU
-    case 0x2CA8: return 0x2CA9; // COPTIC CAPITAL LETTER UA
-    case 0x2CAA: return 0x2CAB; // COPTIC CAPITAL LETTER FI
-    case 0x2CAC: return 0x2CAD; // COPTIC CAPITAL LETTER KHI
-    case 0x2CAE: return 0x2CAF; // COPTIC CAPITAL LETTER PSI
-    case 0x2CB0: return 0x2CB1; // COPTIC CAPITAL LETTER OOU
-    case 0x2CB2: return 0x2CB3; // COPTIC CAPITAL LETTER DIALECT-P ALEF
-    case 0x2CB4: return 0x2CB5; // COPTIC CAPITAL LETTER OLD COPTIC AIN
-    case 0x2CB6: return 0x2CB7; // COPTIC CAPITAL LETTER CRYPTOGRAMMIC EIE
-    case 0x2CB8: return 0x2CB9; // COPTIC CAPITAL LETTER DIALECT-P KAPA
-    case 0x2CBA: return 0x2CBB; // COPTIC CAPITAL LETTER DIALECT-P NI
-    case 0x2CBC: return 0x2CBD; // COPTIC CAPITAL LETTER CRYPTOGRAMMIC NI
-    case 0x2CBE: return 0x2CBF; // COPTIC CAPITAL LETTER OLD COPTIC OOU
-    case 0x2CC0: return 0x2CC1; // COPTIC CAPITAL LETTER SAMPI
-    case 0x2CC2: return 0x2CC3; // COPTIC CAPITAL LETTER CROSSED SHEI
-    case 0x2CC4: return 0x2CC5; // COPTIC CAPITAL LETTER OLD COPTIC SHEI
-    case 0x2CC6: return 0x2CC7; // COPTIC CAPITAL LETTER OLD COPTIC ESH
-    case 0x2CC8: return 0x2CC9; // COPTIC CAPITAL LETTER AKHMIMIC KHEI
-    case 0x2CCA: return 0x2CCB; // COPTIC CAPITAL LETTER DIALECT-P HORI
-    case 0x2CCC: return 0x2CCD; // COPTIC CAPITAL LETTER OLD COPTIC HORI
-    case 0x2CCE: return 0x2CCF; // COPTIC CAPITAL LETTER OLD COPTIC HA
-    case 0x2CD0: return 0x2CD1; // COPTIC CAPITAL LETTER L-SHAPED HA
-    case 0x2CD2: return 0x2CD3; // COPTIC CAPITAL LETTER OLD COPTIC HEI
-    case 0x2CD4: return 0x2CD5; // COPTIC CAPITAL LETTER OLD COPTIC HAT
-    case 0x2CD6: return 0x2CD7; // COPTIC CAPITAL LETTER OLD COPTIC GANGIA
-    case 0x2CD8: return 0x2CD9; // COPTIC CAPITAL LETTER OLD COPTIC DJA
-    case 0x2CDA: return 0x2CDB; // COPTIC CAPITAL LETTER OLD COPTIC SHIMA
-    case 0x2CDC: return 0x2CDD; // COPTIC CAPITAL LETTER OLD NUBIAN SHIMA
-    case 0x2CDE: return 0x2CDF; // COPTIC CAPITAL LETTER OLD NUBIAN NGI
-    case 0x2CE0: return 0x2CE1; // COPTIC CAPITAL LETTER OLD NUBIAN NYI
-    case 0x2CE2: return 0x2CE3; // COPTIC CAPITAL LETTER OLD NUBIAN WAU
-    case 0x2CEB: return 0x2CEC; // COPTIC CAPITAL LETTER CRYPTOGRAMMIC SHEI
-    case 0x2CED: return 0x2CEE; // COPTIC CAPITAL LETTER CRYPTOGRAMMIC GANGIA
-    case 0x2CF2: return 0x2CF3; // COPTIC CAPITAL LETTER BOHAIRIC KHEI
-    case 0xA640: return 0xA641; // CYRILLIC CAPITAL LETTER ZEMLYA
-    case 0xA642: return 0xA643; // CYRILLIC CAPITAL LETTER DZELO
-    case 0xA644: return 0xA645; // CYRILLIC CAPITAL LETTER REVERSED DZE
-    case 0xA646: return 0xA647; // CYRILLIC CAPITAL LETTER IOTA
-    case 0xA648: return 0xA649; // CYRILLIC CAPITAL LETTER DJERV
-    case 0xA64A: return 0xA64B; // CYRILLIC CAPITAL LETTER MONOGRAPH UK
-    case 0xA64C: return 0xA64D; // CYRILLIC CAPITAL LETTER BROAD OMEGA
-    case 0xA64E: return 0xA64F; // CYRILLIC CAPITAL LETTER NEUTRAL YER
-    case 0xA650: return 0xA651; // CYRILLIC CAPITAL LETTER YERU WITH BACK YER
-    case 0xA652: return 0xA653; // CYRILLIC CAPITAL LETTER IOTIFIED YAT
-    case 0xA654: return 0xA655; // CYRILLIC CAPITAL LETTER REVERSED YU
-    case 0xA656: return 0xA657; // CYRILLIC CAPITAL LETTER IOTIFIED A
-    case 0xA658: return 0xA659; // CYRILLIC CAPITAL LETTER CLOSED LITTLE YUS
-    case 0xA65A: return 0xA65B; // CYRILLIC CAPITAL LETTER BLENDED YUS
-    case 0xA65C: return 0xA65D; // CYRILLIC CAPITAL LETTER IOTIFIED CLOSED LITTLE YUS
-    case 0xA65E: return 0xA65F; // CYRILLIC CAPITAL LETTER YN
-    case 0xA660: return 0xA661; // CYRILLIC CAPITAL LETTER REVERSED TSE
-    case 0xA662: return 0xA663; // CYRILLIC CAPITAL LETTER SOFT DE
-    case 0xA664: return 0xA665; // CYRILLIC CAPITAL LETTER SOFT EL
-    case 0xA666: return 0xA667; // CYRILLIC CAPITAL LETTER SOFT EM
-    case 0xA668: return 0xA669; // CYRILLIC CAPITAL LETTER MONOCULAR O
-    case 0xA66A: return 0xA66B; // CYRILLIC CAPITAL LETTER BINOCULAR O
-    case 0xA66C: return 0xA66D; // CYRILLIC CAPITAL LETTER DOUBLE MONOCULAR O
-    case 0xA680: return 0xA681; // CYRILLIC CAPITAL LETTER DWE
-    case 0xA682: return 0xA683; // CYRILLIC CAPITAL LETTER DZWE
-    case 0xA684: return 0xA685; // CYRILLIC CAPITAL LETTER ZHWE
-    case 0xA686: return 0xA687; // CYRILLIC CAPITAL LETTER CCHE
-    case 0xA688: return 0xA689; // CYRILLIC CAPITAL LETTER DZZE
-    case 0xA68A: return 0xA68B; // CYRILLIC CAPITAL LETTER TE WITH MIDDLE HOOK
-    case 0xA68C: return 0xA68D; // CYRILLIC CAPITAL LETTER TWE
-    case 0xA68E: return 0xA68F; // CYRILLIC CAPITAL LETTER TSWE
-    case 0xA690: return 0xA691; // CYRILLIC CAPITAL LETTER TSSE
-    case 0xA692: return 0xA693; // CYRILLIC CAPITAL LETTER TCHE
-    case 0xA694: return 0xA695; // CYRILLIC CAPITAL LETTER HWE
-    case 0xA696: return 0xA697; // CYRILLIC CAPITAL LETTER SHWE
-    case 0xA698: return 0xA699; // CYRILLIC CAPITAL LETTER DOUBLE O
-    case 0xA69A: return 0xA69B; // CYRILLIC CAPITAL LETTER CROSSED O
-    case 0xA722: return 0xA723; // LATIN CAPITAL LETTER EGYPTOLOGICAL ALEF
-    case 0xA724: return 0xA725; // LATIN CAPITAL LETTER EGYPTOLOGICAL AIN
-    case 0xA726: return 0xA727; // LATIN CAPITAL LETTER HENG
-    case 0xA728: return 0xA729; // LATIN CAPITAL LETTER TZ
-    case 0xA72A: return 0xA72B; // LATIN CAPITAL LETTER TRESILLO
-    case 0xA72C: return 0xA72D; // LATIN CAPITAL LETTER CUATRILLO
-    case 0xA72E: return 0xA72F; // LATIN CAPITAL LETTER CUATRILLO WITH COMMA
-    case 0xA732: return 0xA733; // LATIN CAPITAL LETTER AA
-    case 0xA734: return 0xA735; // LATIN CAPITAL LETTER AO
-    case 0xA736: return 0xA737; // LATIN CAPITAL LETTER AU
-    case 0xA738: return 0xA739; // LATIN CAPITAL LETTER AV
-    case 0xA73A: return 0xA73B; // LATIN CAPITAL LETTER AV WITH HORIZONTAL BAR
-    case 0xA73C: return 0xA73D; // LATIN CAPITAL LETTER AY
-    case 0xA73E: return 0xA73F; // LATIN CAPITAL LETTER REVERSED C WITH DOT
-    case 0xA740: return 0xA741; // LATIN CAPITAL LETTER K WITH STROKE
-    case 0xA742: return 0xA743; // LATIN CAPITAL LETTER K WITH DIAGONAL STROKE
-    case 0xA744: return 0xA745; // LATIN CAPITAL LETTER K WITH STROKE AND DIAGONAL STROKE
-    case 0xA746: return 0xA747; // LATIN CAPITAL LETTER BROKEN L
-    case 0xA748: return 0xA749; // LATIN CAPITAL LETTER L WITH HIGH STROKE
-    case 0xA74A: return 0xA74B; // LATIN CAPITAL LETTER O WITH LONG STROKE OVERLAY
-    case 0xA74C: return 0xA74D; // LATIN CAPITAL LETTER O WITH LOOP
-    case 0xA74E: return 0xA74F; // LATIN CAPITAL LETTER OO
-    case 0xA750: return 0xA751; // LATIN CAPITAL LETTER P WITH STROKE THROUGH DESCENDER
-    case 0xA752: return 0xA753; // LATIN CAPITAL LETTER P WITH FLOURISH
-    case 0xA754: return 0xA755; // LATIN CAPITAL LETTER P WITH SQUIRREL TAIL
-    case 0xA756: return 0xA757; // LATIN CAPITAL LETTER Q WITH STROKE THROUGH DESCENDER
-    case 0xA758: return 0xA759; // LATIN CAPITAL LETTER Q WITH DIAGONAL STROKE
-    case 0xA75A: return 0xA75B; // LATIN CAPITAL LETTER R ROTUNDA
-    case 0xA75C: return 0xA75D; // LATIN CAPITAL LETTER RUM ROTUNDA
-    case 0xA75E: return 0xA75F; // LATIN CAPITAL LETTER V WITH DIAGONAL STROKE
-    case 0xA760: return 0xA761; // LATIN CAPITAL LETTER VY
-    case 0xA762: return 0xA763; // LATIN CAPITAL LETTER VISIGOTHIC Z
-    case 0xA764: return 0xA765; // LATIN CAPITAL LETTER THORN WITH STROKE
-    case 0xA766: return 0xA767; // LATIN CAPITAL LETTER THORN WITH STROKE THROUGH DESCENDER
-    case 0xA768: return 0xA769; // LATIN CAPITAL LETTER VEND
-    case 0xA76A: return 0xA76B; // LATIN CAPITAL LETTER ET
-    case 0xA76C: return 0xA76D; // LATIN CAPITAL LETTER IS
-    case 0xA76E: return 0xA76F; // LATIN CAPITAL LETTER CON
-    case 0xA779: return 0xA77A; // LATIN CAPITAL LETTER INSULAR D
-    case 0xA77B: return 0xA77C; // LATIN CAPITAL LETTER INSULAR F
-    case 0xA77D: return 0x1D79; // LATIN CAPITAL LETTER INSULAR G
-    case 0xA77E: return 0xA77F; // LATIN CAPITAL LETTER TURNED INSULAR G
-    case 0xA780: return 0xA781; // LATIN CAPITAL LETTER TURNED L
-    case 0xA782: return 0xA783; // LATIN CAPITAL LETTER INSULAR R
-    case 0xA784: return 0xA785; // LATIN CAPITAL LETTER INSULAR S
-    case 0xA786: return 0xA787; // LATIN CAPITAL LETTER INSULAR T
-    case 0xA78B: return 0xA78C; // LATIN CAPITAL LETTER SALTILLO
-    case 0xA78D: return 0x0265; // LATIN CAPITAL LETTER TURNED H
-    case 0xA790: return 0xA791; // LATIN CAPITAL LETTER N WITH DESCENDER
-    case 0xA792: return 0xA793; // LATIN CAPITAL LETTER C WITH BAR
-    case 0xA796: return 0xA797; // LATIN CAPITAL LETTER B WITH FLOURISH
-    case 0xA798: return 0xA799; // LATIN CAPITAL LETTER F WITH STROKE
-    case 0xA79A: return 0xA79B; // LATIN CAPITAL LETTER VOLAPUK AE
-    case 0xA79C: return 0xA79D; // LATIN CAPITAL LETTER VOLAPUK OE
-    case 0xA79E: return 0xA79F; // LATIN CAPITAL LETTER VOLAPUK UE
-    case 0xA7A0: return 0xA7A1; // LATIN CAPITAL LETTER G WITH OBLIQUE STROKE
-    case 0xA7A2: return 0xA7A3; // LATIN CAPITAL LETTER K WITH OBLIQUE STROKE
-    case 0xA7A4: return 0xA7A5; // LATIN CAPITAL LETTER N WITH OBLIQUE STROKE
-    case 0xA7A6: return 0xA7A7; // LATIN CAPITAL LETTER R WITH OBLIQUE STROKE
-    case 0xA7A8: return 0xA7A9; // LATIN CAPITAL LETTER S WITH OBLIQUE STROKE
-    case 0xA7AA: return 0x0266; // LATIN CAPITAL LETTER H WITH HOOK
-    case 0xA7AB: return 0x025C; // LATIN CAPITAL LETTER REVERSED OPEN E
-    case 0xA7AC: return 0x0261; // LATIN CAPITAL LETTER SCRIPT G
-    case 0xA7AD: return 0x026C; // LATIN CAPITAL LETTER L WITH BELT
-    case 0xA7B0: return 0x029E; // LATIN CAPITAL LETTER TURNED K
-    case 0xA7B1: return 0x0287; // LATIN CAPITAL LETTER TURNED T
-    case 0xFF21: return 0xFF41; // FULLWIDTH LATIN CAPITAL LETTER A
-    case 0xFF22: return 0xFF42; // FULLWIDTH LATIN CAPITAL LETTER B
-    case 0xFF23: return 0xFF43; // FULLWIDTH LATIN CAPITAL LETTER C
-    case 0xFF24: return 0xFF44; // FULLWIDTH LATIN CAPITAL LETTER D
-    case 0xFF25: return 0xFF45; // FULLWIDTH LATIN CAPITAL LETTER E
-    case 0xFF26: return 0xFF46; // FULLWIDTH LATIN CAPITAL LETTER F
-    case 0xFF27: return 0xFF47; // FULLWIDTH LATIN CAPITAL LETTER G
-    case 0xFF28: return 0xFF48; // FULLWIDTH LATIN CAPITAL LETTER H
-    case 0xFF29: return 0xFF49; // FULLWIDTH LATIN CAPITAL LETTER I
-    case 0xFF2A: return 0xFF4A; // FULLWIDTH LATIN CAPITAL LETTER J
-    case 0xFF2B: return 0xFF4B; // FULLWIDTH LATIN CAPITAL LETTER K
-    case 0xFF2C: return 0xFF4C; // FULLWIDTH LATIN CAPITAL LETTER L
-    case 0xFF2D: return 0xFF4D; // FULLWIDTH LATIN CAPITAL LETTER M
-    case 0xFF2E: return 0xFF4E; // FULLWIDTH LATIN CAPITAL LETTER N
-    case 0xFF2F: return 0xFF4F; // FULLWIDTH LATIN CAPITAL LETTER O
-    case 0xFF30: return 0xFF50; // FULLWIDTH LATIN CAPITAL LETTER P
-    case 0xFF31: return 0xFF51; // FULLWIDTH LATIN CAPITAL LETTER Q
-    case 0xFF32: return 0xFF52; // FULLWIDTH LATIN CAPITAL LETTER R
-    case 0xFF33: return 0xFF53; // FULLWIDTH LATIN CAPITAL LETTER S
-    case 0xFF34: return 0xFF54; // FULLWIDTH LATIN CAPITAL LETTER T
-    case 0xFF35: return 0xFF55; // FULLWIDTH LATIN CAPITAL LETTER U
-    case 0xFF36: return 0xFF56; // FULLWIDTH LATIN CAPITAL LETTER V
-    case 0xFF37: return 0xFF57; // FULLWIDTH LATIN CAPITAL LETTER W
-    case 0xFF38: return 0xFF58; // FULLWIDTH LATIN CAPITAL LETTER X
-    case 0xFF39: return 0xFF59; // FULLWIDTH LATIN CAPITAL LETTER Y
-    case 0xFF3A: return 0xFF5A; // FULLWIDTH LATIN CAPITAL LETTER Z
-    case 0x10400: return 0x10428; // DESERET CAPITAL LETTER LONG I
-    case 0x10401: return 0x10429; // DESERET CAPITAL LETTER LONG E
-    case 0x10402: return 0x1042A; // DESERET CAPITAL LETTER LONG A
-    case 0x10403: return 0x1042B; // DESERET CAPITAL LETTER LONG AH
-    case 0x10404: return 0x1042C; // DESERET CAPITAL LETTER LONG O
-    case 0x10405: return 0x1042D; // DESERET CAPITAL LETTER LONG OO
-    case 0x10406: return 0x1042E; // DESERET CAPITAL LETTER SHORT I
-    case 0x10407: return 0x1042F; // DESERET CAPITAL LETTER SHORT E
-    case 0x10408: return 0x10430; // DESERET CAPITAL LETTER SHORT A
-    case 0x10409: return 0x10431; // DESERET CAPITAL LETTER SHORT AH
-    case 0x1040A: return 0x10432; // DESERET CAPITAL LETTER SHORT O
-    case 0x1040B: return 0x10433; // DESERET CAPITAL LETTER SHORT OO
-    case 0x1040C: return 0x10434; // DESERET CAPITAL LETTER AY
-    case 0x1040D: return 0x10435; // DESERET CAPITAL LETTER OW
-    case 0x1040E: return 0x10436; // DESERET CAPITAL LETTER WU
-    case 0x1040F: return 0x10437; // DESERET CAPITAL LETTER YEE
-    case 0x10410: return 0x10438; // DESERET CAPITAL LETTER H
-    case 0x10411: return 0x10439; // DESERET CAPITAL LETTER PEE
-    case 0x10412: return 0x1043A; // DESERET CAPITAL LETTER BEE
-    case 0x10413: return 0x1043B; // DESERET CAPITAL LETTER TEE
-    case 0x10414: return 0x1043C; // DESERET CAPITAL LETTER DEE
-    case 0x10415: return 0x1043D; // DESERET CAPITAL LETTER CHEE
-    case 0x10416: return 0x1043E; // DESERET CAPITAL LETTER JEE
-    case 0x10417: return 0x1043F; // DESERET CAPITAL LETTER KAY
-    case 0x10418: return 0x10440; // DESERET CAPITAL LETTER GAY
-    case 0x10419: return 0x10441; // DESERET CAPITAL LETTER EF
-    case 0x1041A: return 0x10442; // DESERET CAPITAL LETTER VEE
-    case 0x1041B: return 0x10443; // DESERET CAPITAL LETTER ETH
-    case 0x1041C: return 0x10444; // DESERET CAPITAL LETTER THEE
-    case 0x1041D: return 0x10445; // DESERET CAPITAL LETTER ES
-    case 0x1041E: return 0x10446; // DESERET CAPITAL LETTER ZEE
-    case 0x1041F: return 0x10447; // DESERET CAPITAL LETTER ESH
-    case 0x10420: return 0x10448; // DESERET CAPITAL LETTER ZHEE
-    case 0x10421: return 0x10449; // DESERET CAPITAL LETTER ER
-    case 0x10422: return 0x1044A; // DESERET CAPITAL LETTER EL
-    case 0x10423: return 0x1044B; // DESERET CAPITAL LETTER EM
-    case 0x10424: return 0x1044C; // DESERET CAPITAL LETTER EN
-    case 0x10425: return 0x1044D; // DESERET CAPITAL LETTER ENG
-    case 0x10426: return 0x1044E; // DESERET CAPITAL LETTER OI
-    case 0x10427: return 0x1044F; // DESERET CAPITAL LETTER EW
-    case 0x118A0: return 0x118C0; // WARANG CITI CAPITAL LETTER NGAA
-    case 0x118A1: return 0x118C1; // WARANG CITI CAPITAL LETTER A
-    case 0x118A2: return 0x118C2; // WARANG CITI CAPITAL LETTER WI
-    case 0x118A3: return 0x118C3; // WARANG CITI CAPITAL LETTER YU
-    case 0x118A4: return 0x118C4; // WARANG CITI CAPITAL LETTER YA
-    case 0x118A5: return 0x118C5; // WARANG CITI CAPITAL LETTER YO
-    case 0x118A6: return 0x118C6; // WARANG CITI CAPITAL LETTER II
-    case 0x118A7: return 0x118C7; // WARANG CITI CAPITAL LETTER UU
-    case 0x118A8: return 0x118C8; // WARANG CITI CAPITAL LETTER E
-    case 0x118A9: return 0x118C9; // WARANG CITI CAPITAL LETTER O
-    case 0x118AA: return 0x118CA; // WARANG CITI CAPITAL LETTER ANG
-    case 0x118AB: return 0x118CB; // WARANG CITI CAPITAL LETTER GA
-    case 0x118AC: return 0x118CC; // WARANG CITI CAPITAL LETTER KO
-    case 0x118AD: return 0x118CD; // WARANG CITI CAPITAL LETTER ENY
-    case 0x118AE: return 0x118CE; // WARANG CITI CAPITAL LETTER YUJ
-    case 0x118AF: return 0x118CF; // WARANG CITI CAPITAL LETTER UC
-    case 0x118B0: return 0x118D0; // WARANG CITI CAPITAL LETTER ENN
-    case 0x118B1: return 0x118D1; // WARANG CITI CAPITAL LETTER ODD
-    case 0x118B2: return 0x118D2; // WARANG CITI CAPITAL LETTER TTE
-    case 0x118B3: return 0x118D3; // WARANG CITI CAPITAL LETTER NUNG
-    case 0x118B4: return 0x118D4; // WARANG CITI CAPITAL LETTER DA
-    case 0x118B5: return 0x118D5; // WARANG CITI CAPITAL LETTER AT
-    case 0x118B6: return 0x118D6; // WARANG CITI CAPITAL LETTER AM
-    case 0x118B7: return 0x118D7; // WARANG CITI CAPITAL LETTER BU
-    case 0x118B8: return 0x118D8; // WARANG CITI CAPITAL LETTER PU
-    case 0x118B9: return 0x118D9; // WARANG CITI CAPITAL LETTER HIYO
-    case 0x118BA: return 0x118DA; // WARANG CITI CAPITAL LETTER HOLO
-    case 0x118BB: return 0x118DB; // WARANG CITI CAPITAL LETTER HORR
-    case 0x118BC: return 0x118DC; // WARANG CITI CAPITAL LETTER HAR
-    case 0x118BD: return 0x118DD; // WARANG CITI CAPITAL LETTER SSUU
-    case 0x118BE: return 0x118DE; // WARANG CITI CAPITAL LETTER SII
-    case 0x118BF: return 0x118DF; // WARANG CITI CAPITAL LETTER VIYO
-    default: return uc; // Not folded
+  return (uc < caseFoldLimit) ? uc + caseFoldDeltas[caseFoldIndex[uc >> 7]][uc & 0x7f] : uc;
+}
+
+static const u32 caseUnfoldKeys[1454] = {
+  0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6A,0x6B,0x6B,
+  0x6C,0x6D,0x6E,0x6F,0x70,0x71,0x72,0x73,0x73,0x74,0x75,0x76,
+  0x77,0x78,0x79,0x7A,0xDF,0xE0,0xE1,0xE2,0xE3,0xE4,0xE5,0xE5,
+  0xE6,0xE7,0xE8,0xE9,0xEA,0xEB,0xEC,0xED,0xEE,0xEF,0xF0,0xF1,
+  0xF2,0xF3,0xF4,0xF5,0xF6,0xF8,0xF9,0xFA,0xFB,0xFC,0xFD,0xFE,
+  0xFF,0x101,0x103,0x105,0x107,0x109,0x10B,0x10D,0x10F,0x111,0x113,0x115,
+  0x117,0x119,0x11B,0x11D,0x11F,0x121,0x123,0x125,0x127,0x129,0x12B,0x12D,
+  0x12F,0x133,0x135,0x137,0x13A,0x13C,0x13E,0x140,0x142,0x144,0x146,0x148,
+  0x14B,0x14D,0x14F,0x151,0x153,0x155,0x157,0x159,0x15B,0x15D,0x15F,0x161,
+  0x163,0x165,0x167,0x169,0x16B,0x16D,0x16F,0x171,0x173,0x175,0x177,0x17A,
+  0x17C,0x17E,0x180,0x183,0x185,0x188,0x18C,0x192,0x195,0x199,0x19A,0x19E,
+  0x1A1,0x1A3,0x1A5,0x1A8,0x1AD,0x1B0,0x1B4,0x1B6,0x1B9,0x1BD,0x1BF,0x1C6,
+  0x1C6,0x1C9,0x1C9,0x1CC,0x1CC,0x1CE,0x1D0,0x1D2,0x1D4,0x1D6,0x1D8,0x1DA,
+  0x1DC,0x1DD,0x1DF,0x1E1,0x1E3,0x1E5,0x1E7,0x1E9,0x1EB,0x1ED,0x1EF,0x1F3,
+  0x1F3,0x1F5,0x1F9,0x1FB,0x1FD,0x1FF,0x201,0x203,0x205,0x207,0x209,0x20B,
+  0x20D,0x20F,0x211,0x213,0x215,0x217,0x219,0x21B,0x21D,0x21F,0x223,0x225,
+  0x227,0x229,0x22B,0x22D,0x22F,0x231,0x233,0x23C,0x23F,0x240,0x242,0x247,
+  0x249,0x24B,0x24D,0x24F,0x250,0x251,0x252,0x253,0x254,0x256,0x257,0x259,
+  0x25B,0x25C,0x260,0x261,0x263,0x265,0x266,0x268,0x269,0x26A,0x26B,0x26C,
+  0x26F,0x271,0x272,0x275,0x27D,0x280,0x282,0x283,0x287,0x288,0x289,0x28A,
+  0x28B,0x28C,0x292,0x29D,0x29E,0x371,0x373,0x377,0x37B,0x37C,0x37D,0x3AC,
+  0x3AD,0x3AE,0x3AF,0x3B1,0x3B2,0x3B2,0x3B3,0x3B4,0x3B5,0x3B5,0x3B6,0x3B7,
+  0x3B8,0x3B8,0x3B8,0x3B9,0x3B9,0x3B9,0x3BA,0x3BA,0x3BB,0x3BC,0x3BC,0x3BD,
+  0x3BE,0x3BF,0x3C0,0x3C0,0x3C1,0x3C1,0x3C3,0x3C3,0x3C4,0x3C5,0x3C6,0x3C6,
+  0x3C7,0x3C8,0x3C9,0x3C9,0x3CA,0x3CB,0x3CC,0x3CD,0x3CE,0x3D7,0x3D9,0x3DB,
+  0x3DD,0x3DF,0x3E1,0x3E3,0x3E5,0x3E7,0x3E9,0x3EB,0x3ED,0x3EF,0x3F2,0x3F3,
+  0x3F8,0x3FB,0x430,0x431,0x432,0x432,0x433,0x434,0x434,0x435,0x436,0x437,
+  0x438,0x439,0x43A,0x43B,0x43C,0x43D,0x43E,0x43E,0x43F,0x440,0x441,0x441,
+  0x442,0x442,0x442,0x443,0x444,0x445,0x446,0x447,0x448,0x449,0x44A,0x44A,
+  0x44B,0x44C,0x44D,0x44E,0x44F,0x450,0x451,0x452,0x453,0x454,0x455,0x456,
+  0x457,0x458,0x459,0x45A,0x45B,0x45C,0x45D,0x45E,0x45F,0x461,0x463,0x463,
+  0x465,0x467,0x469,0x46B,0x46D,0x46F,0x471,0x473,0x475,0x477,0x479,0x47B,
+  0x47D,0x47F,0x481,0x48B,0x48D,0x48F,0x491,0x493,0x495,0x497,0x499,0x49B,
+  0x49D,0x49F,0x4A1,0x4A3,0x4A5,0x4A7,0x4A9,0x4AB,0x4AD,0x4AF,0x4B1,0x4B3,
+  0x4B5,0x4B7,0x4B9,0x4BB,0x4BD,0x4BF,0x4C2,0x4C4,0x4C6,0x4C8,0x4CA,0x4CC,
+  0x4CE,0x4CF,0x4D1,0x4D3,0x4D5,0x4D7,0x4D9,0x4DB,0x4DD,0x4DF,0x4E1,0x4E3,
+  0x4E5,0x4E7,0x4E9,0x4EB,0x4ED,0x4EF,0x4F1,0x4F3,0x4F5,0x4F7,0x4F9,0x4FB,
+  0x4FD,0x4FF,0x501,0x503,0x505,0x507,0x509,0x50B,0x50D,0x50F,0x511,0x513,
+  0x515,0x517,0x519,0x51B,0x51D,0x51F,0x521,0x523,0x525,0x527,0x529,0x52B,
+  0x52D,0x52F,0x561,0x562,0x563,0x564,0x565,0x566,0x567,0x568,0x569,0x56A,
+  0x56B,0x56C,0x56D,0x56E,0x56F,0x570,0x571,0x572,0x573,0x574,0x575,0x576,
+  0x577,0x578,0x579,0x57A,0x57B,0x57C,0x57D,0x57E,0x57F,0x580,0x581,0x582,
+  0x583,0x584,0x585,0x586,0x10D0,0x10D1,0x10D2,0x10D3,0x10D4,0x10D5,0x10D6,0x10D7,
+  0x10D8,0x10D9,0x10DA,0x10DB,0x10DC,0x10DD,0x10DE,0x10DF,0x10E0,0x10E1,0x10E2,0x10E3,
+  0x10E4,0x10E5,0x10E6,0x10E7,0x10E8,0x10E9,0x10EA,0x10EB,0x10EC,0x10ED,0x10EE,0x10EF,
+  0x10F0,0x10F1,0x10F2,0x10F3,0x10F4,0x10F5,0x10F6,0x10F7,0x10F8,0x10F9,0x10FA,0x10FD,
+  0x10FE,0x10FF,0x13A0,0x13A1,0x13A2,0x13A3,0x13A4,0x13A5,0x13A6,0x13A7,0x13A8,0x13A9,
+  0x13AA,0x13AB,0x13AC,0x13AD,0x13AE,0x13AF,0x13B0,0x13B1,0x13B2,0x13B3,0x13B4,0x13B5,
+  0x13B6,0x13B7,0x13B8,0x13B9,0x13BA,0x13BB,0x13BC,0x13BD,0x13BE,0x13BF,0x13C0,0x13C1,
+  0x13C2,0x13C3,0x13C4,0x13C5,0x13C6,0x13C7,0x13C8,0x13C9,0x13CA,0x13CB,0x13CC,0x13CD,
+  0x13CE,0x13CF,0x13D0,0x13D1,0x13D2,0x13D3,0x13D4,0x13D5,0x13D6,0x13D7,0x13D8,0x13D9,
+  0x13DA,0x13DB,0x13DC,0x13DD,0x13DE,0x13DF,0x13E0,0x13E1,0x13E2,0x13E3,0x13E4,0x13E5,
+  0x13E6,0x13E7,0x13E8,0x13E9,0x13EA,0x13EB,0x13EC,0x13ED,0x13EE,0x13EF,0x13F0,0x13F1,
+  0x13F2,0x13F3,0x13F4,0x13F5,0x1D79,0x1D7D,0x1D8E,0x1E01,0x1E03,0x1E05,0x1E07,0x1E09,
+  0x1E0B,0x1E0D,0x1E0F,0x1E11,0x1E13,0x1E15,0x1E17,0x1E19,0x1E1B,0x1E1D,0x1E1F,0x1E21,
+  0x1E23,0x1E25,0x1E27,0x1E29,0x1E2B,0x1E2D,0x1E2F,0x1E31,0x1E33,0x1E35,0x1E37,0x1E39,
+  0x1E3B,0x1E3D,0x1E3F,0x1E41,0x1E43,0x1E45,0x1E47,0x1E49,0x1E4B,0x1E4D,0x1E4F,0x1E51,
+  0x1E53,0x1E55,0x1E57,0x1E59,0x1E5B,0x1E5D,0x1E5F,0x1E61,0x1E61,0x1E63,0x1E65,0x1E67,
+  0x1E69,0x1E6B,0x1E6D,0x1E6F,0x1E71,0x1E73,0x1E75,0x1E77,0x1E79,0x1E7B,0x1E7D,0x1E7F,
+  0x1E81,0x1E83,0x1E85,0x1E87,0x1E89,0x1E8B,0x1E8D,0x1E8F,0x1E91,0x1E93,0x1E95,0x1EA1,
+  0x1EA3,0x1EA5,0x1EA7,0x1EA9,0x1EAB,0x1EAD,0x1EAF,0x1EB1,0x1EB3,0x1EB5,0x1EB7,0x1EB9,
+  0x1EBB,0x1EBD,0x1EBF,0x1EC1,0x1EC3,0x1EC5,0x1EC7,0x1EC9,0x1ECB,0x1ECD,0x1ECF,0x1ED1,
+  0x1ED3,0x1ED5,0x1ED7,0x1ED9,0x1EDB,0x1EDD,0x1EDF,0x1EE1,0x1EE3,0x1EE5,0x1EE7,0x1EE9,
+  0x1EEB,0x1EED,0x1EEF,0x1EF1,0x1EF3,0x1EF5,0x1EF7,0x1EF9,0x1EFB,0x1EFD,0x1EFF,0x1F00,
+  0x1F01,0x1F02,0x1F03,0x1F04,0x1F05,0x1F06,0x1F07,0x1F10,0x1F11,0x1F12,0x1F13,0x1F14,
+  0x1F15,0x1F20,0x1F21,0x1F22,0x1F23,0x1F24,0x1F25,0x1F26,0x1F27,0x1F30,0x1F31,0x1F32,
+  0x1F33,0x1F34,0x1F35,0x1F36,0x1F37,0x1F40,0x1F41,0x1F42,0x1F43,0x1F44,0x1F45,0x1F51,
+  0x1F53,0x1F55,0x1F57,0x1F60,0x1F61,0x1F62,0x1F63,0x1F64,0x1F65,0x1F66,0x1F67,0x1F70,
+  0x1F71,0x1F72,0x1F73,0x1F74,0x1F75,0x1F76,0x1F77,0x1F78,0x1F79,0x1F7A,0x1F7B,0x1F7C,
+  0x1F7D,0x1F80,0x1F81,0x1F82,0x1F83,0x1F84,0x1F85,0x1F86,0x1F87,0x1F90,0x1F91,0x1F92,
+  0x1F93,0x1F94,0x1F95,0x1F96,0x1F97,0x1FA0,0x1FA1,0x1FA2,0x1FA3,0x1FA4,0x1FA5,0x1FA6,
+  0x1FA7,0x1FB0,0x1FB1,0x1FB3,0x1FC3,0x1FD0,0x1FD1,0x1FE0,0x1FE1,0x1FE5,0x1FF3,0x214E,
+  0x2170,0x2171,0x2172,0x2173,0x2174,0x2175,0x2176,0x2177,0x2178,0x2179,0x217A,0x217B,
+  0x217C,0x217D,0x217E,0x217F,0x2184,0x24D0,0x24D1,0x24D2,0x24D3,0x24D4,0x24D5,0x24D6,
+  0x24D7,0x24D8,0x24D9,0x24DA,0x24DB,0x24DC,0x24DD,0x24DE,0x24DF,0x24E0,0x24E1,0x24E2,
+  0x24E3,0x24E4,0x24E5,0x24E6,0x24E7,0x24E8,0x24E9,0x2C30,0x2C31,0x2C32,0x2C33,0x2C34,
+  0x2C35,0x2C36,0x2C37,0x2C38,0x2C39,0x2C3A,0x2C3B,0x2C3C,0x2C3D,0x2C3E,0x2C3F,0x2C40,
+  0x2C41,0x2C42,0x2C43,0x2C44,0x2C45,0x2C46,0x2C47,0x2C48,0x2C49,0x2C4A,0x2C4B,0x2C4C,
+  0x2C4D,0x2C4E,0x2C4F,0x2C50,0x2C51,0x2C52,0x2C53,0x2C54,0x2C55,0x2C56,0x2C57,0x2C58,
+  0x2C59,0x2C5A,0x2C5B,0x2C5C,0x2C5D,0x2C5E,0x2C5F,0x2C61,0x2C65,0x2C66,0x2C68,0x2C6A,
+  0x2C6C,0x2C73,0x2C76,0x2C81,0x2C83,0x2C85,0x2C87,0x2C89,0x2C8B,0x2C8D,0x2C8F,0x2C91,
+  0x2C93,0x2C95,0x2C97,0x2C99,0x2C9B,0x2C9D,0x2C9F,0x2CA1,0x2CA3,0x2CA5,0x2CA7,0x2CA9,
+  0x2CAB,0x2CAD,0x2CAF,0x2CB1,0x2CB3,0x2CB5,0x2CB7,0x2CB9,0x2CBB,0x2CBD,0x2CBF,0x2CC1,
+  0x2CC3,0x2CC5,0x2CC7,0x2CC9,0x2CCB,0x2CCD,0x2CCF,0x2CD1,0x2CD3,0x2CD5,0x2CD7,0x2CD9,
+  0x2CDB,0x2CDD,0x2CDF,0x2CE1,0x2CE3,0x2CEC,0x2CEE,0x2CF3,0x2D00,0x2D01,0x2D02,0x2D03,
+  0x2D04,0x2D05,0x2D06,0x2D07,0x2D08,0x2D09,0x2D0A,0x2D0B,0x2D0C,0x2D0D,0x2D0E,0x2D0F,
+  0x2D10,0x2D11,0x2D12,0x2D13,0x2D14,0x2D15,0x2D16,0x2D17,0x2D18,0x2D19,0x2D1A,0x2D1B,
+  0x2D1C,0x2D1D,0x2D1E,0x2D1F,0x2D20,0x2D21,0x2D22,0x2D23,0x2D24,0x2D25,0x2D27,0x2D2D,
+  0xA641,0xA643,0xA645,0xA647,0xA649,0xA64B,0xA64B,0xA64D,0xA64F,0xA651,0xA653,0xA655,
+  0xA657,0xA659,0xA65B,0xA65D,0xA65F,0xA661,0xA663,0xA665,0xA667,0xA669,0xA66B,0xA66D,
+  0xA681,0xA683,0xA685,0xA687,0xA689,0xA68B,0xA68D,0xA68F,0xA691,0xA693,0xA695,0xA697,
+  0xA699,0xA69B,0xA723,0xA725,0xA727,0xA729,0xA72B,0xA72D,0xA72F,0xA733,0xA735,0xA737,
+  0xA739,0xA73B,0xA73D,0xA73F,0xA741,0xA743,0xA745,0xA747,0xA749,0xA74B,0xA74D,0xA74F,
+  0xA751,0xA753,0xA755,0xA757,0xA759,0xA75B,0xA75D,0xA75F,0xA761,0xA763,0xA765,0xA767,
+  0xA769,0xA76B,0xA76D,0xA76F,0xA77A,0xA77C,0xA77F,0xA781,0xA783,0xA785,0xA787,0xA78C,
+  0xA791,0xA793,0xA794,0xA797,0xA799,0xA79B,0xA79D,0xA79F,0xA7A1,0xA7A3,0xA7A5,0xA7A7,
+  0xA7A9,0xA7B5,0xA7B7,0xA7B9,0xA7BB,0xA7BD,0xA7BF,0xA7C1,0xA7C3,0xA7C8,0xA7CA,0xA7D1,
+  0xA7D7,0xA7D9,0xA7F6,0xAB53,0xFF41,0xFF42,0xFF43,0xFF44,0xFF45,0xFF46,0xFF47,0xFF48,
+  0xFF49,0xFF4A,0xFF4B,0xFF4C,0xFF4D,0xFF4E,0xFF4F,0xFF50,0xFF51,0xFF52,0xFF53,0xFF54,
+  0xFF55,0xFF56,0xFF57,0xFF58,0xFF59,0xFF5A,0x10428,0x10429,0x1042A,0x1042B,0x1042C,0x1042D,
+  0x1042E,0x1042F,0x10430,0x10431,0x10432,0x10433,0x10434,0x10435,0x10436,0x10437,0x10438,0x10439,
+  0x1043A,0x1043B,0x1043C,0x1043D,0x1043E,0x1043F,0x10440,0x10441,0x10442,0x10443,0x10444,0x10445,
+  0x10446,0x10447,0x10448,0x10449,0x1044A,0x1044B,0x1044C,0x1044D,0x1044E,0x1044F,0x104D8,0x104D9,
+  0x104DA,0x104DB,0x104DC,0x104DD,0x104DE,0x104DF,0x104E0,0x104E1,0x104E2,0x104E3,0x104E4,0x104E5,
+  0x104E6,0x104E7,0x104E8,0x104E9,0x104EA,0x104EB,0x104EC,0x104ED,0x104EE,0x104EF,0x104F0,0x104F1,
+  0x104F2,0x104F3,0x104F4,0x104F5,0x104F6,0x104F7,0x104F8,0x104F9,0x104FA,0x104FB,0x10597,0x10598,
+  0x10599,0x1059A,0x1059B,0x1059C,0x1059D,0x1059E,0x1059F,0x105A0,0x105A1,0x105A3,0x105A4,0x105A5,
+  0x105A6,0x105A7,0x105A8,0x105A9,0x105AA,0x105AB,0x105AC,0x105AD,0x105AE,0x105AF,0x105B0,0x105B1,
+  0x105B3,0x105B4,0x105B5,0x105B6,0x105B7,0x105B8,0x105B9,0x105BB,0x105BC,0x10CC0,0x10CC1,0x10CC2,
+  0x10CC3,0x10CC4,0x10CC5,0x10CC6,0x10CC7,0x10CC8,0x10CC9,0x10CCA,0x10CCB,0x10CCC,0x10CCD,0x10CCE,
+  0x10CCF,0x10CD0,0x10CD1,0x10CD2,0x10CD3,0x10CD4,0x10CD5,0x10CD6,0x10CD7,0x10CD8,0x10CD9,0x10CDA,
+  0x10CDB,0x10CDC,0x10CDD,0x10CDE,0x10CDF,0x10CE0,0x10CE1,0x10CE2,0x10CE3,0x10CE4,0x10CE5,0x10CE6,
+  0x10CE7,0x10CE8,0x10CE9,0x10CEA,0x10CEB,0x10CEC,0x10CED,0x10CEE,0x10CEF,0x10CF0,0x10CF1,0x10CF2,
+  0x118C0,0x118C1,0x118C2,0x118C3,0x118C4,0x118C5,0x118C6,0x118C7,0x118C8,0x118C9,0x118CA,0x118CB,
+  0x118CC,0x118CD,0x118CE,0x118CF,0x118D0,0x118D1,0x118D2,0x118D3,0x118D4,0x118D5,0x118D6,0x118D7,
+  0x118D8,0x118D9,0x118DA,0x118DB,0x118DC,0x118DD,0x118DE,0x118DF,0x16E60,0x16E61,0x16E62,0x16E63,
+  0x16E64,0x16E65,0x16E66,0x16E67,0x16E68,0x16E69,0x16E6A,0x16E6B,0x16E6C,0x16E6D,0x16E6E,0x16E6F,
+  0x16E70,0x16E71,0x16E72,0x16E73,0x16E74,0x16E75,0x16E76,0x16E77,0x16E78,0x16E79,0x16E7A,0x16E7B,
+  0x16E7C,0x16E7D,0x16E7E,0x16E7F,0x1E922,0x1E923,0x1E924,0x1E925,0x1E926,0x1E927,0x1E928,0x1E929,
+  0x1E92A,0x1E92B,0x1E92C,0x1E92D,0x1E92E,0x1E92F,0x1E930,0x1E931,0x1E932,0x1E933,0x1E934,0x1E935,
+  0x1E936,0x1E937,0x1E938,0x1E939,0x1E93A,0x1E93B,0x1E93C,0x1E93D,0x1E93E,0x1E93F,0x1E940,0x1E941,
+  0x1E942,0x1E943,
+};
+
+static const u32 caseUnfoldValues[1454] = {
+  0x41,0x42,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4A,0x4B,0x212A,
+  0x4C,0x4D,0x4E,0x4F,0x50,0x51,0x52,0x53,0x17F,0x54,0x55,0x56,
+  0x57,0x58,0x59,0x5A,0x1E9E,0xC0,0xC1,0xC2,0xC3,0xC4,0xC5,0x212B,
+  0xC6,0xC7,0xC8,0xC9,0xCA,0xCB,0xCC,0xCD,0xCE,0xCF,0xD0,0xD1,
+  0xD2,0xD3,0xD4,0xD5,0xD6,0xD8,0xD9,0xDA,0xDB,0xDC,0xDD,0xDE,
+  0x178,0x100,0x102,0x104,0x106,0x108,0x10A,0x10C,0x10E,0x110,0x112,0x114,
+  0x116,0x118,0x11A,0x11C,0x11E,0x120,0x122,0x124,0x126,0x128,0x12A,0x12C,
+  0x12E,0x132,0x134,0x136,0x139,0x13B,0x13D,0x13F,0x141,0x143,0x145,0x147,
+  0x14A,0x14C,0x14E,0x150,0x152,0x154,0x156,0x158,0x15A,0x15C,0x15E,0x160,
+  0x162,0x164,0x166,0x168,0x16A,0x16C,0x16E,0x170,0x172,0x174,0x176,0x179,
+  0x17B,0x17D,0x243,0x182,0x184,0x187,0x18B,0x191,0x1F6,0x198,0x23D,0x220,
+  0x1A0,0x1A2,0x1A4,0x1A7,0x1AC,0x1AF,0x1B3,0x1B5,0x1B8,0x1BC,0x1F7,0x1C4,
+  0x1C5,0x1C7,0x1C8,0x1CA,0x1CB,0x1CD,0x1CF,0x1D1,0x1D3,0x1D5,0x1D7,0x1D9,
+  0x1DB,0x18E,0x1DE,0x1E0,0x1E2,0x1E4,0x1E6,0x1E8,0x1EA,0x1EC,0x1EE,0x1F1,
+  0x1F2,0x1F4,0x1F8,0x1FA,0x1FC,0x1FE,0x200,0x202,0x204,0x206,0x208,0x20A,
+  0x20C,0x20E,0x210,0x212,0x214,0x216,0x218,0x21A,0x21C,0x21E,0x222,0x224,
+  0x226,0x228,0x22A,0x22C,0x22E,0x230,0x232,0x23B,0x2C7E,0x2C7F,0x241,0x246,
+  0x248,0x24A,0x24C,0x24E,0x2C6F,0x2C6D,0x2C70,0x181,0x186,0x189,0x18A,0x18F,
+  0x190,0xA7AB,0x193,0xA7AC,0x194,0xA78D,0xA7AA,0x197,0x196,0xA7AE,0x2C62,0xA7AD,
+  0x19C,0x2C6E,0x19D,0x19F,0x2C64,0x1A6,0xA7C5,0x1A9,0xA7B1,0x1AE,0x244,0x1B1,
+  0x1B2,0x245,0x1B7,0xA7B2,0xA7B0,0x370,0x372,0x376,0x3FD,0x3FE,0x3FF,0x386,
+  0x388,0x389,0x38A,0x391,0x392,0x3D0,0x393,0x394,0x395,0x3F5,0x396,0x397,
+  0x398,0x3D1,0x3F4,0x345,0x399,0x1FBE,0x39A,0x3F0,0x39B,0xB5,0x39C,0x39D,
+  0x39E,0x39F,0x3A0,0x3D6,0x3A1,0x3F1,0x3A3,0x3C2,0x3A4,0x3A5,0x3A6,0x3D5,
+  0x3A7,0x3A8,0x3A9,0x2126,0x3AA,0x3AB,0x38C,0x38E,0x38F,0x3CF,0x3D8,0x3DA,
+  0x3DC,0x3DE,0x3E0,0x3E2,0x3E4,0x3E6,0x3E8,0x3EA,0x3EC,0x3EE,0x3F9,0x37F,
+  0x3F7,0x3FA,0x410,0x411,0x412,0x1C80,0x413,0x414,0x1C81,0x415,0x416,0x417,
+  0x418,0x419,0x41A,0x41B,0x41C,0x41D,0x41E,0x1C82,0x41F,0x420,0x421,0x1C83,
+  0x422,0x1C84,0x1C85,0x423,0x424,0x425,0x426,0x427,0x428,0x429,0x42A,0x1C86,
+  0x42B,0x42C,0x42D,0x42E,0x42F,0x400,0x401,0x402,0x403,0x404,0x405,0x406,
+  0x407,0x408,0x409,0x40A,0x40B,0x40C,0x40D,0x40E,0x40F,0x460,0x462,0x1C87,
+  0x464,0x466,0x468,0x46A,0x46C,0x46E,0x470,0x472,0x474,0x476,0x478,0x47A,
+  0x47C,0x47E,0x480,0x48A,0x48C,0x48E,0x490,0x492,0x494,0x496,0x498,0x49A,
+  0x49C,0x49E,0x4A0,0x4A2,0x4A4,0x4A6,0x4A8,0x4AA,0x4AC,0x4AE,0x4B0,0x4B2,
+  0x4B4,0x4B6,0x4B8,0x4BA,0x4BC,0x4BE,0x4C1,0x4C3,0x4C5,0x4C7,0x4C9,0x4CB,
+  0x4CD,0x4C0,0x4D0,0x4D2,0x4D4,0x4D6,0x4D8,0x4DA,0x4DC,0x4DE,0x4E0,0x4E2,
+  0x4E4,0x4E6,0x4E8,0x4EA,0x4EC,0x4EE,0x4F0,0x4F2,0x4F4,0x4F6,0x4F8,0x4FA,
+  0x4FC,0x4FE,0x500,0x502,0x504,0x506,0x508,0x50A,0x50C,0x50E,0x510,0x512,
+  0x514,0x516,0x518,0x51A,0x51C,0x51E,0x520,0x522,0x524,0x526,0x528,0x52A,
+  0x52C,0x52E,0x531,0x532,0x533,0x534,0x535,0x536,0x537,0x538,0x539,0x53A,
+  0x53B,0x53C,0x53D,0x53E,0x53F,0x540,0x541,0x542,0x543,0x544,0x545,0x546,
+  0x547,0x548,0x549,0x54A,0x54B,0x54C,0x54D,0x54E,0x54F,0x550,0x551,0x552,
+  0x553,0x554,0x555,0x556,0x1C90,0x1C91,0x1C92,0x1C93,0x1C94,0x1C95,0x1C96,0x1C97,
+  0x1C98,0x1C99,0x1C9A,0x1C9B,0x1C9C,0x1C9D,0x1C9E,0x1C9F,0x1CA0,0x1CA1,0x1CA2,0x1CA3,
+  0x1CA4,0x1CA5,0x1CA6,0x1CA7,0x1CA8,0x1CA9,0x1CAA,0x1CAB,0x1CAC,0x1CAD,0x1CAE,0x1CAF,
+  0x1CB0,0x1CB1,0x1CB2,0x1CB3,0x1CB4,0x1CB5,0x1CB6,0x1CB7,0x1CB8,0x1CB9,0x1CBA,0x1CBD,
+  0x1CBE,0x1CBF,0xAB70,0xAB71,0xAB72,0xAB73,0xAB74,0xAB75,0xAB76,0xAB77,0xAB78,0xAB79,
+  0xAB7A,0xAB7B,0xAB7C,0xAB7D,0xAB7E,0xAB7F,0xAB80,0xAB81,0xAB82,0xAB83,0xAB84,0xAB85,
+  0xAB86,0xAB87,0xAB88,0xAB89,0xAB8A,0xAB8B,0xAB8C,0xAB8D,0xAB8E,0xAB8F,0xAB90,0xAB91,
+  0xAB92,0xAB93,0xAB94,0xAB95,0xAB96,0xAB97,0xAB98,0xAB99,0xAB9A,0xAB9B,0xAB9C,0xAB9D,
+  0xAB9E,0xAB9F,0xABA0,0xABA1,0xABA2,0xABA3,0xABA4,0xABA5,0xABA6,0xABA7,0xABA8,0xABA9,
+  0xABAA,0xABAB,0xABAC,0xABAD,0xABAE,0xABAF,0xABB0,0xABB1,0xABB2,0xABB3,0xABB4,0xABB5,
+  0xABB6,0xABB7,0xABB8,0xABB9,0xABBA,0xABBB,0xABBC,0xABBD,0xABBE,0xABBF,0x13F8,0x13F9,
+  0x13FA,0x13FB,0x13FC,0x13FD,0xA77D,0x2C63,0xA7C6,0x1E00,0x1E02,0x1E04,0x1E06,0x1E08,
+  0x1E0A,0x1E0C,0x1E0E,0x1E10,0x1E12,0x1E14,0x1E16,0x1E18,0x1E1A,0x1E1C,0x1E1E,0x1E20,
+  0x1E22,0x1E24,0x1E26,0x1E28,0x1E2A,0x1E2C,0x1E2E,0x1E30,0x1E32,0x1E34,0x1E36,0x1E38,
+  0x1E3A,0x1E3C,0x1E3E,0x1E40,0x1E42,0x1E44,0x1E46,0x1E48,0x1E4A,0x1E4C,0x1E4E,0x1E50,
+  0x1E52,0x1E54,0x1E56,0x1E58,0x1E5A,0x1E5C,0x1E5E,0x1E60,0x1E9B,0x1E62,0x1E64,0x1E66,
+  0x1E68,0x1E6A,0x1E6C,0x1E6E,0x1E70,0x1E72,0x1E74,0x1E76,0x1E78,0x1E7A,0x1E7C,0x1E7E,
+  0x1E80,0x1E82,0x1E84,0x1E86,0x1E88,0x1E8A,0x1E8C,0x1E8E,0x1E90,0x1E92,0x1E94,0x1EA0,
+  0x1EA2,0x1EA4,0x1EA6,0x1EA8,0x1EAA,0x1EAC,0x1EAE,0x1EB0,0x1EB2,0x1EB4,0x1EB6,0x1EB8,
+  0x1EBA,0x1EBC,0x1EBE,0x1EC0,0x1EC2,0x1EC4,0x1EC6,0x1EC8,0x1ECA,0x1ECC,0x1ECE,0x1ED0,
+  0x1ED2,0x1ED4,0x1ED6,0x1ED8,0x1EDA,0x1EDC,0x1EDE,0x1EE0,0x1EE2,0x1EE4,0x1EE6,0x1EE8,
+  0x1EEA,0x1EEC,0x1EEE,0x1EF0,0x1EF2,0x1EF4,0x1EF6,0x1EF8,0x1EFA,0x1EFC,0x1EFE,0x1F08,
+  0x1F09,0x1F0A,0x1F0B,0x1F0C,0x1F0D,0x1F0E,0x1F0F,0x1F18,0x1F19,0x1F1A,0x1F1B,0x1F1C,
+  0x1F1D,0x1F28,0x1F29,0x1F2A,0x1F2B,0x1F2C,0x1F2D,0x1F2E,0x1F2F,0x1F38,0x1F39,0x1F3A,
+  0x1F3B,0x1F3C,0x1F3D,0x1F3E,0x1F3F,0x1F48,0x1F49,0x1F4A,0x1F4B,0x1F4C,0x1F4D,0x1F59,
+  0x1F5B,0x1F5D,0x1F5F,0x1F68,0x1F69,0x1F6A,0x1F6B,0x1F6C,0x1F6D,0x1F6E,0x1F6F,0x1FBA,
+  0x1FBB,0x1FC8,0x1FC9,0x1FCA,0x1FCB,0x1FDA,0x1FDB,0x1FF8,0x1FF9,0x1FEA,0x1FEB,0x1FFA,
+  0x1FFB,0x1F88,0x1F89,0x1F8A,0x1F8B,0x1F8C,0x1F8D,0x1F8E,0x1F8F,0x1F98,0x1F99,0x1F9A,
+  0x1F9B,0x1F9C,0x1F9D,0x1F9E,0x1F9F,0x1FA8,0x1FA9,0x1FAA,0x1FAB,0x1FAC,0x1FAD,0x1FAE,
+  0x1FAF,0x1FB8,0x1FB9,0x1FBC,0x1FCC,0x1FD8,0x1FD9,0x1FE8,0x1FE9,0x1FEC,0x1FFC,0x2132,
+  0x2160,0x2161,0x2162,0x2163,0x2164,0x2165,0x2166,0x2167,0x2168,0x2169,0x216A,0x216B,
+  0x216C,0x216D,0x216E,0x216F,0x2183,0x24B6,0x24B7,0x24B8,0x24B9,0x24BA,0x24BB,0x24BC,
+  0x24BD,0x24BE,0x24BF,0x24C0,0x24C1,0x24C2,0x24C3,0x24C4,0x24C5,0x24C6,0x24C7,0x24C8,
+  0x24C9,0x24CA,0x24CB,0x24CC,0x24CD,0x24CE,0x24CF,0x2C00,0x2C01,0x2C02,0x2C03,0x2C04,
+  0x2C05,0x2C06,0x2C07,0x2C08,0x2C09,0x2C0A,0x2C0B,0x2C0C,0x2C0D,0x2C0E,0x2C0F,0x2C10,
+  0x2C11,0x2C12,0x2C13,0x2C14,0x2C15,0x2C16,0x2C17,0x2C18,0x2C19,0x2C1A,0x2C1B,0x2C1C,
+  0x2C1D,0x2C1E,0x2C1F,0x2C20,0x2C21,0x2C22,0x2C23,0x2C24,0x2C25,0x2C26,0x2C27,0x2C28,
+  0x2C29,0x2C2A,0x2C2B,0x2C2C,0x2C2D,0x2C2E,0x2C2F,0x2C60,0x23A,0x23E,0x2C67,0x2C69,
+  0x2C6B,0x2C72,0x2C75,0x2C80,0x2C82,0x2C84,0x2C86,0x2C88,0x2C8A,0x2C8C,0x2C8E,0x2C90,
+  0x2C92,0x2C94,0x2C96,0x2C98,0x2C9A,0x2C9C,0x2C9E,0x2CA0,0x2CA2,0x2CA4,0x2CA6,0x2CA8,
+  0x2CAA,0x2CAC,0x2CAE,0x2CB0,0x2CB2,0x2CB4,0x2CB6,0x2CB8,0x2CBA,0x2CBC,0x2CBE,0x2CC0,
+  0x2CC2,0x2CC4,0x2CC6,0x2CC8,0x2CCA,0x2CCC,0x2CCE,0x2CD0,0x2CD2,0x2CD4,0x2CD6,0x2CD8,
+  0x2CDA,0x2CDC,0x2CDE,0x2CE0,0x2CE2,0x2CEB,0x2CED,0x2CF2,0x10A0,0x10A1,0x10A2,0x10A3,
+  0x10A4,0x10A5,0x10A6,0x10A7,0x10A8,0x10A9,0x10AA,0x10AB,0x10AC,0x10AD,0x10AE,0x10AF,
+  0x10B0,0x10B1,0x10B2,0x10B3,0x10B4,0x10B5,0x10B6,0x10B7,0x10B8,0x10B9,0x10BA,0x10BB,
+  0x10BC,0x10BD,0x10BE,0x10BF,0x10C0,0x10C1,0x10C2,0x10C3,0x10C4,0x10C5,0x10C7,0x10CD,
+  0xA640,0xA642,0xA644,0xA646,0xA648,0x1C88,0xA64A,0xA64C,0xA64E,0xA650,0xA652,0xA654,
+  0xA656,0xA658,0xA65A,0xA65C,0xA65E,0xA660,0xA662,0xA664,0xA666,0xA668,0xA66A,0xA66C,
+  0xA680,0xA682,0xA684,0xA686,0xA688,0xA68A,0xA68C,0xA68E,0xA690,0xA692,0xA694,0xA696,
+  0xA698,0xA69A,0xA722,0xA724,0xA726,0xA728,0xA72A,0xA72C,0xA72E,0xA732,0xA734,0xA736,
+  0xA738,0xA73A,0xA73C,0xA73E,0xA740,0xA742,0xA744,0xA746,0xA748,0xA74A,0xA74C,0xA74E,
+  0xA750,0xA752,0xA754,0xA756,0xA758,0xA75A,0xA75C,0xA75E,0xA760,0xA762,0xA764,0xA766,
+  0xA768,0xA76A,0xA76C,0xA76E,0xA779,0xA77B,0xA77E,0xA780,0xA782,0xA784,0xA786,0xA78B,
+  0xA790,0xA792,0xA7C4,0xA796,0xA798,0xA79A,0xA79C,0xA79E,0xA7A0,0xA7A2,0xA7A4,0xA7A6,
+  0xA7A8,0xA7B4,0xA7B6,0xA7B8,0xA7BA,0xA7BC,0xA7BE,0xA7C0,0xA7C2,0xA7C7,0xA7C9,0xA7D0,
+  0xA7D6,0xA7D8,0xA7F5,0xA7B3,0xFF21,0xFF22,0xFF23,0xFF24,0xFF25,0xFF26,0xFF27,0xFF28,
+  0xFF29,0xFF2A,0xFF2B,0xFF2C,0xFF2D,0xFF2E,0xFF2F,0xFF30,0xFF31,0xFF32,0xFF33,0xFF34,
+  0xFF35,0xFF36,0xFF37,0xFF38,0xFF39,0xFF3A,0x10400,0x10401,0x10402,0x10403,0x10404,0x10405,
+  0x10406,0x10407,0x10408,0x10409,0x1040A,0x1040B,0x1040C,0x1040D,0x1040E,0x1040F,0x10410,0x10411,
+  0x10412,0x10413,0x10414,0x10415,0x10416,0x10417,0x10418,0x10419,0x1041A,0x1041B,0x1041C,0x1041D,
+  0x1041E,0x1041F,0x10420,0x10421,0x10422,0x10423,0x10424,0x10425,0x10426,0x10427,0x104B0,0x104B1,
+  0x104B2,0x104B3,0x104B4,0x104B5,0x104B6,0x104B7,0x104B8,0x104B9,0x104BA,0x104BB,0x104BC,0x104BD,
+  0x104BE,0x104BF,0x104C0,0x104C1,0x104C2,0x104C3,0x104C4,0x104C5,0x104C6,0x104C7,0x104C8,0x104C9,
+  0x104CA,0x104CB,0x104CC,0x104CD,0x104CE,0x104CF,0x104D0,0x104D1,0x104D2,0x104D3,0x10570,0x10571,
+  0x10572,0x10573,0x10574,0x10575,0x10576,0x10577,0x10578,0x10579,0x1057A,0x1057C,0x1057D,0x1057E,
+  0x1057F,0x10580,0x10581,0x10582,0x10583,0x10584,0x10585,0x10586,0x10587,0x10588,0x10589,0x1058A,
+  0x1058C,0x1058D,0x1058E,0x1058F,0x10590,0x10591,0x10592,0x10594,0x10595,0x10C80,0x10C81,0x10C82,
+  0x10C83,0x10C84,0x10C85,0x10C86,0x10C87,0x10C88,0x10C89,0x10C8A,0x10C8B,0x10C8C,0x10C8D,0x10C8E,
+  0x10C8F,0x10C90,0x10C91,0x10C92,0x10C93,0x10C94,0x10C95,0x10C96,0x10C97,0x10C98,0x10C99,0x10C9A,
+  0x10C9B,0x10C9C,0x10C9D,0x10C9E,0x10C9F,0x10CA0,0x10CA1,0x10CA2,0x10CA3,0x10CA4,0x10CA5,0x10CA6,
+  0x10CA7,0x10CA8,0x10CA9,0x10CAA,0x10CAB,0x10CAC,0x10CAD,0x10CAE,0x10CAF,0x10CB0,0x10CB1,0x10CB2,
+  0x118A0,0x118A1,0x118A2,0x118A3,0x118A4,0x118A5,0x118A6,0x118A7,0x118A8,0x118A9,0x118AA,0x118AB,
+  0x118AC,0x118AD,0x118AE,0x118AF,0x118B0,0x118B1,0x118B2,0x118B3,0x118B4,0x118B5,0x118B6,0x118B7,
+  0x118B8,0x118B9,0x118BA,0x118BB,0x118BC,0x118BD,0x118BE,0x118BF,0x16E40,0x16E41,0x16E42,0x16E43,
+  0x16E44,0x16E45,0x16E46,0x16E47,0x16E48,0x16E49,0x16E4A,0x16E4B,0x16E4C,0x16E4D,0x16E4E,0x16E4F,
+  0x16E50,0x16E51,0x16E52,0x16E53,0x16E54,0x16E55,0x16E56,0x16E57,0x16E58,0x16E59,0x16E5A,0x16E5B,
+  0x16E5C,0x16E5D,0x16E5E,0x16E5F,0x1E900,0x1E901,0x1E902,0x1E903,0x1E904,0x1E905,0x1E906,0x1E907,
+  0x1E908,0x1E909,0x1E90A,0x1E90B,0x1E90C,0x1E90D,0x1E90E,0x1E90F,0x1E910,0x1E911,0x1E912,0x1E913,
+  0x1E914,0x1E915,0x1E916,0x1E917,0x1E918,0x1E919,0x1E91A,0x1E91B,0x1E91C,0x1E91D,0x1E91E,0x1E91F,
+  0x1E920,0x1E921,
+};
+
+static const u8 normPropsIndex[3049] = {
+  0,0,1,2,3,4,5,6,7,0,8,9,10,11,12,13,14,15,16,17,0,0,18,19,20,21,0,22,23,24,0,25,
+  26,27,28,29,30,31,32,33,34,35,36,37,32,38,39,40,36,41,36,42,43,40,0,44,45,46,47,48,49,50,51,52,
+  53,0,54,55,0,56,57,58,0,0,0,0,0,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,0,0,61,
+  0,0,62,0,63,0,0,0,64,65,66,67,68,69,70,71,72,0,0,73,74,75,76,77,78,78,79,80,81,82,83,84,
+  85,86,87,88,89,90,91,92,93,94,95,96,97,0,0,0,0,98,99,100,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,101,102,0,103,0,0,0,0,0,104,0,105,0,106,0,107,0,0,108,109,99,99,99,110,
+  111,112,113,114,115,99,116,0,117,118,99,99,99,99,99,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,119,120,121,0,122,0,123,
+  124,0,0,125,126,127,128,129,0,0,130,131,0,132,0,133,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+  78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+  78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+  78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+  78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+  78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,134,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,135,135,135,135,136,137,135,138,139,140,141,142,99,99,99,99,143,144,145,146,147,148,99,149,150,99,151,152,
+  0,0,0,0,0,0,0,153,0,0,0,154,0,155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,156,0,
+  0,0,0,0,0,0,0,0,157,0,0,158,0,0,0,0,0,0,0,0,159,0,0,0,0,0,160,0,0,161,162,0,
+  0,163,164,0,165,128,0,166,167,0,0,168,169,170,0,0,0,171,172,173,0,0,174,175,176,0,177,0,178,0,0,0,
+  179,0,0,0,180,181,0,182,183,184,185,0,0,0,0,0,176,0,0,0,0,186,187,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,188,189,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,190,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,191,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,192,193,194,0,195,0,0,0,0,0,0,99,196,197,198,199,200,99,99,99,99,201,99,99,99,99,202,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  203,0,0,0,189,0,0,0,0,0,204,205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,206,0,207,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,209,210,0,0,0,0,0,
+  0,0,0,0,211,212,213,0,214,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  135,135,135,135,135,135,135,135,217,
+};
+
+static const u16 normPropsBlocks[218][64] = {
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40960,0,0,0,0,0,0,0,40960,0,40960,0,0,0,0,40960,
+    0,0,40960,40960,40960,40960,0,0,40960,40960,40960,0,40960,40960,40960,0,
+  },
+  {
+    34816,34816,34816,34816,34816,34816,0,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    0,34816,34816,34816,34816,34816,34816,0,0,34816,34816,34816,34816,34816,0,0,
+    34816,34816,34816,34816,34816,34816,0,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    0,34816,34816,34816,34816,34816,34816,0,0,34816,34816,34816,34816,34816,0,34816,
+  },
+  {
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    0,0,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,0,0,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,0,40960,40960,34816,34816,34816,34816,0,34816,34816,34816,34816,34816,34816,40960,
+  },
+  {
+    40960,0,0,34816,34816,34816,34816,34816,34816,40960,0,0,34816,34816,34816,34816,
+    34816,34816,0,0,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,0,0,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,40960,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    34816,34816,0,0,0,0,0,0,0,0,0,0,0,0,0,34816,
+    34816,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,40960,40960,40960,40960,40960,40960,40960,40960,40960,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,0,34816,34816,
+    34816,34816,34816,34816,0,0,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,40960,40960,40960,34816,34816,0,0,34816,34816,34816,34816,34816,34816,34816,34816,
+  },
+  {
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,0,0,34816,34816,
+    0,0,0,0,0,0,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,40960,40960,40960,40960,40960,40960,0,0,
+    40960,40960,40960,40960,40960,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    4582,4582,4582,4582,4582,230,4582,4582,4582,4582,4582,4582,4582,230,230,4582,
+    230,4582,230,4582,4582,232,220,220,220,220,232,4568,220,220,220,220,
+    220,202,202,4572,4572,4572,4572,4554,4554,220,220,220,220,4572,4572,220,
+    4572,4572,220,220,1,1,1,1,4353,220,220,220,220,230,230,230,
+  },
+  {
+    43750,43750,4582,43750,43750,4592,230,220,220,220,230,230,230,220,220,0,
+    230,230,230,220,220,220,220,230,232,220,220,230,233,234,234,233,
+    234,234,233,230,230,230,230,230,230,230,230,230,230,230,230,230,
+    0,0,0,0,43520,0,0,0,0,0,40960,0,0,0,43520,0,
+  },
+  {
+    0,0,0,0,40960,43008,34816,43520,34816,34816,34816,0,34816,0,34816,34816,
+    34816,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,34816,34816,34816,34816,34816,34816,
+    34816,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,34816,34816,34816,34816,34816,0,
+    40960,40960,40960,43008,43008,40960,40960,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40960,40960,40960,0,40960,40960,0,0,0,40960,0,0,0,0,0,0,
+  },
+  {
+    34816,34816,0,34816,0,0,0,34816,0,0,0,0,34816,34816,34816,0,
+    0,0,0,0,0,0,0,0,0,34816,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,34816,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    34816,34816,0,34816,0,0,0,34816,0,0,0,0,34816,34816,34816,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,34816,34816,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,230,230,230,230,230,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,34816,34816,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    34816,34816,34816,34816,0,0,34816,34816,0,0,34816,34816,34816,34816,34816,34816,
+    0,0,34816,34816,34816,34816,34816,34816,0,0,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,0,0,34816,34816,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,40960,0,0,0,0,0,0,0,0,
+    0,220,230,230,230,230,220,230,230,230,222,220,230,230,230,230,
+    230,230,220,220,220,220,220,220,230,230,220,230,230,222,228,230,
+    10,11,12,13,14,15,16,17,18,19,19,20,21,22,0,23,
+  },
+  {
+    0,24,25,0,230,220,0,18,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,230,230,230,230,230,230,30,31,32,0,0,0,0,0,
+    0,0,34816,34816,34816,34816,34816,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,27,28,29,30,31,
+    32,33,34,4582,4582,4572,220,230,230,230,230,230,220,230,230,220,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    35,0,0,0,0,40960,40960,40960,40960,0,0,0,0,0,0,0,
+  },
+  {
+    34816,0,34816,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,34816,0,0,230,230,230,230,230,230,230,0,0,230,
+    230,230,230,220,230,0,0,230,230,0,220,230,230,220,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,220,230,230,220,230,230,220,220,220,230,220,220,230,220,230,
+  },
+  {
+    230,230,220,230,220,230,220,230,220,230,230,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,
+    230,230,220,230,0,0,0,0,0,0,0,0,0,220,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,230,230,230,230,0,230,230,230,230,230,
+    230,230,230,230,0,230,230,230,0,230,230,230,230,230,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,220,220,220,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,230,220,220,220,230,230,230,230,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,220,
+    220,220,220,220,230,230,230,230,230,230,230,230,230,230,230,230,
+    230,230,0,220,230,230,220,230,230,220,230,230,230,220,220,220,
+    27,28,29,230,230,230,220,230,230,220,220,230,230,230,230,230,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,34816,0,0,0,0,0,0,
+    0,34816,0,0,34816,0,0,0,0,0,0,0,4359,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+    0,230,220,230,230,0,0,0,43520,43520,43520,43520,43520,43520,43520,43520,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,7,0,4352,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,34816,34816,9,0,0,
+    0,0,0,0,0,0,0,4352,0,0,0,0,43520,43520,0,43520,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,43520,0,0,43520,0,0,0,0,0,7,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,0,0,0,43520,43520,43520,0,0,43520,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,34816,0,0,34816,34816,9,0,0,
+    0,0,0,0,0,0,4352,4352,0,0,0,0,43520,43520,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,34816,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,4352,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,34816,34816,34816,9,0,0,
+    0,0,0,0,0,0,0,4352,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,34816,0,0,0,0,9,0,0,
+    0,0,0,0,0,84,4443,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    34816,0,4352,0,0,0,0,34816,34816,0,34816,34816,0,9,0,0,
+    0,0,0,0,0,4352,4352,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,9,9,0,4352,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,4361,0,0,0,0,4352,
+    0,0,0,0,0,0,0,0,0,0,34816,0,34816,34816,34816,4352,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,40960,0,0,0,0,103,103,9,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,107,107,107,107,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,40960,0,0,0,0,118,118,9,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,122,122,122,122,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,40960,40960,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,40960,0,0,0,
+    0,0,0,0,0,0,0,0,220,220,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,220,0,220,0,216,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,43520,0,0,0,0,0,0,0,0,0,43520,0,0,
+    0,0,43520,0,0,0,0,43520,0,0,0,0,43520,0,0,0,
+    0,0,0,0,0,0,0,0,0,43520,0,0,0,0,0,0,
+    0,129,130,43520,132,43520,43520,40960,43520,40960,130,130,130,130,0,0,
+  },
+  {
+    130,43520,230,230,9,0,230,230,0,0,0,0,0,0,0,0,
+    0,0,0,43520,0,0,0,0,0,0,0,0,0,43520,0,0,
+    0,0,43520,0,0,0,0,43520,0,0,0,0,43520,0,0,0,
+    0,0,0,0,0,0,0,0,0,43520,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,220,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,34816,0,0,0,0,0,0,0,4352,0,
+    0,0,0,0,0,0,0,7,0,9,9,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,40960,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,4352,4352,4352,4352,4352,4352,4352,4352,4352,4352,4352,4352,4352,4352,4352,
+    4352,4352,4352,4352,4352,4352,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,4352,4352,4352,4352,4352,4352,4352,4352,
+    4352,4352,4352,4352,4352,4352,4352,4352,4352,4352,4352,4352,4352,4352,4352,4352,
+  },
+  {
+    4352,4352,4352,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,9,0,0,0,0,0,0,0,0,0,0,230,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,228,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,222,230,220,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,230,220,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,230,230,230,230,230,230,230,230,0,0,220,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,230,230,230,220,220,220,220,220,220,230,230,220,0,220,
+  },
+  {
+    220,230,230,220,220,230,230,230,230,230,220,230,230,230,230,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,34816,0,34816,0,34816,0,34816,0,34816,0,
+    0,0,34816,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,7,4352,0,0,0,0,0,34816,0,34816,0,0,
+  },
+  {
+    34816,34816,0,34816,9,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,230,220,230,230,230,
+    230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,9,9,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,
+    0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,230,0,1,220,220,220,220,220,230,230,220,220,220,220,
+    230,0,1,1,1,1,1,1,1,0,0,0,0,220,0,0,
+    0,0,0,0,230,0,0,0,230,230,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,40960,40960,40960,0,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,40960,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    230,230,220,230,230,230,230,230,230,230,220,230,230,234,214,220,
+    202,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+    230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+    230,230,230,230,230,230,232,228,228,220,218,230,233,220,230,220,
+  },
+  {
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+  },
+  {
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,40960,43008,0,0,0,0,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+  },
+  {
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,0,0,0,0,0,0,
+  },
+  {
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,0,0,34816,34816,34816,34816,34816,34816,0,0,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+  },
+  {
+    34816,34816,34816,34816,34816,34816,0,0,34816,34816,34816,34816,34816,34816,0,0,
+    34816,34816,34816,34816,34816,34816,34816,34816,0,34816,0,34816,0,34816,0,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,43520,34816,43520,34816,43520,34816,43520,34816,43520,34816,43520,34816,43520,0,0,
+  },
+  {
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,0,34816,34816,34816,34816,34816,43520,34816,40960,43520,40960,
+  },
+  {
+    40960,43008,34816,34816,34816,0,34816,34816,34816,43520,34816,43520,34816,43008,43008,43008,
+    34816,34816,34816,43520,0,0,34816,34816,34816,34816,34816,43520,0,43008,43008,43008,
+    34816,34816,34816,43520,34816,34816,34816,34816,34816,34816,34816,43520,34816,43008,43520,43520,
+    0,0,34816,34816,34816,0,34816,34816,34816,43520,34816,43520,34816,43520,40960,0,
+  },
+  {
+    43520,43520,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,0,0,
+    0,40960,0,0,0,0,0,40960,0,0,0,0,0,0,0,0,
+    0,0,0,0,40960,40960,40960,0,0,0,0,0,0,0,0,40960,
+    0,0,0,40960,40960,0,40960,40960,0,0,0,0,40960,0,40960,0,
+  },
+  {
+    0,0,0,0,0,0,0,40960,40960,40960,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,40960,0,0,0,0,0,0,0,40960,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40960,40960,0,0,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,
+    0,0,0,0,0,0,0,0,40960,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,1,1,230,230,230,230,1,1,1,230,230,0,0,0,
+    0,230,0,0,0,1,1,230,220,230,1,1,220,220,220,220,
+    230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    40960,40960,40960,40960,0,40960,40960,40960,0,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,0,40960,40960,0,0,40960,40960,40960,40960,40960,0,0,
+    40960,40960,40960,0,40960,0,43520,0,40960,0,43520,43520,40960,40960,0,40960,
+    40960,40960,0,40960,40960,40960,40960,40960,40960,40960,0,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,0,0,0,0,40960,40960,40960,40960,40960,0,0,0,0,0,0,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,40960,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,34816,34816,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,34816,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,34816,34816,34816,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,34816,0,0,0,0,34816,0,0,34816,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,34816,0,34816,0,0,0,0,0,40960,40960,0,40960,
+    40960,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,34816,0,0,34816,0,0,34816,0,34816,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    34816,0,34816,0,0,0,0,0,0,0,0,0,0,34816,34816,34816,
+    34816,34816,0,0,34816,34816,0,0,34816,34816,0,0,0,0,0,0,
+  },
+  {
+    34816,34816,0,0,34816,34816,0,0,34816,34816,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,34816,34816,34816,34816,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    34816,34816,34816,34816,0,0,0,0,0,0,34816,34816,34816,34816,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,43520,43520,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,40960,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,40960,40960,40960,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,43520,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,40960,40960,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,
+    230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40960,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+    230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40960,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,40960,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    40960,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,218,228,232,222,224,224,
+    0,0,0,0,0,0,40960,0,40960,40960,40960,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,34816,0,34816,0,
+    34816,0,34816,0,34816,0,34816,0,34816,0,34816,0,34816,0,34816,0,
+    34816,0,34816,0,0,34816,0,34816,0,34816,0,0,0,0,0,0,
+    34816,34816,0,34816,34816,0,34816,34816,0,34816,34816,0,34816,34816,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,34816,0,0,0,0,4360,4360,40960,40960,0,34816,40960,
+    0,0,0,0,0,0,0,0,0,0,0,0,34816,0,34816,0,
+    34816,0,34816,0,34816,0,34816,0,34816,0,34816,0,34816,0,34816,0,
+  },
+  {
+    34816,0,34816,0,0,34816,0,34816,0,34816,0,0,0,0,0,0,
+    34816,34816,0,34816,34816,0,34816,34816,0,34816,34816,0,34816,34816,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,34816,0,0,34816,34816,34816,34816,0,0,0,34816,40960,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,
+    0,0,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,0,0,0,0,0,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,
+    0,0,0,0,230,230,230,230,230,230,230,230,230,230,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,40960,40960,230,230,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40960,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,40960,40960,40960,0,0,0,40960,40960,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+    230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,220,220,220,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,0,230,230,220,0,0,230,230,0,0,0,0,0,230,230,
+  },
+  {
+    0,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,40960,40960,40960,40960,
+    0,0,0,0,0,0,0,0,0,40960,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,34816,
+    34816,34816,34816,34816,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,
+    43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,
+    43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,
+    43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,
+  },
+  {
+    43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,0,0,
+    43520,0,43520,0,0,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,0,
+    43520,0,43520,0,0,43520,43520,0,0,0,43520,43520,43520,43520,43520,43520,
+    43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,
+  },
+  {
+    43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,
+    43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,
+    43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,0,0,
+    43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,
+  },
+  {
+    43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,
+    43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,0,0,0,0,0,0,0,0,0,
+    0,0,0,40960,40960,40960,40960,40960,0,0,0,0,0,43520,26,43520,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,43520,43520,43520,43520,43520,43520,
+    43520,43520,43520,43520,43520,43520,43520,0,43520,43520,43520,43520,43520,0,43520,0,
+  },
+  {
+    43520,43520,0,43520,43520,0,43520,43520,43520,43520,43520,43520,43520,43520,43520,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    0,0,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,0,0,0,
+    230,230,230,230,230,230,230,220,220,220,220,220,220,220,230,230,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,0,0,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,0,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,0,40960,40960,40960,40960,0,0,0,0,
+    40960,40960,40960,0,40960,0,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,
+  },
+  {
+    0,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,
+  },
+  {
+    0,0,40960,40960,40960,40960,40960,40960,0,0,40960,40960,40960,40960,40960,40960,
+    0,0,40960,40960,40960,40960,40960,40960,0,0,40960,40960,40960,0,0,0,
+    40960,40960,40960,40960,40960,40960,40960,0,40960,40960,40960,40960,40960,40960,40960,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,230,230,230,230,230,0,0,0,0,0,
+  },
+  {
+    0,40960,40960,40960,40960,40960,0,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,0,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,230,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,230,1,220,0,0,0,0,9,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,230,220,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,230,230,230,230,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,230,230,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,220,220,230,230,230,220,230,220,220,220,
+    220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,230,220,230,220,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,34816,0,34816,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,34816,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,9,4359,0,0,0,0,0,
+  },
+  {
+    230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,4352,0,0,0,0,0,0,34816,34816,
+    0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    9,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,9,7,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,7,9,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,7,7,0,4352,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,34816,34816,9,0,0,
+    0,0,0,0,0,0,0,4352,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,230,230,230,230,230,230,230,0,0,0,
+    230,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,9,0,0,0,7,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    4352,0,0,0,0,0,0,0,0,0,4352,34816,34816,4352,34816,0,
+  },
+  {
+    0,0,9,7,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4352,
+    0,0,0,0,0,0,0,0,0,0,34816,34816,0,0,0,9,
+  },
+  {
+    7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,9,7,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,9,7,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    4352,0,0,0,0,0,0,0,34816,0,0,0,0,9,9,0,
+  },
+  {
+    0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,7,0,9,9,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,230,230,230,230,230,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,43520,43520,
+    43520,43520,43520,43520,43520,216,216,1,1,1,0,0,0,226,216,216,
+    216,216,216,0,0,0,0,0,0,0,0,220,220,220,220,220,
+  },
+  {
+    220,220,220,0,0,230,230,230,230,230,220,220,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,230,230,230,230,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,43520,43520,43520,43520,43520,
+  },
+  {
+    43520,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,230,230,230,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,0,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,40960,40960,
+    0,0,40960,0,0,40960,40960,0,0,40960,40960,40960,40960,0,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,40960,0,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,0,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,0,40960,40960,40960,40960,0,0,40960,40960,40960,
+    40960,40960,40960,40960,40960,0,40960,40960,40960,40960,40960,40960,40960,0,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,40960,40960,40960,40960,0,
+  },
+  {
+    40960,40960,40960,40960,40960,0,40960,0,0,0,40960,40960,40960,40960,40960,40960,
+    40960,0,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,0,0,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    230,230,230,230,230,230,230,0,230,230,230,230,230,230,230,230,
+    230,230,230,230,230,230,230,230,230,0,0,230,230,230,230,230,
+    230,230,0,230,230,0,230,230,230,230,230,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    220,220,220,220,220,220,220,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,230,230,230,230,230,230,7,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    40960,40960,40960,40960,0,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    0,40960,40960,0,40960,0,0,40960,0,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,0,40960,40960,40960,40960,0,40960,0,40960,0,0,0,0,
+  },
+  {
+    0,0,40960,0,0,0,0,40960,0,40960,0,40960,0,40960,40960,40960,
+    0,40960,40960,0,40960,0,0,40960,0,40960,0,40960,0,40960,0,40960,
+    0,40960,40960,0,40960,0,0,40960,40960,40960,40960,0,40960,40960,40960,40960,
+    40960,40960,40960,0,40960,40960,40960,40960,0,40960,40960,40960,40960,0,40960,0,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,0,
+    0,40960,40960,40960,0,40960,40960,40960,40960,40960,0,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,0,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,0,0,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,40960,40960,40960,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40960,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    40960,40960,40960,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,0,
+  },
+  {
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,0,0,0,0,
+    40960,40960,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40960,40960,40960,40960,40960,40960,40960,40960,40960,40960,0,0,0,0,0,0,
+  },
+  {
+    43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,
+    43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,43520,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+};
+
+static inline u16 normProps(u32 uc) {
+  return (uc < 0x2FA40) ? normPropsBlocks[normPropsIndex[uc >> 6]][uc & 0x3f] : 0;
+}
+
+static const u8 normDecompOffsetIndex[3049] = {
+  0,0,1,2,3,4,5,6,7,0,8,9,0,10,11,12,13,14,0,15,0,0,16,0,17,18,0,19,0,0,0,0,
+  0,0,0,0,20,21,0,22,23,24,0,0,0,25,26,27,0,28,0,29,0,30,0,31,32,0,33,34,35,36,37,0,
+  38,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,40,41,0,0,0,0,0,0,42,43,44,0,45,46,47,48,49,50,51,52,
+  53,54,55,0,56,57,58,59,60,61,62,63,64,0,0,0,0,65,66,67,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,68,69,0,70,0,0,0,0,0,71,0,0,0,72,0,0,0,0,73,74,75,76,77,78,
+  79,80,81,82,83,84,85,0,86,87,88,89,90,91,92,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,0,0,95,0,96,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,127,0,128,0,0,0,0,0,0,0,0,129,0,0,0,0,130,0,0,0,131,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,132,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,133,134,135,0,0,0,0,0,0,0,0,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,153,154,0,0,0,0,0,
+  0,0,0,0,155,156,157,0,158,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  161,162,163,164,165,166,167,168,169,
+};
+
+static const u16 normDecompOffsetBlocks[170][64] = {
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,0,0,0,0,0,0,3,0,6,0,0,0,0,8,
+    0,0,11,13,15,18,0,0,20,23,25,0,27,31,35,0,
+  },
+  {
+    39,42,45,48,51,54,0,57,60,63,66,69,72,75,78,81,
+    0,84,87,90,93,96,99,0,0,102,105,108,111,114,0,0,
+    117,120,123,126,129,132,0,135,138,141,144,147,150,153,156,159,
+    0,162,165,168,171,174,177,0,0,180,183,186,189,192,0,195,
+  },
+  {
+    198,201,204,207,210,213,216,219,222,225,228,231,234,237,240,243,
+    0,0,246,249,252,255,258,261,264,267,270,273,276,279,282,285,
+    288,291,294,297,300,303,0,0,306,309,312,315,318,321,324,327,
+    330,0,333,336,339,342,345,348,0,351,354,357,360,363,366,369,
+  },
+  {
+    372,0,0,375,378,381,384,387,390,393,0,0,396,399,402,405,
+    408,411,0,0,414,417,420,423,426,429,432,435,438,441,444,447,
+    450,453,456,459,462,465,0,0,468,471,474,477,480,483,486,489,
+    492,495,498,501,504,507,510,513,516,519,522,525,528,531,534,537,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    539,542,0,0,0,0,0,0,0,0,0,0,0,0,0,545,
+    548,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,551,555,559,563,566,569,572,575,578,581,584,587,
+    590,593,596,599,602,605,609,613,617,621,625,629,633,0,637,641,
+    645,649,653,656,0,0,659,662,665,668,671,674,677,681,685,688,
+    691,694,697,700,703,706,0,0,709,712,715,719,723,726,729,732,
+  },
+  {
+    735,738,741,744,747,750,753,756,759,762,765,768,771,774,777,780,
+    783,786,789,792,795,798,801,804,807,810,813,816,0,0,819,822,
+    0,0,0,0,0,0,825,828,831,834,837,841,845,849,853,856,
+    859,863,867,870,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    873,875,877,879,881,883,885,887,889,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,891,894,897,900,903,906,0,0,
+    909,911,913,915,917,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    919,921,0,923,925,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,928,0,0,0,0,0,930,0,0,0,933,0,
+  },
+  {
+    0,0,0,0,935,938,944,947,949,952,955,0,958,0,961,964,
+    967,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,971,974,977,980,983,986,
+    989,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,993,996,999,1002,1005,0,
+    1008,1010,1012,1014,1019,1024,1026,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1028,1030,1032,0,1034,1036,0,0,0,1038,0,0,0,0,0,0,
+  },
+  {
+    1040,1043,0,1046,0,0,0,1049,0,0,0,0,1052,1055,1058,0,
+    0,0,0,0,0,0,0,0,0,1061,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,1064,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1067,1070,0,1073,0,0,0,1076,0,0,0,0,1079,1082,1085,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,1088,1091,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,1094,1097,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1100,1103,1106,1109,0,0,1112,1115,0,0,1118,1121,1124,1127,1130,1133,
+    0,0,1136,1139,1142,1145,1148,1151,0,0,1154,1157,1160,1163,1166,1169,
+    1172,1175,1178,1181,1184,1187,0,0,1190,1193,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,1196,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,1199,1202,1205,1208,1211,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,1214,1217,1220,1223,0,0,0,0,0,0,0,
+  },
+  {
+    1226,0,1229,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1232,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,1235,0,0,0,0,0,0,
+    0,1238,0,0,1241,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,1244,1247,1250,1253,1256,1259,1262,1265,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,1268,1271,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,1274,1277,0,1280,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1283,0,0,1286,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,1289,1292,1295,0,0,1298,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,1301,0,0,1304,1307,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,1310,1313,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,1316,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,1319,1322,1325,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,1328,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    1331,0,0,0,0,0,0,1334,1337,0,1340,1343,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,1347,1350,1353,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,1356,0,1359,1362,1366,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1369,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1372,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,1375,1378,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,1381,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,1383,0,0,0,0,0,0,0,0,0,1386,0,0,
+    0,0,1389,0,0,0,0,1392,0,0,0,0,1395,0,0,0,
+    0,0,0,0,0,0,0,0,0,1398,0,0,0,0,0,0,
+    0,0,0,1401,0,1404,1407,1410,1414,1417,0,0,0,0,0,0,
+  },
+  {
+    0,1421,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1424,0,0,0,0,0,0,0,0,0,1427,0,0,
+    0,0,1430,0,0,0,0,1433,0,0,0,0,1436,0,0,0,
+    0,0,0,0,0,0,0,0,0,1439,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,1442,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,1445,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,1447,0,1450,0,1453,0,1456,0,1459,0,
+    0,0,1462,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1465,0,1468,0,0,
+  },
+  {
+    1471,1474,0,1477,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,1480,1482,1484,0,
+    1486,1488,1490,1492,1494,1496,1498,1500,1502,1504,1506,0,1508,1510,1512,1514,
+  },
+  {
+    1516,1518,1520,1522,1524,1526,1528,1530,1532,1534,1536,1538,1540,1542,0,1544,
+    1546,1548,1550,1552,1554,1556,1558,1560,1562,1564,1566,1568,1570,1572,1574,1576,
+    1578,1580,1582,1584,1586,1588,1590,1592,1594,1596,1598,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,1600,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1602,1604,1606,1608,1610,
+    1612,1614,1616,1618,1620,1622,1624,1626,1628,1630,1632,1634,1636,1638,1640,1642,
+    1644,1646,1648,1650,1652,1654,1656,1658,1660,1662,1664,1666,1668,1670,1672,1674,
+  },
+  {
+    1676,1679,1682,1685,1688,1691,1694,1697,1700,1704,1708,1711,1714,1717,1720,1723,
+    1726,1729,1732,1735,1738,1742,1746,1750,1754,1757,1760,1763,1766,1770,1774,1777,
+    1780,1783,1786,1789,1792,1795,1798,1801,1804,1807,1810,1813,1816,1819,1822,1826,
+    1830,1833,1836,1839,1842,1845,1848,1851,1854,1858,1862,1865,1868,1871,1874,1877,
+  },
+  {
+    1880,1883,1886,1889,1892,1895,1898,1901,1904,1907,1910,1913,1916,1920,1924,1928,
+    1932,1936,1940,1944,1948,1951,1954,1957,1960,1963,1966,1969,1972,1976,1980,1983,
+    1986,1989,1992,1995,1998,2002,2006,2010,2014,2018,2022,2025,2028,2031,2034,2037,
+    2040,2043,2046,2049,2052,2055,2058,2061,2064,2068,2072,2076,2080,2083,2086,2089,
+  },
+  {
+    2092,2095,2098,2101,2104,2107,2110,2113,2116,2119,2122,2125,2128,2131,2134,2137,
+    2140,2143,2146,2149,2152,2155,2158,2161,2164,2167,2170,2173,0,0,0,0,
+    2178,2181,2184,2187,2190,2194,2198,2202,2206,2210,2214,2218,2222,2226,2230,2234,
+    2238,2242,2246,2250,2254,2258,2262,2266,2270,2273,2276,2279,2282,2285,2288,2292,
+  },
+  {
+    2296,2300,2304,2308,2312,2316,2320,2324,2328,2331,2334,2337,2340,2343,2346,2349,
+    2352,2356,2360,2364,2368,2372,2376,2380,2384,2388,2392,2396,2400,2404,2408,2412,
+    2416,2420,2424,2428,2432,2435,2438,2441,2444,2448,2452,2456,2460,2464,2468,2472,
+    2476,2480,2484,2487,2490,2493,2496,2499,2502,2505,0,0,0,0,0,0,
+  },
+  {
+    2508,2511,2514,2518,2522,2526,2530,2534,2538,2541,2544,2548,2552,2556,2560,2564,
+    2568,2571,2574,2578,2582,2586,0,0,2590,2593,2596,2600,2604,2608,0,0,
+    2612,2615,2618,2622,2626,2630,2634,2638,2642,2645,2648,2652,2656,2660,2664,2668,
+    2672,2675,2678,2682,2686,2690,2694,2698,2702,2705,2708,2712,2716,2720,2724,2728,
+  },
+  {
+    2732,2735,2738,2742,2746,2750,0,0,2754,2757,2760,2764,2768,2772,0,0,
+    2776,2779,2782,2786,2790,2794,2798,2802,0,2806,0,2809,0,2813,0,2817,
+    2821,2824,2827,2831,2835,2839,2843,2847,2851,2854,2857,2861,2865,2869,2873,2877,
+    2881,2884,2887,2890,2893,2896,2899,2902,2905,2908,2911,2914,2917,2920,0,0,
+  },
+  {
+    2923,2927,2931,2936,2941,2946,2951,2956,2961,2965,2969,2974,2979,2984,2989,2994,
+    2999,3003,3007,3012,3017,3022,3027,3032,3037,3041,3045,3050,3055,3060,3065,3070,
+    3075,3079,3083,3088,3093,3098,3103,3108,3113,3117,3121,3126,3131,3136,3141,3146,
+    3151,3154,3157,3161,3164,0,3168,3171,3175,3178,3181,3184,3187,3190,3193,3195,
+  },
+  {
+    3198,3201,3207,3211,3214,0,3218,3221,3225,3228,3231,3234,3237,3240,3246,3252,
+    3258,3261,3264,3268,0,0,3272,3275,3279,3282,3285,3288,0,3291,3297,3303,
+    3309,3312,3315,3319,3323,3326,3329,3332,3336,3339,3342,3345,3348,3351,3357,3363,
+    0,0,3365,3369,3372,0,3376,3379,3383,3386,3389,3392,3395,3398,3402,0,
+  },
+  {
+    3405,3408,3411,3413,3415,3417,3419,3421,3423,3425,3427,0,0,0,0,0,
+    0,3429,0,0,0,0,0,3431,0,0,0,0,0,0,0,0,
+    0,0,0,0,3434,3436,3439,0,0,0,0,0,0,0,0,3443,
+    0,0,0,3445,3448,0,3452,3455,0,0,0,0,3459,0,3462,0,
+  },
+  {
+    0,0,0,0,0,0,0,3465,3468,3471,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,3474,0,0,0,0,0,0,0,3479,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    3481,3483,0,0,3485,3487,3489,3491,3493,3495,3497,3499,3501,3503,3505,3507,
+  },
+  {
+    3509,3511,3513,3515,3517,3519,3521,3523,3525,3527,3529,3531,3533,3535,3537,0,
+    3539,3541,3543,3545,3547,3549,3551,3553,3555,3557,3559,3561,3563,0,0,0,
+    0,0,0,0,0,0,0,0,3565,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    3568,3572,3576,3578,0,3581,3585,3589,0,3591,3594,3596,3598,3600,3602,3604,
+    3606,3608,3610,3612,0,3614,3616,0,0,3619,3621,3623,3625,3627,0,0,
+    3629,3632,3636,0,3639,0,3641,0,3643,0,3645,3647,3650,3652,0,3654,
+    3656,3658,0,3660,3662,3664,3666,3668,3670,3672,0,3674,3678,3680,3682,3684,
+  },
+  {
+    3686,0,0,0,0,3688,3690,3692,3694,3696,0,0,0,0,0,0,
+    3698,3702,3706,3711,3715,3719,3723,3727,3731,3735,3739,3743,3747,3751,3755,3759,
+    3762,3764,3767,3771,3774,3776,3779,3783,3788,3791,3793,3796,3800,3802,3804,3806,
+    3808,3810,3813,3817,3820,3822,3825,3829,3834,3837,3839,3842,3846,3848,3850,3852,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,3854,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,3858,3861,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,3864,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,3867,3870,3873,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,3876,0,0,0,0,3879,0,0,3882,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,3885,0,3888,0,0,0,0,0,3891,3894,0,3898,
+    3901,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,3905,0,0,3908,0,0,3911,0,3914,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    3917,0,3920,0,0,0,0,0,0,0,0,0,0,3923,3926,3929,
+    3932,3935,0,0,3938,3941,0,0,3944,3947,0,0,0,0,0,0,
+  },
+  {
+    3950,3953,0,0,3956,3959,0,0,3962,3965,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,3968,3971,3974,3977,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    3980,3983,3986,3989,0,0,0,0,0,0,3992,3995,3998,4001,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,4004,4006,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    4008,4010,4012,4014,4016,4018,4020,4022,4024,4026,4029,4032,4035,4038,4041,4044,
+    4047,4050,4053,4056,4059,4063,4067,4071,4075,4079,4083,4087,4091,4095,4100,4105,
+  },
+  {
+    4110,4115,4120,4125,4130,4135,4140,4145,4150,4153,4156,4159,4162,4165,4168,4171,
+    4174,4177,4181,4185,4189,4193,4197,4201,4205,4209,4213,4217,4221,4225,4229,4233,
+    4237,4241,4245,4249,4253,4257,4261,4265,4269,4273,4277,4281,4285,4289,4293,4297,
+    4301,4305,4309,4313,4317,4321,4325,4327,4329,4331,4333,4335,4337,4339,4341,4343,
+  },
+  {
+    4345,4347,4349,4351,4353,4355,4357,4359,4361,4363,4365,4367,4369,4371,4373,4375,
+    4377,4379,4381,4383,4385,4387,4389,4391,4393,4395,4397,4399,4401,4403,4405,4407,
+    4409,4411,4413,4415,4417,4419,4421,4423,4425,4427,4429,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,4431,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,4436,4440,4443,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,4447,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,4450,4452,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4454,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4456,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,4458,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    4460,4462,4464,4466,4468,4470,4472,4474,4476,4478,4480,4482,4484,4486,4488,4490,
+    4492,4494,4496,4498,4500,4502,4504,4506,4508,4510,4512,4514,4516,4518,4520,4522,
+    4524,4526,4528,4530,4532,4534,4536,4538,4540,4542,4544,4546,4548,4550,4552,4554,
+    4556,4558,4560,4562,4564,4566,4568,4570,4572,4574,4576,4578,4580,4582,4584,4586,
+  },
+  {
+    4588,4590,4592,4594,4596,4598,4600,4602,4604,4606,4608,4610,4612,4614,4616,4618,
+    4620,4622,4624,4626,4628,4630,4632,4634,4636,4638,4640,4642,4644,4646,4648,4650,
+    4652,4654,4656,4658,4660,4662,4664,4666,4668,4670,4672,4674,4676,4678,4680,4682,
+    4684,4686,4688,4690,4692,4694,4696,4698,4700,4702,4704,4706,4708,4710,4712,4714,
+  },
+  {
+    4716,4718,4720,4722,4724,4726,4728,4730,4732,4734,4736,4738,4740,4742,4744,4746,
+    4748,4750,4752,4754,4756,4758,4760,4762,4764,4766,4768,4770,4772,4774,4776,4778,
+    4780,4782,4784,4786,4788,4790,4792,4794,4796,4798,4800,4802,4804,4806,4808,4810,
+    4812,4814,4816,4818,4820,4822,4824,4826,4828,4830,4832,4834,4836,4838,4840,4842,
+  },
+  {
+    4844,4846,4848,4850,4852,4854,4856,4858,4860,4862,4864,4866,4868,4870,4872,4874,
+    4876,4878,4880,4882,4884,4886,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    4888,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,4890,0,4892,4894,4896,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,4898,0,4901,0,
+    4904,0,4907,0,4910,0,4913,0,4916,0,4919,0,4922,0,4925,0,
+    4928,0,4931,0,0,4934,0,4937,0,4940,0,0,0,0,0,0,
+    4943,4946,0,4949,4952,0,4955,4958,0,4961,4964,0,4967,4970,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,4973,0,0,0,0,0,0,4976,4979,0,4982,4985,
+    0,0,0,0,0,0,0,0,0,0,0,0,4988,0,4991,0,
+    4994,0,4997,0,5000,0,5003,0,5006,0,5009,0,5012,0,5015,0,
+  },
+  {
+    5018,0,5021,0,0,5024,0,5027,0,5030,0,0,0,0,0,0,
+    5033,5036,0,5039,5042,0,5045,5048,0,5051,5054,0,5057,5060,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,5063,0,0,5066,5069,5072,5075,0,0,0,5078,5081,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,5084,5086,5088,5090,5092,5094,5096,5098,5100,5102,5104,5106,5108,5110,5112,
+  },
+  {
+    5114,5116,5118,5120,5122,5124,5126,5128,5130,5132,5134,5136,5138,5140,5142,5144,
+    5146,5148,5150,5152,5154,5156,5158,5160,5162,5164,5166,5168,5170,5172,5174,5176,
+    5178,5180,5182,5184,5186,5188,5190,5192,5194,5196,5198,5200,5202,5204,5206,5208,
+    5210,5212,5214,5216,5218,5220,5222,5224,5226,5228,5230,5232,5234,5236,5238,5240,
+  },
+  {
+    5242,5244,5246,5248,5250,5252,5254,5256,5258,5260,5262,5264,5266,5268,5270,0,
+    0,0,5272,5274,5276,5278,5280,5282,5284,5286,5288,5290,5292,5294,5296,5298,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    5300,5304,5308,5312,5316,5320,5324,5328,5332,5336,5340,5344,5348,5352,5356,5361,
+    5366,5371,5376,5381,5386,5391,5396,5401,5406,5411,5416,5421,5426,5431,5439,0,
+    5446,5450,5454,5458,5462,5466,5470,5474,5478,5482,5486,5490,5494,5498,5502,5506,
+    5510,5514,5518,5522,5526,5530,5534,5538,5542,5546,5550,5554,5558,5562,5566,5570,
+  },
+  {
+    5574,5578,5582,5586,5590,5592,5594,5596,0,0,0,0,0,0,0,0,
+    5598,5602,5605,5608,5611,5614,5617,5620,5623,5626,5629,5632,5635,5638,5641,5644,
+    5647,5649,5651,5653,5655,5657,5659,5661,5663,5665,5667,5669,5671,5673,5675,5678,
+    5681,5684,5687,5690,5693,5696,5699,5702,5705,5708,5711,5714,5717,5723,5728,0,
+  },
+  {
+    5731,5733,5735,5737,5739,5741,5743,5745,5747,5749,5751,5753,5755,5757,5759,5761,
+    5763,5765,5767,5769,5771,5773,5775,5777,5779,5781,5783,5785,5787,5789,5791,5793,
+    5795,5797,5799,5801,5803,5805,5807,5809,5811,5813,5815,5817,5819,5821,5823,5825,
+    5827,5829,5832,5835,5838,5841,5844,5847,5850,5853,5856,5859,5862,5865,5868,5871,
+  },
+  {
+    5874,5877,5880,5883,5886,5889,5892,5895,5898,5901,5905,5909,5913,5916,5920,5923,
+    5927,5929,5931,5933,5935,5937,5939,5941,5943,5945,5947,5949,5951,5953,5955,5957,
+    5959,5961,5963,5965,5967,5969,5971,5973,5975,5977,5979,5981,5983,5985,5987,5989,
+    5991,5993,5995,5997,5999,6001,6003,6005,6007,6009,6011,6013,6015,6017,6019,6021,
+  },
+  {
+    6024,6030,6035,6041,6045,6051,6055,6059,6066,6071,6075,6079,6083,6088,6093,6098,
+    6103,6108,6113,6118,6125,6128,6135,6142,6148,6153,6160,6167,6172,6176,6180,6185,
+    6190,6196,6202,6206,6210,6215,6219,6223,6226,6229,6233,6237,6244,6249,6255,6262,
+    6267,6271,6275,6282,6287,6294,6298,6304,6308,6313,6317,6322,6328,6333,6339,6344,
+  },
+  {
+    6347,6353,6357,6361,6366,6370,6374,6378,6384,6389,6392,6399,6403,6409,6414,6419,
+    6423,6427,6432,6435,6440,6446,6449,6456,6460,6463,6466,6469,6472,6475,6478,6481,
+    6484,6487,6490,6494,6498,6502,6506,6510,6514,6518,6522,6526,6530,6534,6538,6542,
+    6546,6550,6554,6557,6560,6564,6567,6570,6573,6577,6581,6584,6587,6590,6593,6596,
+  },
+  {
+    6601,6604,6607,6610,6613,6616,6619,6622,6625,6629,6634,6637,6640,6643,6646,6649,
+    6652,6655,6659,6663,6667,6671,6674,6677,6680,6683,6686,6689,6692,6695,6698,6701,
+    6705,6709,6712,6716,6720,6724,6727,6731,6735,6740,6743,6747,6751,6755,6759,6765,
+    6772,6775,6778,6781,6784,6787,6790,6793,6796,6799,6802,6805,6808,6811,6814,6817,
+  },
+  {
+    6820,6823,6826,6831,6834,6837,6840,6845,6849,6852,6855,6858,6861,6864,6867,6870,
+    6873,6876,6879,6883,6886,6889,6893,6897,6900,6905,6909,6912,6915,6918,6921,6925,
+    6929,6932,6935,6938,6941,6944,6947,6950,6953,6956,6960,6964,6968,6972,6976,6980,
+    6984,6988,6992,6996,7000,7004,7008,7012,7016,7020,7024,7028,7032,7036,7040,7044,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,7048,7050,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    7052,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,7054,7056,7058,0,0,0,7060,7062,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,7064,7066,7068,7070,
+    0,0,0,0,0,0,0,0,0,7072,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    7074,7076,7078,7080,7082,7084,7086,7088,7090,7092,7094,7096,7098,7100,7102,7104,
+    7106,7108,7110,7112,7114,7116,7118,7120,7122,7124,7126,7128,7130,7132,7134,7136,
+    7138,7140,7142,7144,7146,7148,7150,7152,7154,7156,7158,7160,7162,7164,7166,7168,
+    7170,7172,7174,7176,7178,7180,7182,7184,7186,7188,7190,7192,7194,7196,7198,7200,
+  },
+  {
+    7202,7204,7206,7208,7210,7212,7214,7216,7218,7220,7222,7224,7226,7228,7230,7232,
+    7234,7236,7238,7240,7242,7244,7246,7248,7250,7252,7254,7256,7258,7260,7262,7264,
+    7266,7268,7270,7272,7274,7276,7278,7280,7282,7284,7286,7288,7290,7292,7294,7296,
+    7298,7300,7302,7304,7306,7308,7310,7312,7314,7316,7318,7320,7322,7324,7326,7328,
+  },
+  {
+    7330,7332,7334,7336,7338,7340,7342,7344,7346,7348,7350,7352,7354,7356,7358,7360,
+    7362,7364,7366,7368,7370,7372,7374,7376,7378,7380,7382,7384,7386,7388,7390,7392,
+    7394,7396,7398,7400,7402,7404,7406,7408,7410,7412,7414,7416,7418,7420,7422,7424,
+    7426,7428,7430,7432,7434,7436,7438,7440,7442,7444,7446,7448,7450,7452,7454,7456,
+  },
+  {
+    7458,7460,7462,7464,7466,7468,7470,7472,7474,7476,7478,7480,7482,7484,7486,7488,
+    7490,7492,7494,7496,7498,7500,7502,7504,7506,7508,7510,7512,7514,7516,7518,7520,
+    7522,7524,7526,7528,7530,7532,7534,7536,7538,7540,7542,7544,7546,7548,7550,7552,
+    7554,7556,7558,7560,7562,7564,7566,7568,7570,7572,7574,7576,7578,7580,7582,7584,
+  },
+  {
+    7586,7588,7590,7592,7594,7596,7598,7600,7602,7604,7606,7608,7610,7612,0,0,
+    7614,0,7616,0,0,7618,7620,7622,7624,7626,7628,7630,7632,7634,7636,0,
+    7638,0,7640,0,0,7642,7644,0,0,0,7646,7648,7650,7652,7654,7656,
+    7658,7660,7662,7664,7666,7668,7670,7672,7674,7676,7678,7680,7682,7684,7686,7688,
+  },
+  {
+    7690,7692,7694,7696,7698,7700,7702,7704,7706,7708,7710,7712,7714,7716,7718,7720,
+    7722,7724,7726,7728,7730,7732,7734,7736,7738,7740,7742,7744,7746,7748,7750,7752,
+    7754,7756,7758,7760,7762,7764,7766,7768,7770,7772,7774,7776,7778,7780,0,0,
+    7782,7784,7786,7788,7790,7792,7794,7796,7798,7800,7802,7804,7806,7808,7810,7812,
+  },
+  {
+    7814,7816,7818,7820,7822,7824,7826,7828,7830,7832,7834,7836,7838,7840,7842,7844,
+    7846,7848,7850,7852,7854,7856,7858,7860,7862,7864,7866,7868,7870,7872,7874,7876,
+    7878,7880,7882,7884,7886,7888,7890,7892,7894,7896,7898,7900,7902,7904,7906,7908,
+    7910,7912,7914,7916,7918,7920,7922,7924,7926,7928,7930,7932,7934,7936,7938,7940,
+  },
+  {
+    7942,7944,7946,7948,7950,7952,7954,7956,7958,7960,7962,7964,7966,7968,7970,7972,
+    7974,7976,7978,7980,7982,7984,7986,7988,7990,7992,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    7994,7997,8000,8003,8007,8011,8014,0,0,0,0,0,0,0,0,0,
+    0,0,0,8017,8020,8023,8026,8029,0,0,0,0,0,8032,0,8035,
+    8038,8040,8042,8044,8046,8048,8050,8052,8054,8056,8058,8061,8064,8068,8072,8075,
+    8078,8081,8084,8087,8090,8093,8096,0,8099,8102,8105,8108,8111,0,8114,0,
+  },
+  {
+    8117,8120,0,8123,8126,0,8129,8132,8135,8138,8141,8144,8147,8150,8153,8156,
+    8159,8161,8163,8165,8167,8169,8171,8173,8175,8177,8179,8181,8183,8185,8187,8189,
+    8191,8193,8195,8197,8199,8201,8203,8205,8207,8209,8211,8213,8215,8217,8219,8221,
+    8223,8225,8227,8229,8231,8233,8235,8237,8239,8241,8243,8245,8247,8249,8251,8253,
+  },
+  {
+    8255,8257,8259,8261,8263,8265,8267,8269,8271,8273,8275,8277,8279,8281,8283,8285,
+    8287,8289,8291,8293,8295,8297,8299,8301,8303,8305,8307,8309,8311,8313,8315,8317,
+    8319,8321,8323,8325,8327,8330,8333,8335,8337,8339,8341,8343,8345,8347,8349,8351,
+    8353,8356,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,8359,8361,8363,8365,8367,8369,8371,8373,8375,8377,8379,8382,8384,
+    8386,8388,8390,8392,8394,8396,8398,8400,8402,8404,8406,8410,8414,8418,8422,8426,
+    8430,8434,8438,8442,8446,8450,8454,8458,8462,8466,8470,8474,8478,8480,8482,8484,
+  },
+  {
+    8486,8490,8494,8498,8502,8506,8509,8512,8515,8518,8521,8524,8527,8530,8533,8536,
+    8539,8542,8545,8548,8551,8554,8557,8560,8563,8566,8569,8572,8575,8578,8581,8584,
+    8587,8590,8593,8596,8599,8602,8605,8608,8611,8614,8617,8620,8623,8626,8629,8632,
+    8635,8638,8641,8644,8647,8650,8653,8656,8659,8662,8665,8668,8671,8674,8677,8680,
+  },
+  {
+    8683,8686,8689,8692,8695,8698,8701,8704,8707,8710,8713,8716,8719,8722,8725,8728,
+    8731,8734,8737,8740,8743,8746,8749,8752,8755,8758,8761,8764,8767,8770,8773,8777,
+    8781,8785,8789,8793,8797,8801,8805,8809,8813,8817,8821,8824,8827,8830,8833,8836,
+    8839,8842,8845,8848,8851,8854,8857,8860,8863,8866,8869,8872,8875,8878,8881,8884,
+  },
+  {
+    8887,8890,8893,8896,8899,8902,8905,8908,8911,8914,8917,8920,8923,8926,8929,8932,
+    8935,8938,8941,8944,8947,8950,8953,8956,8960,8964,8968,8972,8976,8979,8982,8985,
+    8988,8991,8994,8997,9000,9003,9006,9009,9012,9015,9018,9021,9024,9027,9030,9033,
+    9036,9039,9042,9045,9048,9051,9054,9057,9060,9063,9066,9069,9072,9075,9078,9081,
+  },
+  {
+    9084,9087,9090,9093,9096,9099,9102,9105,9108,9111,9114,9117,9120,9123,9126,9129,
+    9132,9135,9138,9141,9144,9147,9150,9153,9156,9159,9162,9165,9168,9171,9174,9177,
+    9181,9185,9188,9191,9194,9197,9200,9203,9206,9209,9212,9215,9218,9221,9224,9227,
+    9230,9233,9236,9240,9244,9248,9251,9254,9257,9260,9263,9266,9269,9272,9275,9278,
+  },
+  {
+    9281,9284,9287,9290,9293,9296,9299,9302,9305,9308,9311,9314,9317,9320,9323,9326,
+    9329,9332,9335,9338,9341,9344,9347,9350,9353,9356,9359,9362,9365,9368,9371,9374,
+    9377,9380,9383,9386,9389,9392,9395,9398,9401,9404,9407,9410,9413,9416,9419,9422,
+    9425,9428,9431,9434,9437,9440,9443,9446,9449,9452,9455,9458,9461,9464,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    9467,9471,9475,9479,9483,9487,9491,9495,9499,9503,9507,9511,9515,9519,9523,9527,
+    9531,9535,9539,9543,9547,9551,9555,9559,9563,9567,9571,9575,9579,9583,9587,9591,
+    9595,9599,9603,9607,9611,9615,9619,9623,9627,9631,9635,9639,9643,9647,9651,9655,
+  },
+  {
+    9659,9663,9667,9671,9675,9679,9683,9687,9691,9695,9699,9703,9707,9711,9715,9719,
+    0,0,9723,9727,9731,9735,9739,9743,9747,9751,9755,9759,9763,9767,9771,9775,
+    9779,9783,9787,9791,9795,9799,9803,9807,9811,9815,9819,9823,9827,9831,9835,9839,
+    9843,9847,9851,9855,9859,9863,9867,9871,9875,9879,9883,9887,9891,9895,9899,9903,
+  },
+  {
+    9907,9911,9915,9919,9923,9927,9931,9935,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    9939,9943,9947,9952,9957,9962,9967,9972,9977,9982,9986,10005,10014,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    10019,10021,10023,10025,10027,10029,10031,10033,10035,10037,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    10041,10044,10046,10048,10050,10052,10054,10056,10058,10060,10062,10064,10066,10068,10070,10072,
+  },
+  {
+    10074,10076,10078,10080,10082,0,0,10084,10086,10088,10091,10094,10097,10100,10102,10104,
+    10106,10108,10110,0,10112,10114,10116,10118,10120,10122,10124,10126,10128,10130,10132,10134,
+    10136,10138,10140,10142,10144,10146,10148,0,10150,10152,10154,10156,0,0,0,0,
+    10158,10161,10164,0,10167,0,10170,10173,10176,10179,10182,10185,10188,10191,10194,10197,
+  },
+  {
+    10200,10202,10205,10208,10211,10214,10217,10220,10223,10226,10229,10232,10235,10238,10240,10242,
+    10244,10246,10248,10250,10252,10254,10256,10258,10260,10262,10264,10266,10268,10270,10272,10274,
+    10276,10278,10280,10282,10284,10286,10288,10290,10292,10294,10296,10298,10300,10302,10304,10306,
+    10308,10310,10312,10314,10316,10318,10320,10322,10324,10326,10328,10330,10332,10334,10336,10338,
+  },
+  {
+    10340,10342,10344,10346,10348,10350,10352,10354,10356,10358,10360,10362,10364,10366,10368,10370,
+    10372,10374,10376,10378,10380,10382,10384,10386,10388,10390,10392,10394,10396,10398,10400,10402,
+    10404,10406,10408,10410,10412,10414,10416,10418,10420,10422,10424,10426,10428,10430,10432,10434,
+    10436,10438,10440,10442,10444,10446,10450,10454,10458,10462,10466,10470,10473,0,0,0,
+  },
+  {
+    0,10476,10478,10480,10482,10484,10486,10488,10490,10492,10494,10496,10498,10500,10502,10504,
+    10506,10508,10510,10512,10514,10516,10518,10520,10522,10524,10526,10528,10530,10532,10534,10536,
+    10538,10540,10542,10544,10546,10548,10550,10552,10554,10556,10558,10560,10562,10564,10566,10568,
+    10570,10572,10574,10576,10578,10580,10582,10584,10586,10588,10590,10592,10594,10596,10598,10600,
+  },
+  {
+    10602,10604,10606,10608,10610,10612,10614,10616,10618,10620,10622,10624,10626,10628,10630,10632,
+    10634,10636,10638,10640,10642,10644,10646,10648,10650,10652,10654,10656,10658,10660,10662,10664,
+    10666,10668,10670,10672,10674,10676,10678,10680,10682,10684,10686,10688,10690,10692,10694,10696,
+    10698,10700,10702,10704,10706,10708,10710,10712,10714,10716,10718,10720,10722,10724,10726,10728,
+  },
+  {
+    10730,10732,10734,10736,10738,10740,10742,10744,10746,10748,10750,10752,10754,10756,10758,10760,
+    10762,10764,10766,10768,10770,10772,10774,10776,10778,10780,10782,10784,10786,10788,10790,10792,
+    10794,10796,10798,10800,10802,10804,10806,10808,10810,10812,10814,10816,10818,10820,10822,10824,
+    10826,10828,10830,10832,10834,10836,10838,10840,10842,10844,10846,10848,10850,10852,10854,0,
+  },
+  {
+    0,0,10856,10858,10860,10862,10864,10866,0,0,10868,10870,10872,10874,10876,10878,
+    0,0,10880,10882,10884,10886,10888,10890,0,0,10892,10894,10896,0,0,0,
+    10898,10900,10902,10904,10907,10909,10911,0,10913,10915,10917,10919,10921,10923,10925,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,10927,10929,10931,10933,10935,0,10937,10939,10941,10943,10945,10947,10949,10951,10953,
+    10955,10957,10959,10961,10963,10965,10967,10969,10971,10973,10975,10977,10979,10981,10983,10985,
+    10987,10989,10991,10993,10995,10997,10999,11001,11003,11005,11007,11009,11011,11013,11015,11017,
+    11019,0,11021,11023,11025,11027,11029,11031,11033,11035,11037,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,11039,0,11042,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,11045,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,11048,11051,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,11054,11057,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,11060,11063,0,11066,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,11069,11072,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,11075,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,11078,11081,
+    11084,11088,11092,11096,11100,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,11104,11107,11110,11114,11118,
+  },
+  {
+    11122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    11126,11128,11130,11132,11134,11136,11138,11140,11142,11144,11146,11148,11150,11152,11154,11156,
+    11158,11160,11162,11164,11166,11168,11170,11172,11174,11176,11178,11180,11182,11184,11186,11188,
+    11190,11192,11194,11196,11198,11200,11202,11204,11206,11208,11210,11212,11214,11216,11218,11220,
+    11222,11224,11226,11228,11230,11232,11234,11236,11238,11240,11242,11244,11246,11248,11250,11252,
+  },
+  {
+    11254,11256,11258,11260,11262,11264,11266,11268,11270,11272,11274,11276,11278,11280,11282,11284,
+    11286,11288,11290,11292,11294,0,11296,11298,11300,11302,11304,11306,11308,11310,11312,11314,
+    11316,11318,11320,11322,11324,11326,11328,11330,11332,11334,11336,11338,11340,11342,11344,11346,
+    11348,11350,11352,11354,11356,11358,11360,11362,11364,11366,11368,11370,11372,11374,11376,11378,
+  },
+  {
+    11380,11382,11384,11386,11388,11390,11392,11394,11396,11398,11400,11402,11404,11406,11408,11410,
+    11412,11414,11416,11418,11420,11422,11424,11426,11428,11430,11432,11434,11436,0,11438,11440,
+    0,0,11442,0,0,11444,11446,0,0,11448,11450,11452,11454,0,11456,11458,
+    11460,11462,11464,11466,11468,11470,11472,11474,11476,11478,0,11480,0,11482,11484,11486,
+  },
+  {
+    11488,11490,11492,11494,0,11496,11498,11500,11502,11504,11506,11508,11510,11512,11514,11516,
+    11518,11520,11522,11524,11526,11528,11530,11532,11534,11536,11538,11540,11542,11544,11546,11548,
+    11550,11552,11554,11556,11558,11560,11562,11564,11566,11568,11570,11572,11574,11576,11578,11580,
+    11582,11584,11586,11588,11590,11592,11594,11596,11598,11600,11602,11604,11606,11608,11610,11612,
+  },
+  {
+    11614,11616,11618,11620,11622,11624,0,11626,11628,11630,11632,0,0,11634,11636,11638,
+    11640,11642,11644,11646,11648,0,11650,11652,11654,11656,11658,11660,11662,0,11664,11666,
+    11668,11670,11672,11674,11676,11678,11680,11682,11684,11686,11688,11690,11692,11694,11696,11698,
+    11700,11702,11704,11706,11708,11710,11712,11714,11716,11718,0,11720,11722,11724,11726,0,
+  },
+  {
+    11728,11730,11732,11734,11736,0,11738,0,0,0,11740,11742,11744,11746,11748,11750,
+    11752,0,11754,11756,11758,11760,11762,11764,11766,11768,11770,11772,11774,11776,11778,11780,
+    11782,11784,11786,11788,11790,11792,11794,11796,11798,11800,11802,11804,11806,11808,11810,11812,
+    11814,11816,11818,11820,11822,11824,11826,11828,11830,11832,11834,11836,11838,11840,11842,11844,
+  },
+  {
+    11846,11848,11850,11852,11854,11856,11858,11860,11862,11864,11866,11868,11870,11872,11874,11876,
+    11878,11880,11882,11884,11886,11888,11890,11892,11894,11896,11898,11900,11902,11904,11906,11908,
+    11910,11912,11914,11916,11918,11920,11922,11924,11926,11928,11930,11932,11934,11936,11938,11940,
+    11942,11944,11946,11948,11950,11952,11954,11956,11958,11960,11962,11964,11966,11968,11970,11972,
+  },
+  {
+    11974,11976,11978,11980,11982,11984,11986,11988,11990,11992,11994,11996,11998,12000,12002,12004,
+    12006,12008,12010,12012,12014,12016,12018,12020,12022,12024,12026,12028,12030,12032,12034,12036,
+    12038,12040,12042,12044,12046,12048,12050,12052,12054,12056,12058,12060,12062,12064,12066,12068,
+    12070,12072,12074,12076,12078,12080,12082,12084,12086,12088,12090,12092,12094,12096,12098,12100,
+  },
+  {
+    12102,12104,12106,12108,12110,12112,12114,12116,12118,12120,12122,12124,12126,12128,12130,12132,
+    12134,12136,12138,12140,12142,12144,12146,12148,12150,12152,12154,12156,12158,12160,12162,12164,
+    12166,12168,12170,12172,12174,12176,12178,12180,12182,12184,12186,12188,12190,12192,12194,12196,
+    12198,12200,12202,12204,12206,12208,12210,12212,12214,12216,12218,12220,12222,12224,12226,12228,
+  },
+  {
+    12230,12232,12234,12236,12238,12240,12242,12244,12246,12248,12250,12252,12254,12256,12258,12260,
+    12262,12264,12266,12268,12270,12272,12274,12276,12278,12280,12282,12284,12286,12288,12290,12292,
+    12294,12296,12298,12300,12302,12304,12306,12308,12310,12312,12314,12316,12318,12320,12322,12324,
+    12326,12328,12330,12332,12334,12336,12338,12340,12342,12344,12346,12348,12350,12352,12354,12356,
+  },
+  {
+    12358,12360,12362,12364,12366,12368,12370,12372,12374,12376,12378,12380,12382,12384,12386,12388,
+    12390,12392,12394,12396,12398,12400,12402,12404,12406,12408,12410,12412,12414,12416,12418,12420,
+    12422,12424,12426,12428,12430,12432,0,0,12434,12436,12438,12440,12442,12444,12446,12448,
+    12450,12452,12454,12456,12458,12460,12462,12464,12466,12468,12470,12472,12474,12476,12478,12480,
+  },
+  {
+    12482,12484,12486,12488,12490,12492,12494,12496,12498,12500,12502,12504,12506,12508,12510,12512,
+    12514,12516,12518,12520,12522,12524,12526,12528,12530,12532,12534,12536,12538,12540,12542,12544,
+    12546,12548,12550,12552,12554,12556,12558,12560,12562,12564,12566,12568,12570,12572,12574,12576,
+    12578,12580,12582,12584,12586,12588,12590,12592,12594,12596,12598,12600,12602,12604,12606,12608,
+  },
+  {
+    12610,12612,12614,12616,12618,12620,12622,12624,12626,12628,12630,12632,12634,12636,12638,12640,
+    12642,12644,12646,12648,12650,12652,12654,12656,12658,12660,12662,12664,12666,12668,12670,12672,
+    12674,12676,12678,12680,12682,12684,12686,12688,12690,12692,12694,12696,12698,12700,12702,12704,
+    12706,12708,12710,12712,12714,12716,12718,12720,12722,12724,12726,12728,12730,12732,12734,12736,
+  },
+  {
+    12738,12740,12742,12744,12746,12748,12750,12752,12754,12756,12758,12760,12762,12764,12766,12768,
+    12770,12772,12774,12776,12778,12780,12782,12784,12786,12788,12790,12792,12794,12796,12798,12800,
+    12802,12804,12806,12808,12810,12812,12814,12816,12818,12820,12822,12824,12826,12828,12830,12832,
+    12834,12836,12838,12840,12842,12844,12846,12848,12850,12852,12854,12856,12858,12860,12862,12864,
+  },
+  {
+    12866,12868,12870,12872,12874,12876,12878,12880,12882,12884,12886,12888,12890,12892,12894,12896,
+    12898,12900,12902,12904,12906,12908,12910,12912,12914,12916,12918,12920,12922,12924,12926,12928,
+    12930,12932,12934,12936,12938,12940,12942,12944,12946,12948,12950,12952,12954,12956,12958,12960,
+    12962,12964,12966,12968,12970,12972,12974,12976,12978,12980,12982,12984,12986,12988,12990,12992,
+  },
+  {
+    12994,12996,12998,13000,13002,13004,13006,13008,13010,13012,13014,13016,0,0,13018,13020,
+    13022,13024,13026,13028,13030,13032,13034,13036,13038,13040,13042,13044,13046,13048,13050,13052,
+    13054,13056,13058,13060,13062,13064,13066,13068,13070,13072,13074,13076,13078,13080,13082,13084,
+    13086,13088,13090,13092,13094,13096,13098,13100,13102,13104,13106,13108,13110,13112,13114,13116,
+  },
+  {
+    13118,13120,13122,13124,0,13126,13128,13130,13132,13134,13136,13138,13140,13142,13144,13146,
+    13148,13150,13152,13154,13156,13158,13160,13162,13164,13166,13168,13170,13172,13174,13176,13178,
+    0,13180,13182,0,13184,0,0,13186,0,13188,13190,13192,13194,13196,13198,13200,
+    13202,13204,13206,0,13208,13210,13212,13214,0,13216,0,13218,0,0,0,0,
+  },
+  {
+    0,0,13220,0,0,0,0,13222,0,13224,0,13226,0,13228,13230,13232,
+    0,13234,13236,0,13238,0,0,13240,0,13242,0,13244,0,13246,0,13248,
+    0,13250,13252,0,13254,0,0,13256,13258,13260,13262,0,13264,13266,13268,13270,
+    13272,13274,13276,0,13278,13280,13282,13284,0,13286,13288,13290,13292,0,13294,0,
+  },
+  {
+    13296,13298,13300,13302,13304,13306,13308,13310,13312,13314,0,13316,13318,13320,13322,13324,
+    13326,13328,13330,13332,13334,13336,13338,13340,13342,13344,13346,13348,0,0,0,0,
+    0,13350,13352,13354,0,13356,13358,13360,13362,13364,0,13366,13368,13370,13372,13374,
+    13376,13378,13380,13382,13384,13386,13388,13390,13392,13394,13396,13398,0,0,0,0,
+  },
+  {
+    13400,13403,13406,13409,13412,13415,13418,13421,13424,13427,13430,0,0,0,0,0,
+    13433,13437,13441,13445,13449,13453,13457,13461,13465,13469,13473,13477,13481,13485,13489,13493,
+    13497,13501,13505,13509,13513,13517,13521,13525,13529,13533,13537,13541,13543,13545,13548,0,
+    13551,13553,13555,13557,13559,13561,13563,13565,13567,13569,13571,13573,13575,13577,13579,13581,
+  },
+  {
+    13583,13585,13587,13589,13591,13593,13595,13597,13599,13601,13603,13606,13609,13612,13615,13619,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,13622,13625,13628,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    13631,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    13634,13637,13640,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    13642,13644,13646,13648,13651,13653,13655,13657,13659,13661,13663,13665,13667,13669,13671,13673,
+    13675,13677,13679,13681,13683,13685,13687,13689,13691,13693,13695,13697,13699,13701,13703,13705,
+    13707,13709,13711,13713,13715,13717,13719,13721,13723,13725,13727,13729,0,0,0,0,
+  },
+  {
+    13731,13735,13739,13743,13747,13751,13755,13759,13763,0,0,0,0,0,0,0,
+    13767,13769,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+  {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    13771,13773,13775,13777,13779,13781,13783,13785,13787,13789,0,0,0,0,0,0,
+  },
+  {
+    13791,13793,13795,13797,13799,13801,13803,13805,13807,13809,13811,13813,13815,13817,13819,13821,
+    13823,13825,13827,13829,13831,13833,13835,13837,13839,13841,13843,13845,13847,13849,13851,13853,
+    13855,13857,13859,13861,13863,13865,13867,13869,13871,13873,13875,13877,13879,13881,13883,13885,
+    13887,13889,13891,13893,13895,13897,13899,13901,13903,13905,13907,13909,13911,13913,13915,13917,
+  },
+  {
+    13919,13921,13923,13925,13927,13929,13931,13933,13935,13937,13939,13941,13943,13945,13947,13949,
+    13951,13953,13955,13957,13959,13961,13963,13965,13967,13969,13971,13973,13975,13977,13979,13981,
+    13983,13985,13987,13989,13991,13993,13995,13997,13999,14001,14003,14005,14007,14009,14011,14013,
+    14015,14017,14019,14021,14023,14025,14027,14029,14031,14033,14035,14037,14039,14041,14043,14045,
+  },
+  {
+    14047,14049,14051,14053,14055,14057,14059,14061,14063,14065,14067,14069,14071,14073,14075,14077,
+    14079,14081,14083,14085,14087,14089,14091,14093,14095,14097,14099,14101,14103,14105,14107,14109,
+    14111,14113,14115,14117,14119,14121,14123,14125,14127,14129,14131,14133,14135,14137,14139,14141,
+    14143,14145,14147,14149,14151,14153,14155,14157,14159,14161,14163,14165,14167,14169,14171,14173,
+  },
+  {
+    14175,14177,14179,14181,14183,14185,14187,14189,14191,14193,14195,14197,14199,14201,14203,14205,
+    14207,14209,14211,14213,14215,14217,14219,14221,14223,14225,14227,14229,14231,14233,14235,14237,
+    14239,14241,14243,14245,14247,14249,14251,14253,14255,14257,14259,14261,14263,14265,14267,14269,
+    14271,14273,14275,14277,14279,14281,14283,14285,14287,14289,14291,14293,14295,14297,14299,14301,
+  },
+  {
+    14303,14305,14307,14309,14311,14313,14315,14317,14319,14321,14323,14325,14327,14329,14331,14333,
+    14335,14337,14339,14341,14343,14345,14347,14349,14351,14353,14355,14357,14359,14361,14363,14365,
+    14367,14369,14371,14373,14375,14377,14379,14381,14383,14385,14387,14389,14391,14393,14395,14397,
+    14399,14401,14403,14405,14407,14409,14411,14413,14415,14417,14419,14421,14423,14425,14427,14429,
+  },
+  {
+    14431,14433,14435,14437,14439,14441,14443,14445,14447,14449,14451,14453,14455,14457,14459,14461,
+    14463,14465,14467,14469,14471,14473,14475,14477,14479,14481,14483,14485,14487,14489,14491,14493,
+    14495,14497,14499,14501,14503,14505,14507,14509,14511,14513,14515,14517,14519,14521,14523,14525,
+    14527,14529,14531,14533,14535,14537,14539,14541,14543,14545,14547,14549,14551,14553,14555,14557,
+  },
+  {
+    14559,14561,14563,14565,14567,14569,14571,14573,14575,14577,14579,14581,14583,14585,14587,14589,
+    14591,14593,14595,14597,14599,14601,14603,14605,14607,14609,14611,14613,14615,14617,14619,14621,
+    14623,14625,14627,14629,14631,14633,14635,14637,14639,14641,14643,14645,14647,14649,14651,14653,
+    14655,14657,14659,14661,14663,14665,14667,14669,14671,14673,14675,14677,14679,14681,14683,14685,
+  },
+  {
+    14687,14689,14691,14693,14695,14697,14699,14701,14703,14705,14707,14709,14711,14713,14715,14717,
+    14719,14721,14723,14725,14727,14729,14731,14733,14735,14737,14739,14741,14743,14745,14747,14749,
+    14751,14753,14755,14757,14759,14761,14763,14765,14767,14769,14771,14773,14775,14777,14779,14781,
+    14783,14785,14787,14789,14791,14793,14795,14797,14799,14801,14803,14805,14807,14809,14811,14813,
+  },
+  {
+    14815,14817,14819,14821,14823,14825,14827,14829,14831,14833,14835,14837,14839,14841,14843,14845,
+    14847,14849,14851,14853,14855,14857,14859,14861,14863,14865,14867,14869,14871,14873,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  },
+};
+
+static inline u16 normDecompOffset(u32 uc) {
+  return (uc < 0x2FA40) ? normDecompOffsetBlocks[normDecompOffsetIndex[uc >> 6]][uc & 0x3f] : 0;
+}
+
+static const u32 normDecompData[14875] = {
+  0x0,0x100,0x20,0x200,0x20,0x308,0x100,0x61,
+  0x200,0x20,0x304,0x100,0x32,0x100,0x33,0x200,
+  0x20,0x301,0x100,0x3BC,0x200,0x20,0x327,0x100,
+  0x31,0x100,0x6F,0x300,0x31,0x2044,0x34,0x300,
+  0x31,0x2044,0x32,0x300,0x33,0x2044,0x34,0x202,
+  0x41,0x300,0x202,0x41,0x301,0x202,0x41,0x302,
+  0x202,0x41,0x303,0x202,0x41,0x308,0x202,0x41,
+  0x30A,0x202,0x43,0x327,0x202,0x45,0x300,0x202,
+  0x45,0x301,0x202,0x45,0x302,0x202,0x45,0x308,
+  0x202,0x49,0x300,0x202,0x49,0x301,0x202,0x49,
+  0x302,0x202,0x49,0x308,0x202,0x4E,0x303,0x202,
+  0x4F,0x300,0x202,0x4F,0x301,0x202,0x4F,0x302,
+  0x202,0x4F,0x303,0x202,0x4F,0x308,0x202,0x55,
+  0x300,0x202,0x55,0x301,0x202,0x55,0x302,0x202,
+  0x55,0x308,0x202,0x59,0x301,0x202,0x61,0x300,
+  0x202,0x61,0x301,0x202,0x61,0x302,0x202,0x61,
+  0x303,0x202,0x61,0x308,0x202,0x61,0x30A,0x202,
+  0x63,0x327,0x202,0x65,0x300,0x202,0x65,0x301,
+  0x202,0x65,0x302,0x202,0x65,0x308,0x202,0x69,
+  0x300,0x202,0x69,0x301,0x202,0x69,0x302,0x202,
+  0x69,0x308,0x202,0x6E,0x303,0x202,0x6F,0x300,
+  0x202,0x6F,0x301,0x202,0x6F,0x302,0x202,0x6F,
+  0x303,0x202,0x6F,0x308,0x202,0x75,0x300,0x202,
+  0x75,0x301,0x202,0x75,0x302,0x202,0x75,0x308,
+  0x202,0x79,0x301,0x202,0x79,0x308,0x202,0x41,
+  0x304,0x202,0x61,0x304,0x202,0x41,0x306,0x202,
+  0x61,0x306,0x202,0x41,0x328,0x202,0x61,0x328,
+  0x202,0x43,0x301,0x202,0x63,0x301,0x202,0x43,
+  0x302,0x202,0x63,0x302,0x202,0x43,0x307,0x202,
+  0x63,0x307,0x202,0x43,0x30C,0x202,0x63,0x30C,
+  0x202,0x44,0x30C,0x202,0x64,0x30C,0x202,0x45,
+  0x304,0x202,0x65,0x304,0x202,0x45,0x306,0x202,
+  0x65,0x306,0x202,0x45,0x307,0x202,0x65,0x307,
+  0x202,0x45,0x328,0x202,0x65,0x328,0x202,0x45,
+  0x30C,0x202,0x65,0x30C,0x202,0x47,0x302,0x202,
+  0x67,0x302,0x202,0x47,0x306,0x202,0x67,0x306,
+  0x202,0x47,0x307,0x202,0x67,0x307,0x202,0x47,
+  0x327,0x202,0x67,0x327,0x202,0x48,0x302,0x202,
+  0x68,0x302,0x202,0x49,0x303,0x202,0x69,0x303,
+  0x202,0x49,0x304,0x202,0x69,0x304,0x202,0x49,
+  0x306,0x202,0x69,0x306,0x202,0x49,0x328,0x202,
+  0x69,0x328,0x202,0x49,0x307,0x200,0x49,0x4A,
+  0x200,0x69,0x6A,0x202,0x4A,0x302,0x202,0x6A,
+  0x302,0x202,0x4B,0x327,0x202,0x6B,0x327,0x202,
+  0x4C,0x301,0x202,0x6C,0x301,0x202,0x4C,0x327,
+  0x202,0x6C,0x327,0x202,0x4C,0x30C,0x202,0x6C,
+  0x30C,0x200,0x4C,0xB7,0x200,0x6C,0xB7,0x202,
+  0x4E,0x301,0x202,0x6E,0x301,0x202,0x4E,0x327,
+  0x202,0x6E,0x327,0x202,0x4E,0x30C,0x202,0x6E,
+  0x30C,0x200,0x2BC,0x6E,0x202,0x4F,0x304,0x202,
+  0x6F,0x304,0x202,0x4F,0x306,0x202,0x6F,0x306,
+  0x202,0x4F,0x30B,0x202,0x6F,0x30B,0x202,0x52,
+  0x301,0x202,0x72,0x301,0x202,0x52,0x327,0x202,
+  0x72,0x327,0x202,0x52,0x30C,0x202,0x72,0x30C,
+  0x202,0x53,0x301,0x202,0x73,0x301,0x202,0x53,
+  0x302,0x202,0x73,0x302,0x202,0x53,0x327,0x202,
+  0x73,0x327,0x202,0x53,0x30C,0x202,0x73,0x30C,
+  0x202,0x54,0x327,0x202,0x74,0x327,0x202,0x54,
+  0x30C,0x202,0x74,0x30C,0x202,0x55,0x303,0x202,
+  0x75,0x303,0x202,0x55,0x304,0x202,0x75,0x304,
+  0x202,0x55,0x306,0x202,0x75,0x306,0x202,0x55,
+  0x30A,0x202,0x75,0x30A,0x202,0x55,0x30B,0x202,
+  0x75,0x30B,0x202,0x55,0x328,0x202,0x75,0x328,
+  0x202,0x57,0x302,0x202,0x77,0x302,0x202,0x59,
+  0x302,0x202,0x79,0x302,0x202,0x59,0x308,0x202,
+  0x5A,0x301,0x202,0x7A,0x301,0x202,0x5A,0x307,
+  0x202,0x7A,0x307,0x202,0x5A,0x30C,0x202,0x7A,
+  0x30C,0x100,0x73,0x202,0x4F,0x31B,0x202,0x6F,
+  0x31B,0x202,0x55,0x31B,0x202,0x75,0x31B,0x300,
+  0x44,0x5A,0x30C,0x300,0x44,0x7A,0x30C,0x300,
+  0x64,0x7A,0x30C,0x200,0x4C,0x4A,0x200,0x4C,
+  0x6A,0x200,0x6C,0x6A,0x200,0x4E,0x4A,0x200,
+  0x4E,0x6A,0x200,0x6E,0x6A,0x202,0x41,0x30C,
+  0x202,0x61,0x30C,0x202,0x49,0x30C,0x202,0x69,
+  0x30C,0x202,0x4F,0x30C,0x202,0x6F,0x30C,0x202,
+  0x55,0x30C,0x202,0x75,0x30C,0x303,0x55,0x308,
+  0x304,0x303,0x75,0x308,0x304,0x303,0x55,0x308,
+  0x301,0x303,0x75,0x308,0x301,0x303,0x55,0x308,
+  0x30C,0x303,0x75,0x308,0x30C,0x303,0x55,0x308,
+  0x300,0x303,0x75,0x308,0x300,0x303,0x41,0x308,
+  0x304,0x303,0x61,0x308,0x304,0x303,0x41,0x307,
+  0x304,0x303,0x61,0x307,0x304,0x202,0xC6,0x304,
+  0x202,0xE6,0x304,0x202,0x47,0x30C,0x202,0x67,
+  0x30C,0x202,0x4B,0x30C,0x202,0x6B,0x30C,0x202,
+  0x4F,0x328,0x202,0x6F,0x328,0x303,0x4F,0x328,
+  0x304,0x303,0x6F,0x328,0x304,0x202,0x1B7,0x30C,
+  0x202,0x292,0x30C,0x202,0x6A,0x30C,0x200,0x44,
+  0x5A,0x200,0x44,0x7A,0x200,0x64,0x7A,0x202,
+  0x47,0x301,0x202,0x67,0x301,0x202,0x4E,0x300,
+  0x202,0x6E,0x300,0x303,0x41,0x30A,0x301,0x303,
+  0x61,0x30A,0x301,0x202,0xC6,0x301,0x202,0xE6,
+  0x301,0x202,0xD8,0x301,0x202,0xF8,0x301,0x202,
+  0x41,0x30F,0x202,0x61,0x30F,0x202,0x41,0x311,
+  0x202,0x61,0x311,0x202,0x45,0x30F,0x202,0x65,
+  0x30F,0x202,0x45,0x311,0x202,0x65,0x311,0x202,
+  0x49,0x30F,0x202,0x69,0x30F,0x202,0x49,0x311,
+  0x202,0x69,0x311,0x202,0x4F,0x30F,0x202,0x6F,
+  0x30F,0x202,0x4F,0x311,0x202,0x6F,0x311,0x202,
+  0x52,0x30F,0x202,0x72,0x30F,0x202,0x52,0x311,
+  0x202,0x72,0x311,0x202,0x55,0x30F,0x202,0x75,
+  0x30F,0x202,0x55,0x311,0x202,0x75,0x311,0x202,
+  0x53,0x326,0x202,0x73,0x326,0x202,0x54,0x326,
+  0x202,0x74,0x326,0x202,0x48,0x30C,0x202,0x68,
+  0x30C,0x202,0x41,0x307,0x202,0x61,0x307,0x202,
+  0x45,0x327,0x202,0x65,0x327,0x303,0x4F,0x308,
+  0x304,0x303,0x6F,0x308,0x304,0x303,0x4F,0x303,
+  0x304,0x303,0x6F,0x303,0x304,0x202,0x4F,0x307,
+  0x202,0x6F,0x307,0x303,0x4F,0x307,0x304,0x303,
+  0x6F,0x307,0x304,0x202,0x59,0x304,0x202,0x79,
+  0x304,0x100,0x68,0x100,0x266,0x100,0x6A,0x100,
+  0x72,0x100,0x279,0x100,0x27B,0x100,0x281,0x100,
+  0x77,0x100,0x79,0x200,0x20,0x306,0x200,0x20,
+  0x307,0x200,0x20,0x30A,0x200,0x20,0x328,0x200,
+  0x20,0x303,0x200,0x20,0x30B,0x100,0x263,0x100,
+  0x6C,0x100,0x73,0x100,0x78,0x100,0x295,0x101,
+  0x300,0x101,0x301,0x101,0x313,0x202,0x308,0x301,
+  0x101,0x2B9,0x200,0x20,0x345,0x101,0x3B,0x200,
+  0x20,0x301,0x20302,0xA8,0x301,0x20,0x308,0x301,
+  0x202,0x391,0x301,0x101,0xB7,0x202,0x395,0x301,
+  0x202,0x397,0x301,0x202,0x399,0x301,0x202,0x39F,
+  0x301,0x202,0x3A5,0x301,0x202,0x3A9,0x301,0x303,
+  0x3B9,0x308,0x301,0x202,0x399,0x308,0x202,0x3A5,
+  0x308,0x202,0x3B1,0x301,0x202,0x3B5,0x301,0x202,
+  0x3B7,0x301,0x202,0x3B9,0x301,0x303,0x3C5,0x308,
+  0x301,0x202,0x3B9,0x308,0x202,0x3C5,0x308,0x202,
+  0x3BF,0x301,0x202,0x3C5,0x301,0x202,0x3C9,0x301,
+  0x100,0x3B2,0x100,0x3B8,0x100,0x3A5,0x20202,0x3D2,
+  0x301,0x3A5,0x301,0x20202,0x3D2,0x308,0x3A5,0x308,
+  0x100,0x3C6,0x100,0x3C0,0x100,0x3BA,0x100,0x3C1,
+  0x100,0x3C2,0x100,0x398,0x100,0x3B5,0x100,0x3A3,
+  0x202,0x415,0x300,0x202,0x415,0x308,0x202,0x413,
+  0x301,0x202,0x406,0x308,0x202,0x41A,0x301,0x202,
+  0x418,0x300,0x202,0x423,0x306,0x202,0x418,0x306,
+  0x202,0x438,0x306,0x202,0x435,0x300,0x202,0x435,
+  0x308,0x202,0x433,0x301,0x202,0x456,0x308,0x202,
+  0x43A,0x301,0x202,0x438,0x300,0x202,0x443,0x306,
+  0x202,0x474,0x30F,0x202,0x475,0x30F,0x202,0x416,
+  0x306,0x202,0x436,0x306,0x202,0x410,0x306,0x202,
+  0x430,0x306,0x202,0x410,0x308,0x202,0x430,0x308,
+  0x202,0x415,0x306,0x202,0x435,0x306,0x202,0x4D8,
+  0x308,0x202,0x4D9,0x308,0x202,0x416,0x308,0x202,
+  0x436,0x308,0x202,0x417,0x308,0x202,0x437,0x308,
+  0x202,0x418,0x304,0x202,0x438,0x304,0x202,0x418,
+  0x308,0x202,0x438,0x308,0x202,0x41E,0x308,0x202,
+  0x43E,0x308,0x202,0x4E8,0x308,0x202,0x4E9,0x308,
+  0x202,0x42D,0x308,0x202,0x44D,0x308,0x202,0x423,
+  0x304,0x202,0x443,0x304,0x202,0x423,0x308,0x202,
+  0x443,0x308,0x202,0x423,0x30B,0x202,0x443,0x30B,
+  0x202,0x427,0x308,0x202,0x447,0x308,0x202,0x42B,
+  0x308,0x202,0x44B,0x308,0x200,0x565,0x582,0x202,
+  0x627,0x653,0x202,0x627,0x654,0x202,0x648,0x654,
+  0x202,0x627,0x655,0x202,0x64A,0x654,0x200,0x627,
+  0x674,0x200,0x648,0x674,0x200,0x6C7,0x674,0x200,
+  0x64A,0x674,0x202,0x6D5,0x654,0x202,0x6C1,0x654,
+  0x202,0x6D2,0x654,0x202,0x928,0x93C,0x202,0x930,
+  0x93C,0x202,0x933,0x93C,0x202,0x915,0x93C,0x202,
+  0x916,0x93C,0x202,0x917,0x93C,0x202,0x91C,0x93C,
+  0x202,0x921,0x93C,0x202,0x922,0x93C,0x202,0x92B,
+  0x93C,0x202,0x92F,0x93C,0x202,0x9C7,0x9BE,0x202,
+  0x9C7,0x9D7,0x202,0x9A1,0x9BC,0x202,0x9A2,0x9BC,
+  0x202,0x9AF,0x9BC,0x202,0xA32,0xA3C,0x202,0xA38,
+  0xA3C,0x202,0xA16,0xA3C,0x202,0xA17,0xA3C,0x202,
+  0xA1C,0xA3C,0x202,0xA2B,0xA3C,0x202,0xB47,0xB56,
+  0x202,0xB47,0xB3E,0x202,0xB47,0xB57,0x202,0xB21,
+  0xB3C,0x202,0xB22,0xB3C,0x202,0xB92,0xBD7,0x202,
+  0xBC6,0xBBE,0x202,0xBC7,0xBBE,0x202,0xBC6,0xBD7,
+  0x202,0xC46,0xC56,0x202,0xCBF,0xCD5,0x202,0xCC6,
+  0xCD5,0x202,0xCC6,0xCD6,0x202,0xCC6,0xCC2,0x303,
+  0xCC6,0xCC2,0xCD5,0x202,0xD46,0xD3E,0x202,0xD47,
+  0xD3E,0x202,0xD46,0xD57,0x202,0xDD9,0xDCA,0x202,
+  0xDD9,0xDCF,0x303,0xDD9,0xDCF,0xDCA,0x202,0xDD9,
+  0xDDF,0x200,0xE4D,0xE32,0x200,0xECD,0xEB2,0x200,
+  0xEAB,0xE99,0x200,0xEAB,0xEA1,0x100,0xF0B,0x202,
+  0xF42,0xFB7,0x202,0xF4C,0xFB7,0x202,0xF51,0xFB7,
+  0x202,0xF56,0xFB7,0x202,0xF5B,0xFB7,0x202,0xF40,
+  0xFB5,0x202,0xF71,0xF72,0x202,0xF71,0xF74,0x202,
+  0xFB2,0xF80,0x300,0xFB2,0xF71,0xF80,0x202,0xFB3,
+  0xF80,0x300,0xFB3,0xF71,0xF80,0x202,0xF71,0xF80,
+  0x202,0xF92,0xFB7,0x202,0xF9C,0xFB7,0x202,0xFA1,
+  0xFB7,0x202,0xFA6,0xFB7,0x202,0xFAB,0xFB7,0x202,
+  0xF90,0xFB5,0x202,0x1025,0x102E,0x100,0x10DC,0x202,
+  0x1B05,0x1B35,0x202,0x1B07,0x1B35,0x202,0x1B09,0x1B35,
+  0x202,0x1B0B,0x1B35,0x202,0x1B0D,0x1B35,0x202,0x1B11,
+  0x1B35,0x202,0x1B3A,0x1B35,0x202,0x1B3C,0x1B35,0x202,
+  0x1B3E,0x1B35,0x202,0x1B3F,0x1B35,0x202,0x1B42,0x1B35,
+  0x100,0x41,0x100,0xC6,0x100,0x42,0x100,0x44,
+  0x100,0x45,0x100,0x18E,0x100,0x47,0x100,0x48,
+  0x100,0x49,0x100,0x4A,0x100,0x4B,0x100,0x4C,
+  0x100,0x4D,0x100,0x4E,0x100,0x4F,0x100,0x222,
+  0x100,0x50,0x100,0x52,0x100,0x54,0x100,0x55,
+  0x100,0x57,0x100,0x61,0x100,0x250,0x100,0x251,
+  0x100,0x1D02,0x100,0x62,0x100,0x64,0x100,0x65,
+  0x100,0x259,0x100,0x25B,0x100,0x25C,0x100,0x67,
+  0x100,0x6B,0x100,0x6D,0x100,0x14B,0x100,0x6F,
+  0x100,0x254,0x100,0x1D16,0x100,0x1D17,0x100,0x70,
+  0x100,0x74,0x100,0x75,0x100,0x1D1D,0x100,0x26F,
+  0x100,0x76,0x100,0x1D25,0x100,0x3B2,0x100,0x3B3,
+  0x100,0x3B4,0x100,0x3C6,0x100,0x3C7,0x100,0x69,
+  0x100,0x72,0x100,0x75,0x100,0x76,0x100,0x3B2,
+  0x100,0x3B3,0x100,0x3C1,0x100,0x3C6,0x100,0x3C7,
+  0x100,0x43D,0x100,0x252,0x100,0x63,0x100,0x255,
+  0x100,0xF0,0x100,0x25C,0x100,0x66,0x100,0x25F,
+  0x100,0x261,0x100,0x265,0x100,0x268,0x100,0x269,
+  0x100,0x26A,0x100,0x1D7B,0x100,0x29D,0x100,0x26D,
+  0x100,0x1D85,0x100,0x29F,0x100,0x271,0x100,0x270,
+  0x100,0x272,0x100,0x273,0x100,0x274,0x100,0x275,
+  0x100,0x278,0x100,0x282,0x100,0x283,0x100,0x1AB,
+  0x100,0x289,0x100,0x28A,0x100,0x1D1C,0x100,0x28B,
+  0x100,0x28C,0x100,0x7A,0x100,0x290,0x100,0x291,
+  0x100,0x292,0x100,0x3B8,0x202,0x41,0x325,0x202,
+  0x61,0x325,0x202,0x42,0x307,0x202,0x62,0x307,
+  0x202,0x42,0x323,0x202,0x62,0x323,0x202,0x42,
+  0x331,0x202,0x62,0x331,0x303,0x43,0x327,0x301,
+  0x303,0x63,0x327,0x301,0x202,0x44,0x307,0x202,
+  0x64,0x307,0x202,0x44,0x323,0x202,0x64,0x323,
+  0x202,0x44,0x331,0x202,0x64,0x331,0x202,0x44,
+  0x327,0x202,0x64,0x327,0x202,0x44,0x32D,0x202,
+  0x64,0x32D,0x303,0x45,0x304,0x300,0x303,0x65,
+  0x304,0x300,0x303,0x45,0x304,0x301,0x303,0x65,
+  0x304,0x301,0x202,0x45,0x32D,0x202,0x65,0x32D,
+  0x202,0x45,0x330,0x202,0x65,0x330,0x303,0x45,
+  0x327,0x306,0x303,0x65,0x327,0x306,0x202,0x46,
+  0x307,0x202,0x66,0x307,0x202,0x47,0x304,0x202,
+  0x67,0x304,0x202,0x48,0x307,0x202,0x68,0x307,
+  0x202,0x48,0x323,0x202,0x68,0x323,0x202,0x48,
+  0x308,0x202,0x68,0x308,0x202,0x48,0x327,0x202,
+  0x68,0x327,0x202,0x48,0x32E,0x202,0x68,0x32E,
+  0x202,0x49,0x330,0x202,0x69,0x330,0x303,0x49,
+  0x308,0x301,0x303,0x69,0x308,0x301,0x202,0x4B,
+  0x301,0x202,0x6B,0x301,0x202,0x4B,0x323,0x202,
+  0x6B,0x323,0x202,0x4B,0x331,0x202,0x6B,0x331,
+  0x202,0x4C,0x323,0x202,0x6C,0x323,0x303,0x4C,
+  0x323,0x304,0x303,0x6C,0x323,0x304,0x202,0x4C,
+  0x331,0x202,0x6C,0x331,0x202,0x4C,0x32D,0x202,
+  0x6C,0x32D,0x202,0x4D,0x301,0x202,0x6D,0x301,
+  0x202,0x4D,0x307,0x202,0x6D,0x307,0x202,0x4D,
+  0x323,0x202,0x6D,0x323,0x202,0x4E,0x307,0x202,
+  0x6E,0x307,0x202,0x4E,0x323,0x202,0x6E,0x323,
+  0x202,0x4E,0x331,0x202,0x6E,0x331,0x202,0x4E,
+  0x32D,0x202,0x6E,0x32D,0x303,0x4F,0x303,0x301,
+  0x303,0x6F,0x303,0x301,0x303,0x4F,0x303,0x308,
+  0x303,0x6F,0x303,0x308,0x303,0x4F,0x304,0x300,
+  0x303,0x6F,0x304,0x300,0x303,0x4F,0x304,0x301,
+  0x303,0x6F,0x304,0x301,0x202,0x50,0x301,0x202,
+  0x70,0x301,0x202,0x50,0x307,0x202,0x70,0x307,
+  0x202,0x52,0x307,0x202,0x72,0x307,0x202,0x52,
+  0x323,0x202,0x72,0x323,0x303,0x52,0x323,0x304,
+  0x303,0x72,0x323,0x304,0x202,0x52,0x331,0x202,
+  0x72,0x331,0x202,0x53,0x307,0x202,0x73,0x307,
+  0x202,0x53,0x323,0x202,0x73,0x323,0x303,0x53,
+  0x301,0x307,0x303,0x73,0x301,0x307,0x303,0x53,
+  0x30C,0x307,0x303,0x73,0x30C,0x307,0x303,0x53,
+  0x323,0x307,0x303,0x73,0x323,0x307,0x202,0x54,
+  0x307,0x202,0x74,0x307,0x202,0x54,0x323,0x202,
+  0x74,0x323,0x202,0x54,0x331,0x202,0x74,0x331,
+  0x202,0x54,0x32D,0x202,0x74,0x32D,0x202,0x55,
+  0x324,0x202,0x75,0x324,0x202,0x55,0x330,0x202,
+  0x75,0x330,0x202,0x55,0x32D,0x202,0x75,0x32D,
+  0x303,0x55,0x303,0x301,0x303,0x75,0x303,0x301,
+  0x303,0x55,0x304,0x308,0x303,0x75,0x304,0x308,
+  0x202,0x56,0x303,0x202,0x76,0x303,0x202,0x56,
+  0x323,0x202,0x76,0x323,0x202,0x57,0x300,0x202,
+  0x77,0x300,0x202,0x57,0x301,0x202,0x77,0x301,
+  0x202,0x57,0x308,0x202,0x77,0x308,0x202,0x57,
+  0x307,0x202,0x77,0x307,0x202,0x57,0x323,0x202,
+  0x77,0x323,0x202,0x58,0x307,0x202,0x78,0x307,
+  0x202,0x58,0x308,0x202,0x78,0x308,0x202,0x59,
+  0x307,0x202,0x79,0x307,0x202,0x5A,0x302,0x202,
+  0x7A,0x302,0x202,0x5A,0x323,0x202,0x7A,0x323,
+  0x202,0x5A,0x331,0x202,0x7A,0x331,0x202,0x68,
+  0x331,0x202,0x74,0x308,0x202,0x77,0x30A,0x202,
+  0x79,0x30A,0x200,0x61,0x2BE,0x20202,0x17F,0x307,
+  0x73,0x307,0x202,0x41,0x323,0x202,0x61,0x323,
+  0x202,0x41,0x309,0x202,0x61,0x309,0x303,0x41,
+  0x302,0x301,0x303,0x61,0x302,0x301,0x303,0x41,
+  0x302,0x300,0x303,0x61,0x302,0x300,0x303,0x41,
+  0x302,0x309,0x303,0x61,0x302,0x309,0x303,0x41,
+  0x302,0x303,0x303,0x61,0x302,0x303,0x303,0x41,
+  0x323,0x302,0x303,0x61,0x323,0x302,0x303,0x41,
+  0x306,0x301,0x303,0x61,0x306,0x301,0x303,0x41,
+  0x306,0x300,0x303,0x61,0x306,0x300,0x303,0x41,
+  0x306,0x309,0x303,0x61,0x306,0x309,0x303,0x41,
+  0x306,0x303,0x303,0x61,0x306,0x303,0x303,0x41,
+  0x323,0x306,0x303,0x61,0x323,0x306,0x202,0x45,
+  0x323,0x202,0x65,0x323,0x202,0x45,0x309,0x202,
+  0x65,0x309,0x202,0x45,0x303,0x202,0x65,0x303,
+  0x303,0x45,0x302,0x301,0x303,0x65,0x302,0x301,
+  0x303,0x45,0x302,0x300,0x303,0x65,0x302,0x300,
+  0x303,0x45,0x302,0x309,0x303,0x65,0x302,0x309,
+  0x303,0x45,0x302,0x303,0x303,0x65,0x302,0x303,
+  0x303,0x45,0x323,0x302,0x303,0x65,0x323,0x302,
+  0x202,0x49,0x309,0x202,0x69,0x309,0x202,0x49,
+  0x323,0x202,0x69,0x323,0x202,0x4F,0x323,0x202,
+  0x6F,0x323,0x202,0x4F,0x309,0x202,0x6F,0x309,
+  0x303,0x4F,0x302,0x301,0x303,0x6F,0x302,0x301,
+  0x303,0x4F,0x302,0x300,0x303,0x6F,0x302,0x300,
+  0x303,0x4F,0x302,0x309,0x303,0x6F,0x302,0x309,
+  0x303,0x4F,0x302,0x303,0x303,0x6F,0x302,0x303,
+  0x303,0x4F,0x323,0x302,0x303,0x6F,0x323,0x302,
+  0x303,0x4F,0x31B,0x301,0x303,0x6F,0x31B,0x301,
+  0x303,0x4F,0x31B,0x300,0x303,0x6F,0x31B,0x300,
+  0x303,0x4F,0x31B,0x309,0x303,0x6F,0x31B,0x309,
+  0x303,0x4F,0x31B,0x303,0x303,0x6F,0x31B,0x303,
+  0x303,0x4F,0x31B,0x323,0x303,0x6F,0x31B,0x323,
+  0x202,0x55,0x323,0x202,0x75,0x323,0x202,0x55,
+  0x309,0x202,0x75,0x309,0x303,0x55,0x31B,0x301,
+  0x303,0x75,0x31B,0x301,0x303,0x55,0x31B,0x300,
+  0x303,0x75,0x31B,0x300,0x303,0x55,0x31B,0x309,
+  0x303,0x75,0x31B,0x309,0x303,0x55,0x31B,0x303,
+  0x303,0x75,0x31B,0x303,0x303,0x55,0x31B,0x323,
+  0x303,0x75,0x31B,0x323,0x202,0x59,0x300,0x202,
+  0x79,0x300,0x202,0x59,0x323,0x202,0x79,0x323,
+  0x202,0x59,0x309,0x202,0x79,0x309,0x202,0x59,
+  0x303,0x202,0x79,0x303,0x202,0x3B1,0x313,0x202,
+  0x3B1,0x314,0x303,0x3B1,0x313,0x300,0x303,0x3B1,
+  0x314,0x300,0x303,0x3B1,0x313,0x301,0x303,0x3B1,
+  0x314,0x301,0x303,0x3B1,0x313,0x342,0x303,0x3B1,
+  0x314,0x342,0x202,0x391,0x313,0x202,0x391,0x314,
+  0x303,0x391,0x313,0x300,0x303,0x391,0x314,0x300,
+  0x303,0x391,0x313,0x301,0x303,0x391,0x314,0x301,
+  0x303,0x391,0x313,0x342,0x303,0x391,0x314,0x342,
+  0x202,0x3B5,0x313,0x202,0x3B5,0x314,0x303,0x3B5,
+  0x313,0x300,0x303,0x3B5,0x314,0x300,0x303,0x3B5,
+  0x313,0x301,0x303,0x3B5,0x314,0x301,0x202,0x395,
+  0x313,0x202,0x395,0x314,0x303,0x395,0x313,0x300,
+  0x303,0x395,0x314,0x300,0x303,0x395,0x313,0x301,
+  0x303,0x395,0x314,0x301,0x202,0x3B7,0x313,0x202,
+  0x3B7,0x314,0x303,0x3B7,0x313,0x300,0x303,0x3B7,
+  0x314,0x300,0x303,0x3B7,0x313,0x301,0x303,0x3B7,
+  0x314,0x301,0x303,0x3B7,0x313,0x342,0x303,0x3B7,
+  0x314,0x342,0x202,0x397,0x313,0x202,0x397,0x314,
+  0x303,0x397,0x313,0x300,0x303,0x397,0x314,0x300,
+  0x303,0x397,0x313,0x301,0x303,0x397,0x314,0x301,
+  0x303,0x397,0x313,0x342,0x303,0x397,0x314,0x342,
+  0x202,0x3B9,0x313,0x202,0x3B9,0x314,0x303,0x3B9,
+  0x313,0x300,0x303,0x3B9,0x314,0x300,0x303,0x3B9,
+  0x313,0x301,0x303,0x3B9,0x314,0x301,0x303,0x3B9,
+  0x313,0x342,0x303,0x3B9,0x314,0x342,0x202,0x399,
+  0x313,0x202,0x399,0x314,0x303,0x399,0x313,0x300,
+  0x303,0x399,0x314,0x300,0x303,0x399,0x313,0x301,
+  0x303,0x399,0x314,0x301,0x303,0x399,0x313,0x342,
+  0x303,0x399,0x314,0x342,0x202,0x3BF,0x313,0x202,
+  0x3BF,0x314,0x303,0x3BF,0x313,0x300,0x303,0x3BF,
+  0x314,0x300,0x303,0x3BF,0x313,0x301,0x303,0x3BF,
+  0x314,0x301,0x202,0x39F,0x313,0x202,0x39F,0x314,
+  0x303,0x39F,0x313,0x300,0x303,0x39F,0x314,0x300,
+  0x303,0x39F,0x313,0x301,0x303,0x39F,0x314,0x301,
+  0x202,0x3C5,0x313,0x202,0x3C5,0x314,0x303,0x3C5,
+  0x313,0x300,0x303,0x3C5,0x314,0x300,0x303,0x3C5,
+  0x313,0x301,0x303,0x3C5,0x314,0x301,0x303,0x3C5,
+  0x313,0x342,0x303,0x3C5,0x314,0x342,0x202,0x3A5,
+  0x314,0x303,0x3A5,0x314,0x300,0x303,0x3A5,0x314,
+  0x301,0x303,0x3A5,0x314,0x342,0x202,0x3C9,0x313,
+  0x202,0x3C9,0x314,0x303,0x3C9,0x313,0x300,0x303,
+  0x3C9,0x314,0x300,0x303,0x3C9,0x313,0x301,0x303,
+  0x3C9,0x314,0x301,0x303,0x3C9,0x313,0x342,0x303,
+  0x3C9,0x314,0x342,0x202,0x3A9,0x313,0x202,0x3A9,
+  0x314,0x303,0x3A9,0x313,0x300,0x303,0x3A9,0x314,
+  0x300,0x303,0x3A9,0x313,0x301,0x303,0x3A9,0x314,
+  0x301,0x303,0x3A9,0x313,0x342,0x303,0x3A9,0x314,
+  0x342,0x202,0x3B1,0x300,0x202,0x3B1,0x301,0x202,
+  0x3B5,0x300,0x202,0x3B5,0x301,0x202,0x3B7,0x300,
+  0x202,0x3B7,0x301,0x202,0x3B9,0x300,0x202,0x3B9,
+  0x301,0x202,0x3BF,0x300,0x202,0x3BF,0x301,0x202,
+  0x3C5,0x300,0x202,0x3C5,0x301,0x202,0x3C9,0x300,
+  0x202,0x3C9,0x301,0x303,0x3B1,0x313,0x345,0x303,
+  0x3B1,0x314,0x345,0x404,0x3B1,0x313,0x300,0x345,
+  0x404,0x3B1,0x314,0x300,0x345,0x404,0x3B1,0x313,
+  0x301,0x345,0x404,0x3B1,0x314,0x301,0x345,0x404,
+  0x3B1,0x313,0x342,0x345,0x404,0x3B1,0x314,0x342,
+  0x345,0x303,0x391,0x313,0x345,0x303,0x391,0x314,
+  0x345,0x404,0x391,0x313,0x300,0x345,0x404,0x391,
+  0x314,0x300,0x345,0x404,0x391,0x313,0x301,0x345,
+  0x404,0x391,0x314,0x301,0x345,0x404,0x391,0x313,
+  0x342,0x345,0x404,0x391,0x314,0x342,0x345,0x303,
+  0x3B7,0x313,0x345,0x303,0x3B7,0x314,0x345,0x404,
+  0x3B7,0x313,0x300,0x345,0x404,0x3B7,0x314,0x300,
+  0x345,0x404,0x3B7,0x313,0x301,0x345,0x404,0x3B7,
+  0x314,0x301,0x345,0x404,0x3B7,0x313,0x342,0x345,
+  0x404,0x3B7,0x314,0x342,0x345,0x303,0x397,0x313,
+  0x345,0x303,0x397,0x314,0x345,0x404,0x397,0x313,
+  0x300,0x345,0x404,0x397,0x314,0x300,0x345,0x404,
+  0x397,0x313,0x301,0x345,0x404,0x397,0x314,0x301,
+  0x345,0x404,0x397,0x313,0x342,0x345,0x404,0x397,
+  0x314,0x342,0x345,0x303,0x3C9,0x313,0x345,0x303,
+  0x3C9,0x314,0x345,0x404,0x3C9,0x313,0x300,0x345,
+  0x404,0x3C9,0x314,0x300,0x345,0x404,0x3C9,0x313,
+  0x301,0x345,0x404,0x3C9,0x314,0x301,0x345,0x404,
+  0x3C9,0x313,0x342,0x345,0x404,0x3C9,0x314,0x342,
+  0x345,0x303,0x3A9,0x313,0x345,0x303,0x3A9,0x314,
+  0x345,0x404,0x3A9,0x313,0x300,0x345,0x404,0x3A9,
+  0x314,0x300,0x345,0x404,0x3A9,0x313,0x301,0x345,
+  0x404,0x3A9,0x314,0x301,0x345,0x404,0x3A9,0x313,
+  0x342,0x345,0x404,0x3A9,0x314,0x342,0x345,0x202,
+  0x3B1,0x306,0x202,0x3B1,0x304,0x303,0x3B1,0x300,
+  0x345,0x202,0x3B1,0x345,0x303,0x3B1,0x301,0x345,
+  0x202,0x3B1,0x342,0x303,0x3B1,0x342,0x345,0x202,
+  0x391,0x306,0x202,0x391,0x304,0x202,0x391,0x300,
+  0x202,0x391,0x301,0x202,0x391,0x345,0x200,0x20,
+  0x313,0x101,0x3B9,0x200,0x20,0x313,0x200,0x20,
+  0x342,0x20302,0xA8,0x342,0x20,0x308,0x342,0x303,
+  0x3B7,0x300,0x345,0x202,0x3B7,0x345,0x303,0x3B7,
+  0x301,0x345,0x202,0x3B7,0x342,0x303,0x3B7,0x342,
+  0x345,0x202,0x395,0x300,0x202,0x395,0x301,0x202,
+  0x397,0x300,0x202,0x397,0x301,0x202,0x397,0x345,
+  0x20302,0x1FBF,0x300,0x20,0x313,0x300,0x20302,0x1FBF,
+  0x301,0x20,0x313,0x301,0x20302,0x1FBF,0x342,0x20,
+  0x313,0x342,0x202,0x3B9,0x306,0x202,0x3B9,0x304,
+  0x303,0x3B9,0x308,0x300,0x303,0x3B9,0x308,0x301,
+  0x202,0x3B9,0x342,0x303,0x3B9,0x308,0x342,0x202,
+  0x399,0x306,0x202,0x399,0x304,0x202,0x399,0x300,
+  0x202,0x399,0x301,0x20302,0x1FFE,0x300,0x20,0x314,
+  0x300,0x20302,0x1FFE,0x301,0x20,0x314,0x301,0x20302,
+  0x1FFE,0x342,0x20,0x314,0x342,0x202,0x3C5,0x306,
+  0x202,0x3C5,0x304,0x303,0x3C5,0x308,0x300,0x303,
+  0x3C5,0x308,0x301,0x202,0x3C1,0x313,0x202,0x3C1,
+  0x314,0x202,0x3C5,0x342,0x303,0x3C5,0x308,0x342,
+  0x202,0x3A5,0x306,0x202,0x3A5,0x304,0x202,0x3A5,
+  0x300,0x202,0x3A5,0x301,0x202,0x3A1,0x314,0x20302,
+  0xA8,0x300,0x20,0x308,0x300,0x20302,0xA8,0x301,
+  0x20,0x308,0x301,0x101,0x60,0x303,0x3C9,0x300,
+  0x345,0x202,0x3C9,0x345,0x303,0x3C9,0x301,0x345,
+  0x202,0x3C9,0x342,0x303,0x3C9,0x342,0x345,0x202,
+  0x39F,0x300,0x202,0x39F,0x301,0x202,0x3A9,0x300,
+  0x202,0x3A9,0x301,0x202,0x3A9,0x345,0x10201,0xB4,
+  0x20,0x301,0x200,0x20,0x314,0x10101,0x2002,0x20,
+  0x10101,0x2003,0x20,0x100,0x20,0x100,0x20,0x100,
+  0x20,0x100,0x20,0x100,0x20,0x100,0x20,0x100,
+  0x20,0x100,0x20,0x100,0x20,0x100,0x2010,0x200,
+  0x20,0x333,0x100,0x2E,0x200,0x2E,0x2E,0x300,
+  0x2E,0x2E,0x2E,0x100,0x20,0x200,0x2032,0x2032,
+  0x300,0x2032,0x2032,0x2032,0x200,0x2035,0x2035,0x300,
+  0x2035,0x2035,0x2035,0x200,0x21,0x21,0x200,0x20,
+  0x305,0x200,0x3F,0x3F,0x200,0x3F,0x21,0x200,
+  0x21,0x3F,0x400,0x2032,0x2032,0x2032,0x2032,0x100,
+  0x20,0x100,0x30,0x100,0x69,0x100,0x34,0x100,
+  0x35,0x100,0x36,0x100,0x37,0x100,0x38,0x100,
+  0x39,0x100,0x2B,0x100,0x2212,0x100,0x3D,0x100,
+  0x28,0x100,0x29,0x100,0x6E,0x100,0x30,0x100,
+  0x31,0x100,0x32,0x100,0x33,0x100,0x34,0x100,
+  0x35,0x100,0x36,0x100,0x37,0x100,0x38,0x100,
+  0x39,0x100,0x2B,0x100,0x2212,0x100,0x3D,0x100,
+  0x28,0x100,0x29,0x100,0x61,0x100,0x65,0x100,
+  0x6F,0x100,0x78,0x100,0x259,0x100,0x68,0x100,
+  0x6B,0x100,0x6C,0x100,0x6D,0x100,0x6E,0x100,
+  0x70,0x100,0x73,0x100,0x74,0x200,0x52,0x73,
+  0x300,0x61,0x2F,0x63,0x300,0x61,0x2F,0x73,
+  0x100,0x43,0x200,0xB0,0x43,0x300,0x63,0x2F,
+  0x6F,0x300,0x63,0x2F,0x75,0x100,0x190,0x200,
+  0xB0,0x46,0x100,0x67,0x100,0x48,0x100,0x48,
+  0x100,0x48,0x100,0x68,0x100,0x127,0x100,0x49,
+  0x100,0x49,0x100,0x4C,0x100,0x6C,0x100,0x4E,
+  0x200,0x4E,0x6F,0x100,0x50,0x100,0x51,0x100,
+  0x52,0x100,0x52,0x100,0x52,0x200,0x53,0x4D,
+  0x300,0x54,0x45,0x4C,0x200,0x54,0x4D,0x100,
+  0x5A,0x101,0x3A9,0x100,0x5A,0x101,0x4B,0x202,
+  0x41,0x30A,0x100,0x42,0x100,0x43,0x100,0x65,
+  0x100,0x45,0x100,0x46,0x100,0x4D,0x100,0x6F,
+  0x100,0x5D0,0x100,0x5D1,0x100,0x5D2,0x100,0x5D3,
+  0x100,0x69,0x300,0x46,0x41,0x58,0x100,0x3C0,
+  0x100,0x3B3,0x100,0x393,0x100,0x3A0,0x100,0x2211,
+  0x100,0x44,0x100,0x64,0x100,0x65,0x100,0x69,
+  0x100,0x6A,0x300,0x31,0x2044,0x37,0x300,0x31,
+  0x2044,0x39,0x400,0x31,0x2044,0x31,0x30,0x300,
+  0x31,0x2044,0x33,0x300,0x32,0x2044,0x33,0x300,
+  0x31,0x2044,0x35,0x300,0x32,0x2044,0x35,0x300,
+  0x33,0x2044,0x35,0x300,0x34,0x2044,0x35,0x300,
+  0x31,0x2044,0x36,0x300,0x35,0x2044,0x36,0x300,
+  0x31,0x2044,0x38,0x300,0x33,0x2044,0x38,0x300,
+  0x35,0x2044,0x38,0x300,0x37,0x2044,0x38,0x200,
+  0x31,0x2044,0x100,0x49,0x200,0x49,0x49,0x300,
+  0x49,0x49,0x49,0x200,0x49,0x56,0x100,0x56,
+  0x200,0x56,0x49,0x300,0x56,0x49,0x49,0x400,
+  0x56,0x49,0x49,0x49,0x200,0x49,0x58,0x100,
+  0x58,0x200,0x58,0x49,0x300,0x58,0x49,0x49,
+  0x100,0x4C,0x100,0x43,0x100,0x44,0x100,0x4D,
+  0x100,0x69,0x200,0x69,0x69,0x300,0x69,0x69,
+  0x69,0x200,0x69,0x76,0x100,0x76,0x200,0x76,
+  0x69,0x300,0x76,0x69,0x69,0x400,0x76,0x69,
+  0x69,0x69,0x200,0x69,0x78,0x100,0x78,0x200,
+  0x78,0x69,0x300,0x78,0x69,0x69,0x100,0x6C,
+  0x100,0x63,0x100,0x64,0x100,0x6D,0x300,0x30,
+  0x2044,0x33,0x202,0x2190,0x338,0x202,0x2192,0x338,
+  0x202,0x2194,0x338,0x202,0x21D0,0x338,0x202,0x21D4,
+  0x338,0x202,0x21D2,0x338,0x202,0x2203,0x338,0x202,
+  0x2208,0x338,0x202,0x220B,0x338,0x202,0x2223,0x338,
+  0x202,0x2225,0x338,0x200,0x222B,0x222B,0x300,0x222B,
+  0x222B,0x222B,0x200,0x222E,0x222E,0x300,0x222E,0x222E,
+  0x222E,0x202,0x223C,0x338,0x202,0x2243,0x338,0x202,
+  0x2245,0x338,0x202,0x2248,0x338,0x202,0x3D,0x338,
+  0x202,0x2261,0x338,0x202,0x224D,0x338,0x202,0x3C,
+  0x338,0x202,0x3E,0x338,0x202,0x2264,0x338,0x202,
+  0x2265,0x338,0x202,0x2272,0x338,0x202,0x2273,0x338,
+  0x202,0x2276,0x338,0x202,0x2277,0x338,0x202,0x227A,
+  0x338,0x202,0x227B,0x338,0x202,0x2282,0x338,0x202,
+  0x2283,0x338,0x202,0x2286,0x338,0x202,0x2287,0x338,
+  0x202,0x22A2,0x338,0x202,0x22A8,0x338,0x202,0x22A9,
+  0x338,0x202,0x22AB,0x338,0x202,0x227C,0x338,0x202,
+  0x227D,0x338,0x202,0x2291,0x338,0x202,0x2292,0x338,
+  0x202,0x22B2,0x338,0x202,0x22B3,0x338,0x202,0x22B4,
+  0x338,0x202,0x22B5,0x338,0x101,0x3008,0x101,0x3009,
+  0x100,0x31,0x100,0x32,0x100,0x33,0x100,0x34,
+  0x100,0x35,0x100,0x36,0x100,0x37,0x100,0x38,
+  0x100,0x39,0x200,0x31,0x30,0x200,0x31,0x31,
+  0x200,0x31,0x32,0x200,0x31,0x33,0x200,0x31,
+  0x34,0x200,0x31,0x35,0x200,0x31,0x36,0x200,
+  0x31,0x37,0x200,0x31,0x38,0x200,0x31,0x39,
+  0x200,0x32,0x30,0x300,0x28,0x31,0x29,0x300,
+  0x28,0x32,0x29,0x300,0x28,0x33,0x29,0x300,
+  0x28,0x34,0x29,0x300,0x28,0x35,0x29,0x300,
+  0x28,0x36,0x29,0x300,0x28,0x37,0x29,0x300,
+  0x28,0x38,0x29,0x300,0x28,0x39,0x29,0x400,
+  0x28,0x31,0x30,0x29,0x400,0x28,0x31,0x31,
+  0x29,0x400,0x28,0x31,0x32,0x29,0x400,0x28,
+  0x31,0x33,0x29,0x400,0x28,0x31,0x34,0x29,
+  0x400,0x28,0x31,0x35,0x29,0x400,0x28,0x31,
+  0x36,0x29,0x400,0x28,0x31,0x37,0x29,0x400,
+  0x28,0x31,0x38,0x29,0x400,0x28,0x31,0x39,
+  0x29,0x400,0x28,0x32,0x30,0x29,0x200,0x31,
+  0x2E,0x200,0x32,0x2E,0x200,0x33,0x2E,0x200,
+  0x34,0x2E,0x200,0x35,0x2E,0x200,0x36,0x2E,
+  0x200,0x37,0x2E,0x200,0x38,0x2E,0x200,0x39,
+  0x2E,0x300,0x31,0x30,0x2E,0x300,0x31,0x31,
+  0x2E,0x300,0x31,0x32,0x2E,0x300,0x31,0x33,
+  0x2E,0x300,0x31,0x34,0x2E,0x300,0x31,0x35,
+  0x2E,0x300,0x31,0x36,0x2E,0x300,0x31,0x37,
+  0x2E,0x300,0x31,0x38,0x2E,0x300,0x31,0x39,
+  0x2E,0x300,0x32,0x30,0x2E,0x300,0x28,0x61,
+  0x29,0x300,0x28,0x62,0x29,0x300,0x28,0x63,
+  0x29,0x300,0x28,0x64,0x29,0x300,0x28,0x65,
+  0x29,0x300,0x28,0x66,0x29,0x300,0x28,0x67,
+  0x29,0x300,0x28,0x68,0x29,0x300,0x28,0x69,
+  0x29,0x300,0x28,0x6A,0x29,0x300,0x28,0x6B,
+  0x29,0x300,0x28,0x6C,0x29,0x300,0x28,0x6D,
+  0x29,0x300,0x28,0x6E,0x29,0x300,0x28,0x6F,
+  0x29,0x300,0x28,0x70,0x29,0x300,0x28,0x71,
+  0x29,0x300,0x28,0x72,0x29,0x300,0x28,0x73,
+  0x29,0x300,0x28,0x74,0x29,0x300,0x28,0x75,
+  0x29,0x300,0x28,0x76,0x29,0x300,0x28,0x77,
+  0x29,0x300,0x28,0x78,0x29,0x300,0x28,0x79,
+  0x29,0x300,0x28,0x7A,0x29,0x100,0x41,0x100,
+  0x42,0x100,0x43,0x100,0x44,0x100,0x45,0x100,
+  0x46,0x100,0x47,0x100,0x48,0x100,0x49,0x100,
+  0x4A,0x100,0x4B,0x100,0x4C,0x100,0x4D,0x100,
+  0x4E,0x100,0x4F,0x100,0x50,0x100,0x51,0x100,
+  0x52,0x100,0x53,0x100,0x54,0x100,0x55,0x100,
+  0x56,0x100,0x57,0x100,0x58,0x100,0x59,0x100,
+  0x5A,0x100,0x61,0x100,0x62,0x100,0x63,0x100,
+  0x64,0x100,0x65,0x100,0x66,0x100,0x67,0x100,
+  0x68,0x100,0x69,0x100,0x6A,0x100,0x6B,0x100,
+  0x6C,0x100,0x6D,0x100,0x6E,0x100,0x6F,0x100,
+  0x70,0x100,0x71,0x100,0x72,0x100,0x73,0x100,
+  0x74,0x100,0x75,0x100,0x76,0x100,0x77,0x100,
+  0x78,0x100,0x79,0x100,0x7A,0x100,0x30,0x400,
+  0x222B,0x222B,0x222B,0x222B,0x300,0x3A,0x3A,0x3D,
+  0x200,0x3D,0x3D,0x300,0x3D,0x3D,0x3D,0x202,
+  0x2ADD,0x338,0x100,0x6A,0x100,0x56,0x100,0x2D61,
+  0x100,0x6BCD,0x100,0x9F9F,0x100,0x4E00,0x100,0x4E28,
+  0x100,0x4E36,0x100,0x4E3F,0x100,0x4E59,0x100,0x4E85,
+  0x100,0x4E8C,0x100,0x4EA0,0x100,0x4EBA,0x100,0x513F,
+  0x100,0x5165,0x100,0x516B,0x100,0x5182,0x100,0x5196,
+  0x100,0x51AB,0x100,0x51E0,0x100,0x51F5,0x100,0x5200,
+  0x100,0x529B,0x100,0x52F9,0x100,0x5315,0x100,0x531A,
+  0x100,0x5338,0x100,0x5341,0x100,0x535C,0x100,0x5369,
+  0x100,0x5382,0x100,0x53B6,0x100,0x53C8,0x100,0x53E3,
+  0x100,0x56D7,0x100,0x571F,0x100,0x58EB,0x100,0x5902,
+  0x100,0x590A,0x100,0x5915,0x100,0x5927,0x100,0x5973,
+  0x100,0x5B50,0x100,0x5B80,0x100,0x5BF8,0x100,0x5C0F,
+  0x100,0x5C22,0x100,0x5C38,0x100,0x5C6E,0x100,0x5C71,
+  0x100,0x5DDB,0x100,0x5DE5,0x100,0x5DF1,0x100,0x5DFE,
+  0x100,0x5E72,0x100,0x5E7A,0x100,0x5E7F,0x100,0x5EF4,
+  0x100,0x5EFE,0x100,0x5F0B,0x100,0x5F13,0x100,0x5F50,
+  0x100,0x5F61,0x100,0x5F73,0x100,0x5FC3,0x100,0x6208,
+  0x100,0x6236,0x100,0x624B,0x100,0x652F,0x100,0x6534,
+  0x100,0x6587,0x100,0x6597,0x100,0x65A4,0x100,0x65B9,
+  0x100,0x65E0,0x100,0x65E5,0x100,0x66F0,0x100,0x6708,
+  0x100,0x6728,0x100,0x6B20,0x100,0x6B62,0x100,0x6B79,
+  0x100,0x6BB3,0x100,0x6BCB,0x100,0x6BD4,0x100,0x6BDB,
+  0x100,0x6C0F,0x100,0x6C14,0x100,0x6C34,0x100,0x706B,
+  0x100,0x722A,0x100,0x7236,0x100,0x723B,0x100,0x723F,
+  0x100,0x7247,0x100,0x7259,0x100,0x725B,0x100,0x72AC,
+  0x100,0x7384,0x100,0x7389,0x100,0x74DC,0x100,0x74E6,
+  0x100,0x7518,0x100,0x751F,0x100,0x7528,0x100,0x7530,
+  0x100,0x758B,0x100,0x7592,0x100,0x7676,0x100,0x767D,
+  0x100,0x76AE,0x100,0x76BF,0x100,0x76EE,0x100,0x77DB,
+  0x100,0x77E2,0x100,0x77F3,0x100,0x793A,0x100,0x79B8,
+  0x100,0x79BE,0x100,0x7A74,0x100,0x7ACB,0x100,0x7AF9,
+  0x100,0x7C73,0x100,0x7CF8,0x100,0x7F36,0x100,0x7F51,
+  0x100,0x7F8A,0x100,0x7FBD,0x100,0x8001,0x100,0x800C,
+  0x100,0x8012,0x100,0x8033,0x100,0x807F,0x100,0x8089,
+  0x100,0x81E3,0x100,0x81EA,0x100,0x81F3,0x100,0x81FC,
+  0x100,0x820C,0x100,0x821B,0x100,0x821F,0x100,0x826E,
+  0x100,0x8272,0x100,0x8278,0x100,0x864D,0x100,0x866B,
+  0x100,0x8840,0x100,0x884C,0x100,0x8863,0x100,0x897E,
+  0x100,0x898B,0x100,0x89D2,0x100,0x8A00,0x100,0x8C37,
+  0x100,0x8C46,0x100,0x8C55,0x100,0x8C78,0x100,0x8C9D,
+  0x100,0x8D64,0x100,0x8D70,0x100,0x8DB3,0x100,0x8EAB,
+  0x100,0x8ECA,0x100,0x8F9B,0x100,0x8FB0,0x100,0x8FB5,
+  0x100,0x9091,0x100,0x9149,0x100,0x91C6,0x100,0x91CC,
+  0x100,0x91D1,0x100,0x9577,0x100,0x9580,0x100,0x961C,
+  0x100,0x96B6,0x100,0x96B9,0x100,0x96E8,0x100,0x9751,
+  0x100,0x975E,0x100,0x9762,0x100,0x9769,0x100,0x97CB,
+  0x100,0x97ED,0x100,0x97F3,0x100,0x9801,0x100,0x98A8,
+  0x100,0x98DB,0x100,0x98DF,0x100,0x9996,0x100,0x9999,
+  0x100,0x99AC,0x100,0x9AA8,0x100,0x9AD8,0x100,0x9ADF,
+  0x100,0x9B25,0x100,0x9B2F,0x100,0x9B32,0x100,0x9B3C,
+  0x100,0x9B5A,0x100,0x9CE5,0x100,0x9E75,0x100,0x9E7F,
+  0x100,0x9EA5,0x100,0x9EBB,0x100,0x9EC3,0x100,0x9ECD,
+  0x100,0x9ED1,0x100,0x9EF9,0x100,0x9EFD,0x100,0x9F0E,
+  0x100,0x9F13,0x100,0x9F20,0x100,0x9F3B,0x100,0x9F4A,
+  0x100,0x9F52,0x100,0x9F8D,0x100,0x9F9C,0x100,0x9FA0,
+  0x100,0x20,0x100,0x3012,0x100,0x5341,0x100,0x5344,
+  0x100,0x5345,0x202,0x304B,0x3099,0x202,0x304D,0x3099,
+  0x202,0x304F,0x3099,0x202,0x3051,0x3099,0x202,0x3053,
+  0x3099,0x202,0x3055,0x3099,0x202,0x3057,0x3099,0x202,
+  0x3059,0x3099,0x202,0x305B,0x3099,0x202,0x305D,0x3099,
+  0x202,0x305F,0x3099,0x202,0x3061,0x3099,0x202,0x3064,
+  0x3099,0x202,0x3066,0x3099,0x202,0x3068,0x3099,0x202,
+  0x306F,0x3099,0x202,0x306F,0x309A,0x202,0x3072,0x3099,
+  0x202,0x3072,0x309A,0x202,0x3075,0x3099,0x202,0x3075,
+  0x309A,0x202,0x3078,0x3099,0x202,0x3078,0x309A,0x202,
+  0x307B,0x3099,0x202,0x307B,0x309A,0x202,0x3046,0x3099,
+  0x200,0x20,0x3099,0x200,0x20,0x309A,0x202,0x309D,
+  0x3099,0x200,0x3088,0x308A,0x202,0x30AB,0x3099,0x202,
+  0x30AD,0x3099,0x202,0x30AF,0x3099,0x202,0x30B1,0x3099,
+  0x202,0x30B3,0x3099,0x202,0x30B5,0x3099,0x202,0x30B7,
+  0x3099,0x202,0x30B9,0x3099,0x202,0x30BB,0x3099,0x202,
+  0x30BD,0x3099,0x202,0x30BF,0x3099,0x202,0x30C1,0x3099,
+  0x202,0x30C4,0x3099,0x202,0x30C6,0x3099,0x202,0x30C8,
+  0x3099,0x202,0x30CF,0x3099,0x202,0x30CF,0x309A,0x202,
+  0x30D2,0x3099,0x202,0x30D2,0x309A,0x202,0x30D5,0x3099,
+  0x202,0x30D5,0x309A,0x202,0x30D8,0x3099,0x202,0x30D8,
+  0x309A,0x202,0x30DB,0x3099,0x202,0x30DB,0x309A,0x202,
+  0x30A6,0x3099,0x202,0x30EF,0x3099,0x202,0x30F0,0x3099,
+  0x202,0x30F1,0x3099,0x202,0x30F2,0x3099,0x202,0x30FD,
+  0x3099,0x200,0x30B3,0x30C8,0x100,0x1100,0x100,0x1101,
+  0x100,0x11AA,0x100,0x1102,0x100,0x11AC,0x100,0x11AD,
+  0x100,0x1103,0x100,0x1104,0x100,0x1105,0x100,0x11B0,
+  0x100,0x11B1,0x100,0x11B2,0x100,0x11B3,0x100,0x11B4,
+  0x100,0x11B5,0x100,0x111A,0x100,0x1106,0x100,0x1107,
+  0x100,0x1108,0x100,0x1121,0x100,0x1109,0x100,0x110A,
+  0x100,0x110B,0x100,0x110C,0x100,0x110D,0x100,0x110E,
+  0x100,0x110F,0x100,0x1110,0x100,0x1111,0x100,0x1112,
+  0x100,0x1161,0x100,0x1162,0x100,0x1163,0x100,0x1164,
+  0x100,0x1165,0x100,0x1166,0x100,0x1167,0x100,0x1168,
+  0x100,0x1169,0x100,0x116A,0x100,0x116B,0x100,0x116C,
+  0x100,0x116D,0x100,0x116E,0x100,0x116F,0x100,0x1170,
+  0x100,0x1171,0x100,0x1172,0x100,0x1173,0x100,0x1174,
+  0x100,0x1175,0x100,0x1160,0x100,0x1114,0x100,0x1115,
+  0x100,0x11C7,0x100,0x11C8,0x100,0x11CC,0x100,0x11CE,
+  0x100,0x11D3,0x100,0x11D7,0x100,0x11D9,0x100,0x111C,
+  0x100,0x11DD,0x100,0x11DF,0x100,0x111D,0x100,0x111E,
+  0x100,0x1120,0x100,0x1122,0x100,0x1123,0x100,0x1127,
+  0x100,0x1129,0x100,0x112B,0x100,0x112C,0x100,0x112D,
+  0x100,0x112E,0x100,0x112F,0x100,0x1132,0x100,0x1136,
+  0x100,0x1140,0x100,0x1147,0x100,0x114C,0x100,0x11F1,
+  0x100,0x11F2,0x100,0x1157,0x100,0x1158,0x100,0x1159,
+  0x100,0x1184,0x100,0x1185,0x100,0x1188,0x100,0x1191,
+  0x100,0x1192,0x100,0x1194,0x100,0x119E,0x100,0x11A1,
+  0x100,0x4E00,0x100,0x4E8C,0x100,0x4E09,0x100,0x56DB,
+  0x100,0x4E0A,0x100,0x4E2D,0x100,0x4E0B,0x100,0x7532,
+  0x100,0x4E59,0x100,0x4E19,0x100,0x4E01,0x100,0x5929,
+  0x100,0x5730,0x100,0x4EBA,0x300,0x28,0x1100,0x29,
+  0x300,0x28,0x1102,0x29,0x300,0x28,0x1103,0x29,
+  0x300,0x28,0x1105,0x29,0x300,0x28,0x1106,0x29,
+  0x300,0x28,0x1107,0x29,0x300,0x28,0x1109,0x29,
+  0x300,0x28,0x110B,0x29,0x300,0x28,0x110C,0x29,
+  0x300,0x28,0x110E,0x29,0x300,0x28,0x110F,0x29,
+  0x300,0x28,0x1110,0x29,0x300,0x28,0x1111,0x29,
+  0x300,0x28,0x1112,0x29,0x400,0x28,0x1100,0x1161,
+  0x29,0x400,0x28,0x1102,0x1161,0x29,0x400,0x28,
+  0x1103,0x1161,0x29,0x400,0x28,0x1105,0x1161,0x29,
+  0x400,0x28,0x1106,0x1161,0x29,0x400,0x28,0x1107,
+  0x1161,0x29,0x400,0x28,0x1109,0x1161,0x29,0x400,
+  0x28,0x110B,0x1161,0x29,0x400,0x28,0x110C,0x1161,
+  0x29,0x400,0x28,0x110E,0x1161,0x29,0x400,0x28,
+  0x110F,0x1161,0x29,0x400,0x28,0x1110,0x1161,0x29,
+  0x400,0x28,0x1111,0x1161,0x29,0x400,0x28,0x1112,
+  0x1161,0x29,0x400,0x28,0x110C,0x116E,0x29,0x700,
+  0x28,0x110B,0x1169,0x110C,0x1165,0x11AB,0x29,0x600,
+  0x28,0x110B,0x1169,0x1112,0x116E,0x29,0x300,0x28,
+  0x4E00,0x29,0x300,0x28,0x4E8C,0x29,0x300,0x28,
+  0x4E09,0x29,0x300,0x28,0x56DB,0x29,0x300,0x28,
+  0x4E94,0x29,0x300,0x28,0x516D,0x29,0x300,0x28,
+  0x4E03,0x29,0x300,0x28,0x516B,0x29,0x300,0x28,
+  0x4E5D,0x29,0x300,0x28,0x5341,0x29,0x300,0x28,
+  0x6708,0x29,0x300,0x28,0x706B,0x29,0x300,0x28,
+  0x6C34,0x29,0x300,0x28,0x6728,0x29,0x300,0x28,
+  0x91D1,0x29,0x300,0x28,0x571F,0x29,0x300,0x28,
+  0x65E5,0x29,0x300,0x28,0x682A,0x29,0x300,0x28,
+  0x6709,0x29,0x300,0x28,0x793E,0x29,0x300,0x28,
+  0x540D,0x29,0x300,0x28,0x7279,0x29,0x300,0x28,
+  0x8CA1,0x29,0x300,0x28,0x795D,0x29,0x300,0x28,
+  0x52B4,0x29,0x300,0x28,0x4EE3,0x29,0x300,0x28,
+  0x547C,0x29,0x300,0x28,0x5B66,0x29,0x300,0x28,
+  0x76E3,0x29,0x300,0x28,0x4F01,0x29,0x300,0x28,
+  0x8CC7,0x29,0x300,0x28,0x5354,0x29,0x300,0x28,
+  0x796D,0x29,0x300,0x28,0x4F11,0x29,0x300,0x28,
+  0x81EA,0x29,0x300,0x28,0x81F3,0x29,0x100,0x554F,
+  0x100,0x5E7C,0x100,0x6587,0x100,0x7B8F,0x300,0x50,
+  0x54,0x45,0x200,0x32,0x31,0x200,0x32,0x32,
+  0x200,0x32,0x33,0x200,0x32,0x34,0x200,0x32,
+  0x35,0x200,0x32,0x36,0x200,0x32,0x37,0x200,
+  0x32,0x38,0x200,0x32,0x39,0x200,0x33,0x30,
+  0x200,0x33,0x31,0x200,0x33,0x32,0x200,0x33,
+  0x33,0x200,0x33,0x34,0x200,0x33,0x35,0x100,
+  0x1100,0x100,0x1102,0x100,0x1103,0x100,0x1105,0x100,
+  0x1106,0x100,0x1107,0x100,0x1109,0x100,0x110B,0x100,
+  0x110C,0x100,0x110E,0x100,0x110F,0x100,0x1110,0x100,
+  0x1111,0x100,0x1112,0x200,0x1100,0x1161,0x200,0x1102,
+  0x1161,0x200,0x1103,0x1161,0x200,0x1105,0x1161,0x200,
+  0x1106,0x1161,0x200,0x1107,0x1161,0x200,0x1109,0x1161,
+  0x200,0x110B,0x1161,0x200,0x110C,0x1161,0x200,0x110E,
+  0x1161,0x200,0x110F,0x1161,0x200,0x1110,0x1161,0x200,
+  0x1111,0x1161,0x200,0x1112,0x1161,0x500,0x110E,0x1161,
+  0x11B7,0x1100,0x1169,0x400,0x110C,0x116E,0x110B,0x1174,
+  0x200,0x110B,0x116E,0x100,0x4E00,0x100,0x4E8C,0x100,
+  0x4E09,0x100,0x56DB,0x100,0x4E94,0x100,0x516D,0x100,
+  0x4E03,0x100,0x516B,0x100,0x4E5D,0x100,0x5341,0x100,
+  0x6708,0x100,0x706B,0x100,0x6C34,0x100,0x6728,0x100,
+  0x91D1,0x100,0x571F,0x100,0x65E5,0x100,0x682A,0x100,
+  0x6709,0x100,0x793E,0x100,0x540D,0x100,0x7279,0x100,
+  0x8CA1,0x100,0x795D,0x100,0x52B4,0x100,0x79D8,0x100,
+  0x7537,0x100,0x5973,0x100,0x9069,0x100,0x512A,0x100,
+  0x5370,0x100,0x6CE8,0x100,0x9805,0x100,0x4F11,0x100,
+  0x5199,0x100,0x6B63,0x100,0x4E0A,0x100,0x4E2D,0x100,
+  0x4E0B,0x100,0x5DE6,0x100,0x53F3,0x100,0x533B,0x100,
+  0x5B97,0x100,0x5B66,0x100,0x76E3,0x100,0x4F01,0x100,
+  0x8CC7,0x100,0x5354,0x100,0x591C,0x200,0x33,0x36,
+  0x200,0x33,0x37,0x200,0x33,0x38,0x200,0x33,
+  0x39,0x200,0x34,0x30,0x200,0x34,0x31,0x200,
+  0x34,0x32,0x200,0x34,0x33,0x200,0x34,0x34,
+  0x200,0x34,0x35,0x200,0x34,0x36,0x200,0x34,
+  0x37,0x200,0x34,0x38,0x200,0x34,0x39,0x200,
+  0x35,0x30,0x200,0x31,0x6708,0x200,0x32,0x6708,
+  0x200,0x33,0x6708,0x200,0x34,0x6708,0x200,0x35,
+  0x6708,0x200,0x36,0x6708,0x200,0x37,0x6708,0x200,
+  0x38,0x6708,0x200,0x39,0x6708,0x300,0x31,0x30,
+  0x6708,0x300,0x31,0x31,0x6708,0x300,0x31,0x32,
+  0x6708,0x200,0x48,0x67,0x300,0x65,0x72,0x67,
+  0x200,0x65,0x56,0x300,0x4C,0x54,0x44,0x100,
+  0x30A2,0x100,0x30A4,0x100,0x30A6,0x100,0x30A8,0x100,
+  0x30AA,0x100,0x30AB,0x100,0x30AD,0x100,0x30AF,0x100,
+  0x30B1,0x100,0x30B3,0x100,0x30B5,0x100,0x30B7,0x100,
+  0x30B9,0x100,0x30BB,0x100,0x30BD,0x100,0x30BF,0x100,
+  0x30C1,0x100,0x30C4,0x100,0x30C6,0x100,0x30C8,0x100,
+  0x30CA,0x100,0x30CB,0x100,0x30CC,0x100,0x30CD,0x100,
+  0x30CE,0x100,0x30CF,0x100,0x30D2,0x100,0x30D5,0x100,
+  0x30D8,0x100,0x30DB,0x100,0x30DE,0x100,0x30DF,0x100,
+  0x30E0,0x100,0x30E1,0x100,0x30E2,0x100,0x30E4,0x100,
+  0x30E6,0x100,0x30E8,0x100,0x30E9,0x100,0x30EA,0x100,
+  0x30EB,0x100,0x30EC,0x100,0x30ED,0x100,0x30EF,0x100,
+  0x30F0,0x100,0x30F1,0x100,0x30F2,0x200,0x4EE4,0x548C,
+  0x500,0x30A2,0x30CF,0x309A,0x30FC,0x30C8,0x400,0x30A2,
+  0x30EB,0x30D5,0x30A1,0x500,0x30A2,0x30F3,0x30D8,0x309A,
+  0x30A2,0x300,0x30A2,0x30FC,0x30EB,0x500,0x30A4,0x30CB,
+  0x30F3,0x30AF,0x3099,0x300,0x30A4,0x30F3,0x30C1,0x300,
+  0x30A6,0x30A9,0x30F3,0x600,0x30A8,0x30B9,0x30AF,0x30FC,
+  0x30C8,0x3099,0x400,0x30A8,0x30FC,0x30AB,0x30FC,0x300,
+  0x30AA,0x30F3,0x30B9,0x300,0x30AA,0x30FC,0x30E0,0x300,
+  0x30AB,0x30A4,0x30EA,0x400,0x30AB,0x30E9,0x30C3,0x30C8,
+  0x400,0x30AB,0x30ED,0x30EA,0x30FC,0x400,0x30AB,0x3099,
+  0x30ED,0x30F3,0x400,0x30AB,0x3099,0x30F3,0x30DE,0x400,
+  0x30AD,0x3099,0x30AB,0x3099,0x400,0x30AD,0x3099,0x30CB,
+  0x30FC,0x400,0x30AD,0x30E5,0x30EA,0x30FC,0x600,0x30AD,
+  0x3099,0x30EB,0x30BF,0x3099,0x30FC,0x200,0x30AD,0x30ED,
+  0x600,0x30AD,0x30ED,0x30AF,0x3099,0x30E9,0x30E0,0x600,
+  0x30AD,0x30ED,0x30E1,0x30FC,0x30C8,0x30EB,0x500,0x30AD,
+  0x30ED,0x30EF,0x30C3,0x30C8,0x400,0x30AF,0x3099,0x30E9,
+  0x30E0,0x600,0x30AF,0x3099,0x30E9,0x30E0,0x30C8,0x30F3,
+  0x600,0x30AF,0x30EB,0x30BB,0x3099,0x30A4,0x30ED,0x400,
+  0x30AF,0x30ED,0x30FC,0x30CD,0x300,0x30B1,0x30FC,0x30B9,
+  0x300,0x30B3,0x30EB,0x30CA,0x400,0x30B3,0x30FC,0x30DB,
+  0x309A,0x400,0x30B5,0x30A4,0x30AF,0x30EB,0x500,0x30B5,
+  0x30F3,0x30C1,0x30FC,0x30E0,0x500,0x30B7,0x30EA,0x30F3,
+  0x30AF,0x3099,0x300,0x30BB,0x30F3,0x30C1,0x300,0x30BB,
+  0x30F3,0x30C8,0x400,0x30BF,0x3099,0x30FC,0x30B9,0x300,
+  0x30C6,0x3099,0x30B7,0x300,0x30C8,0x3099,0x30EB,0x200,
+  0x30C8,0x30F3,0x200,0x30CA,0x30CE,0x300,0x30CE,0x30C3,
+  0x30C8,0x300,0x30CF,0x30A4,0x30C4,0x600,0x30CF,0x309A,
+  0x30FC,0x30BB,0x30F3,0x30C8,0x400,0x30CF,0x309A,0x30FC,
+  0x30C4,0x500,0x30CF,0x3099,0x30FC,0x30EC,0x30EB,0x600,
+  0x30D2,0x309A,0x30A2,0x30B9,0x30C8,0x30EB,0x400,0x30D2,
+  0x309A,0x30AF,0x30EB,0x300,0x30D2,0x309A,0x30B3,0x300,
+  0x30D2,0x3099,0x30EB,0x600,0x30D5,0x30A1,0x30E9,0x30C3,
+  0x30C8,0x3099,0x400,0x30D5,0x30A3,0x30FC,0x30C8,0x600,
+  0x30D5,0x3099,0x30C3,0x30B7,0x30A7,0x30EB,0x300,0x30D5,
+  0x30E9,0x30F3,0x500,0x30D8,0x30AF,0x30BF,0x30FC,0x30EB,
+  0x300,0x30D8,0x309A,0x30BD,0x400,0x30D8,0x309A,0x30CB,
+  0x30D2,0x300,0x30D8,0x30EB,0x30C4,0x400,0x30D8,0x309A,
+  0x30F3,0x30B9,0x500,0x30D8,0x309A,0x30FC,0x30B7,0x3099,
+  0x400,0x30D8,0x3099,0x30FC,0x30BF,0x500,0x30DB,0x309A,
+  0x30A4,0x30F3,0x30C8,0x400,0x30DB,0x3099,0x30EB,0x30C8,
+  0x200,0x30DB,0x30F3,0x500,0x30DB,0x309A,0x30F3,0x30C8,
+  0x3099,0x300,0x30DB,0x30FC,0x30EB,0x300,0x30DB,0x30FC,
+  0x30F3,0x400,0x30DE,0x30A4,0x30AF,0x30ED,0x300,0x30DE,
+  0x30A4,0x30EB,0x300,0x30DE,0x30C3,0x30CF,0x300,0x30DE,
+  0x30EB,0x30AF,0x500,0x30DE,0x30F3,0x30B7,0x30E7,0x30F3,
+  0x400,0x30DF,0x30AF,0x30ED,0x30F3,0x200,0x30DF,0x30EA,
+  0x600,0x30DF,0x30EA,0x30CF,0x3099,0x30FC,0x30EB,0x300,
+  0x30E1,0x30AB,0x3099,0x500,0x30E1,0x30AB,0x3099,0x30C8,
+  0x30F3,0x400,0x30E1,0x30FC,0x30C8,0x30EB,0x400,0x30E4,
+  0x30FC,0x30C8,0x3099,0x300,0x30E4,0x30FC,0x30EB,0x300,
+  0x30E6,0x30A2,0x30F3,0x400,0x30EA,0x30C3,0x30C8,0x30EB,
+  0x200,0x30EA,0x30E9,0x400,0x30EB,0x30D2,0x309A,0x30FC,
+  0x500,0x30EB,0x30FC,0x30D5,0x3099,0x30EB,0x200,0x30EC,
+  0x30E0,0x600,0x30EC,0x30F3,0x30C8,0x30B1,0x3099,0x30F3,
+  0x300,0x30EF,0x30C3,0x30C8,0x200,0x30,0x70B9,0x200,
+  0x31,0x70B9,0x200,0x32,0x70B9,0x200,0x33,0x70B9,
+  0x200,0x34,0x70B9,0x200,0x35,0x70B9,0x200,0x36,
+  0x70B9,0x200,0x37,0x70B9,0x200,0x38,0x70B9,0x200,
+  0x39,0x70B9,0x300,0x31,0x30,0x70B9,0x300,0x31,
+  0x31,0x70B9,0x300,0x31,0x32,0x70B9,0x300,0x31,
+  0x33,0x70B9,0x300,0x31,0x34,0x70B9,0x300,0x31,
+  0x35,0x70B9,0x300,0x31,0x36,0x70B9,0x300,0x31,
+  0x37,0x70B9,0x300,0x31,0x38,0x70B9,0x300,0x31,
+  0x39,0x70B9,0x300,0x32,0x30,0x70B9,0x300,0x32,
+  0x31,0x70B9,0x300,0x32,0x32,0x70B9,0x300,0x32,
+  0x33,0x70B9,0x300,0x32,0x34,0x70B9,0x300,0x68,
+  0x50,0x61,0x200,0x64,0x61,0x200,0x41,0x55,
+  0x300,0x62,0x61,0x72,0x200,0x6F,0x56,0x200,
+  0x70,0x63,0x200,0x64,0x6D,0x300,0x64,0x6D,
+  0x32,0x300,0x64,0x6D,0x33,0x200,0x49,0x55,
+  0x200,0x5E73,0x6210,0x200,0x662D,0x548C,0x200,0x5927,
+  0x6B63,0x200,0x660E,0x6CBB,0x400,0x682A,0x5F0F,0x4F1A,
+  0x793E,0x200,0x70,0x41,0x200,0x6E,0x41,0x200,
+  0x3BC,0x41,0x200,0x6D,0x41,0x200,0x6B,0x41,
+  0x200,0x4B,0x42,0x200,0x4D,0x42,0x200,0x47,
+  0x42,0x300,0x63,0x61,0x6C,0x400,0x6B,0x63,
+  0x61,0x6C,0x200,0x70,0x46,0x200,0x6E,0x46,
+  0x200,0x3BC,0x46,0x200,0x3BC,0x67,0x200,0x6D,
+  0x67,0x200,0x6B,0x67,0x200,0x48,0x7A,0x300,
+  0x6B,0x48,0x7A,0x300,0x4D,0x48,0x7A,0x300,
+  0x47,0x48,0x7A,0x300,0x54,0x48,0x7A,0x200,
+  0x3BC,0x6C,0x200,0x6D,0x6C,0x200,0x64,0x6C,
+  0x200,0x6B,0x6C,0x200,0x66,0x6D,0x200,0x6E,
+  0x6D,0x200,0x3BC,0x6D,0x200,0x6D,0x6D,0x200,
+  0x63,0x6D,0x200,0x6B,0x6D,0x300,0x6D,0x6D,
+  0x32,0x300,0x63,0x6D,0x32,0x200,0x6D,0x32,
+  0x300,0x6B,0x6D,0x32,0x300,0x6D,0x6D,0x33,
+  0x300,0x63,0x6D,0x33,0x200,0x6D,0x33,0x300,
+  0x6B,0x6D,0x33,0x300,0x6D,0x2215,0x73,0x400,
+  0x6D,0x2215,0x73,0x32,0x200,0x50,0x61,0x300,
+  0x6B,0x50,0x61,0x300,0x4D,0x50,0x61,0x300,
+  0x47,0x50,0x61,0x300,0x72,0x61,0x64,0x500,
+  0x72,0x61,0x64,0x2215,0x73,0x600,0x72,0x61,
+  0x64,0x2215,0x73,0x32,0x200,0x70,0x73,0x200,
+  0x6E,0x73,0x200,0x3BC,0x73,0x200,0x6D,0x73,
+  0x200,0x70,0x56,0x200,0x6E,0x56,0x200,0x3BC,
+  0x56,0x200,0x6D,0x56,0x200,0x6B,0x56,0x200,
+  0x4D,0x56,0x200,0x70,0x57,0x200,0x6E,0x57,
+  0x200,0x3BC,0x57,0x200,0x6D,0x57,0x200,0x6B,
+  0x57,0x200,0x4D,0x57,0x200,0x6B,0x3A9,0x200,
+  0x4D,0x3A9,0x400,0x61,0x2E,0x6D,0x2E,0x200,
+  0x42,0x71,0x200,0x63,0x63,0x200,0x63,0x64,
+  0x400,0x43,0x2215,0x6B,0x67,0x300,0x43,0x6F,
+  0x2E,0x200,0x64,0x42,0x200,0x47,0x79,0x200,
+  0x68,0x61,0x200,0x48,0x50,0x200,0x69,0x6E,
+  0x200,0x4B,0x4B,0x200,0x4B,0x4D,0x200,0x6B,
+  0x74,0x200,0x6C,0x6D,0x200,0x6C,0x6E,0x300,
+  0x6C,0x6F,0x67,0x200,0x6C,0x78,0x200,0x6D,
+  0x62,0x300,0x6D,0x69,0x6C,0x300,0x6D,0x6F,
+  0x6C,0x200,0x50,0x48,0x400,0x70,0x2E,0x6D,
+  0x2E,0x300,0x50,0x50,0x4D,0x200,0x50,0x52,
+  0x200,0x73,0x72,0x200,0x53,0x76,0x200,0x57,
+  0x62,0x300,0x56,0x2215,0x6D,0x300,0x41,0x2215,
+  0x6D,0x200,0x31,0x65E5,0x200,0x32,0x65E5,0x200,
+  0x33,0x65E5,0x200,0x34,0x65E5,0x200,0x35,0x65E5,
+  0x200,0x36,0x65E5,0x200,0x37,0x65E5,0x200,0x38,
+  0x65E5,0x200,0x39,0x65E5,0x300,0x31,0x30,0x65E5,
+  0x300,0x31,0x31,0x65E5,0x300,0x31,0x32,0x65E5,
+  0x300,0x31,0x33,0x65E5,0x300,0x31,0x34,0x65E5,
+  0x300,0x31,0x35,0x65E5,0x300,0x31,0x36,0x65E5,
+  0x300,0x31,0x37,0x65E5,0x300,0x31,0x38,0x65E5,
+  0x300,0x31,0x39,0x65E5,0x300,0x32,0x30,0x65E5,
+  0x300,0x32,0x31,0x65E5,0x300,0x32,0x32,0x65E5,
+  0x300,0x32,0x33,0x65E5,0x300,0x32,0x34,0x65E5,
+  0x300,0x32,0x35,0x65E5,0x300,0x32,0x36,0x65E5,
+  0x300,0x32,0x37,0x65E5,0x300,0x32,0x38,0x65E5,
+  0x300,0x32,0x39,0x65E5,0x300,0x33,0x30,0x65E5,
+  0x300,0x33,0x31,0x65E5,0x300,0x67,0x61,0x6C,
+  0x100,0x44A,0x100,0x44C,0x100,0xA76F,0x100,0x43,
+  0x100,0x46,0x100,0x51,0x100,0x126,0x100,0x153,
+  0x100,0xA727,0x100,0xAB37,0x100,0x26B,0x100,0xAB52,
+  0x100,0x28D,0x101,0x8C48,0x101,0x66F4,0x101,0x8ECA,
+  0x101,0x8CC8,0x101,0x6ED1,0x101,0x4E32,0x101,0x53E5,
+  0x101,0x9F9C,0x101,0x9F9C,0x101,0x5951,0x101,0x91D1,
+  0x101,0x5587,0x101,0x5948,0x101,0x61F6,0x101,0x7669,
+  0x101,0x7F85,0x101,0x863F,0x101,0x87BA,0x101,0x88F8,
+  0x101,0x908F,0x101,0x6A02,0x101,0x6D1B,0x101,0x70D9,
+  0x101,0x73DE,0x101,0x843D,0x101,0x916A,0x101,0x99F1,
+  0x101,0x4E82,0x101,0x5375,0x101,0x6B04,0x101,0x721B,
+  0x101,0x862D,0x101,0x9E1E,0x101,0x5D50,0x101,0x6FEB,
+  0x101,0x85CD,0x101,0x8964,0x101,0x62C9,0x101,0x81D8,
+  0x101,0x881F,0x101,0x5ECA,0x101,0x6717,0x101,0x6D6A,
+  0x101,0x72FC,0x101,0x90CE,0x101,0x4F86,0x101,0x51B7,
+  0x101,0x52DE,0x101,0x64C4,0x101,0x6AD3,0x101,0x7210,
+  0x101,0x76E7,0x101,0x8001,0x101,0x8606,0x101,0x865C,
+  0x101,0x8DEF,0x101,0x9732,0x101,0x9B6F,0x101,0x9DFA,
+  0x101,0x788C,0x101,0x797F,0x101,0x7DA0,0x101,0x83C9,
+  0x101,0x9304,0x101,0x9E7F,0x101,0x8AD6,0x101,0x58DF,
+  0x101,0x5F04,0x101,0x7C60,0x101,0x807E,0x101,0x7262,
+  0x101,0x78CA,0x101,0x8CC2,0x101,0x96F7,0x101,0x58D8,
+  0x101,0x5C62,0x101,0x6A13,0x101,0x6DDA,0x101,0x6F0F,
+  0x101,0x7D2F,0x101,0x7E37,0x101,0x964B,0x101,0x52D2,
+  0x101,0x808B,0x101,0x51DC,0x101,0x51CC,0x101,0x7A1C,
+  0x101,0x7DBE,0x101,0x83F1,0x101,0x9675,0x101,0x8B80,
+  0x101,0x62CF,0x101,0x6A02,0x101,0x8AFE,0x101,0x4E39,
+  0x101,0x5BE7,0x101,0x6012,0x101,0x7387,0x101,0x7570,
+  0x101,0x5317,0x101,0x78FB,0x101,0x4FBF,0x101,0x5FA9,
+  0x101,0x4E0D,0x101,0x6CCC,0x101,0x6578,0x101,0x7D22,
+  0x101,0x53C3,0x101,0x585E,0x101,0x7701,0x101,0x8449,
+  0x101,0x8AAA,0x101,0x6BBA,0x101,0x8FB0,0x101,0x6C88,
+  0x101,0x62FE,0x101,0x82E5,0x101,0x63A0,0x101,0x7565,
+  0x101,0x4EAE,0x101,0x5169,0x101,0x51C9,0x101,0x6881,
+  0x101,0x7CE7,0x101,0x826F,0x101,0x8AD2,0x101,0x91CF,
+  0x101,0x52F5,0x101,0x5442,0x101,0x5973,0x101,0x5EEC,
+  0x101,0x65C5,0x101,0x6FFE,0x101,0x792A,0x101,0x95AD,
+  0x101,0x9A6A,0x101,0x9E97,0x101,0x9ECE,0x101,0x529B,
+  0x101,0x66C6,0x101,0x6B77,0x101,0x8F62,0x101,0x5E74,
+  0x101,0x6190,0x101,0x6200,0x101,0x649A,0x101,0x6F23,
+  0x101,0x7149,0x101,0x7489,0x101,0x79CA,0x101,0x7DF4,
+  0x101,0x806F,0x101,0x8F26,0x101,0x84EE,0x101,0x9023,
+  0x101,0x934A,0x101,0x5217,0x101,0x52A3,0x101,0x54BD,
+  0x101,0x70C8,0x101,0x88C2,0x101,0x8AAA,0x101,0x5EC9,
+  0x101,0x5FF5,0x101,0x637B,0x101,0x6BAE,0x101,0x7C3E,
+  0x101,0x7375,0x101,0x4EE4,0x101,0x56F9,0x101,0x5BE7,
+  0x101,0x5DBA,0x101,0x601C,0x101,0x73B2,0x101,0x7469,
+  0x101,0x7F9A,0x101,0x8046,0x101,0x9234,0x101,0x96F6,
+  0x101,0x9748,0x101,0x9818,0x101,0x4F8B,0x101,0x79AE,
+  0x101,0x91B4,0x101,0x96B8,0x101,0x60E1,0x101,0x4E86,
+  0x101,0x50DA,0x101,0x5BEE,0x101,0x5C3F,0x101,0x6599,
+  0x101,0x6A02,0x101,0x71CE,0x101,0x7642,0x101,0x84FC,
+  0x101,0x907C,0x101,0x9F8D,0x101,0x6688,0x101,0x962E,
+  0x101,0x5289,0x101,0x677B,0x101,0x67F3,0x101,0x6D41,
+  0x101,0x6E9C,0x101,0x7409,0x101,0x7559,0x101,0x786B,
+  0x101,0x7D10,0x101,0x985E,0x101,0x516D,0x101,0x622E,
+  0x101,0x9678,0x101,0x502B,0x101,0x5D19,0x101,0x6DEA,
+  0x101,0x8F2A,0x101,0x5F8B,0x101,0x6144,0x101,0x6817,
+  0x101,0x7387,0x101,0x9686,0x101,0x5229,0x101,0x540F,
+  0x101,0x5C65,0x101,0x6613,0x101,0x674E,0x101,0x68A8,
+  0x101,0x6CE5,0x101,0x7406,0x101,0x75E2,0x101,0x7F79,
+  0x101,0x88CF,0x101,0x88E1,0x101,0x91CC,0x101,0x96E2,
+  0x101,0x533F,0x101,0x6EBA,0x101,0x541D,0x101,0x71D0,
+  0x101,0x7498,0x101,0x85FA,0x101,0x96A3,0x101,0x9C57,
+  0x101,0x9E9F,0x101,0x6797,0x101,0x6DCB,0x101,0x81E8,
+  0x101,0x7ACB,0x101,0x7B20,0x101,0x7C92,0x101,0x72C0,
+  0x101,0x7099,0x101,0x8B58,0x101,0x4EC0,0x101,0x8336,
+  0x101,0x523A,0x101,0x5207,0x101,0x5EA6,0x101,0x62D3,
+  0x101,0x7CD6,0x101,0x5B85,0x101,0x6D1E,0x101,0x66B4,
+  0x101,0x8F3B,0x101,0x884C,0x101,0x964D,0x101,0x898B,
+  0x101,0x5ED3,0x101,0x5140,0x101,0x55C0,0x101,0x585A,
+  0x101,0x6674,0x101,0x51DE,0x101,0x732A,0x101,0x76CA,
+  0x101,0x793C,0x101,0x795E,0x101,0x7965,0x101,0x798F,
+  0x101,0x9756,0x101,0x7CBE,0x101,0x7FBD,0x101,0x8612,
+  0x101,0x8AF8,0x101,0x9038,0x101,0x90FD,0x101,0x98EF,
+  0x101,0x98FC,0x101,0x9928,0x101,0x9DB4,0x101,0x90DE,
+  0x101,0x96B7,0x101,0x4FAE,0x101,0x50E7,0x101,0x514D,
+  0x101,0x52C9,0x101,0x52E4,0x101,0x5351,0x101,0x559D,
+  0x101,0x5606,0x101,0x5668,0x101,0x5840,0x101,0x58A8,
+  0x101,0x5C64,0x101,0x5C6E,0x101,0x6094,0x101,0x6168,
+  0x101,0x618E,0x101,0x61F2,0x101,0x654F,0x101,0x65E2,
+  0x101,0x6691,0x101,0x6885,0x101,0x6D77,0x101,0x6E1A,
+  0x101,0x6F22,0x101,0x716E,0x101,0x722B,0x101,0x7422,
+  0x101,0x7891,0x101,0x793E,0x101,0x7949,0x101,0x7948,
+  0x101,0x7950,0x101,0x7956,0x101,0x795D,0x101,0x798D,
+  0x101,0x798E,0x101,0x7A40,0x101,0x7A81,0x101,0x7BC0,
+  0x101,0x7DF4,0x101,0x7E09,0x101,0x7E41,0x101,0x7F72,
+  0x101,0x8005,0x101,0x81ED,0x101,0x8279,0x101,0x8279,
+  0x101,0x8457,0x101,0x8910,0x101,0x8996,0x101,0x8B01,
+  0x101,0x8B39,0x101,0x8CD3,0x101,0x8D08,0x101,0x8FB6,
+  0x101,0x9038,0x101,0x96E3,0x101,0x97FF,0x101,0x983B,
+  0x101,0x6075,0x101,0x242EE,0x101,0x8218,0x101,0x4E26,
+  0x101,0x51B5,0x101,0x5168,0x101,0x4F80,0x101,0x5145,
+  0x101,0x5180,0x101,0x52C7,0x101,0x52FA,0x101,0x559D,
+  0x101,0x5555,0x101,0x5599,0x101,0x55E2,0x101,0x585A,
+  0x101,0x58B3,0x101,0x5944,0x101,0x5954,0x101,0x5A62,
+  0x101,0x5B28,0x101,0x5ED2,0x101,0x5ED9,0x101,0x5F69,
+  0x101,0x5FAD,0x101,0x60D8,0x101,0x614E,0x101,0x6108,
+  0x101,0x618E,0x101,0x6160,0x101,0x61F2,0x101,0x6234,
+  0x101,0x63C4,0x101,0x641C,0x101,0x6452,0x101,0x6556,
+  0x101,0x6674,0x101,0x6717,0x101,0x671B,0x101,0x6756,
+  0x101,0x6B79,0x101,0x6BBA,0x101,0x6D41,0x101,0x6EDB,
+  0x101,0x6ECB,0x101,0x6F22,0x101,0x701E,0x101,0x716E,
+  0x101,0x77A7,0x101,0x7235,0x101,0x72AF,0x101,0x732A,
+  0x101,0x7471,0x101,0x7506,0x101,0x753B,0x101,0x761D,
+  0x101,0x761F,0x101,0x76CA,0x101,0x76DB,0x101,0x76F4,
+  0x101,0x774A,0x101,0x7740,0x101,0x78CC,0x101,0x7AB1,
+  0x101,0x7BC0,0x101,0x7C7B,0x101,0x7D5B,0x101,0x7DF4,
+  0x101,0x7F3E,0x101,0x8005,0x101,0x8352,0x101,0x83EF,
+  0x101,0x8779,0x101,0x8941,0x101,0x8986,0x101,0x8996,
+  0x101,0x8ABF,0x101,0x8AF8,0x101,0x8ACB,0x101,0x8B01,
+  0x101,0x8AFE,0x101,0x8AED,0x101,0x8B39,0x101,0x8B8A,
+  0x101,0x8D08,0x101,0x8F38,0x101,0x9072,0x101,0x9199,
+  0x101,0x9276,0x101,0x967C,0x101,0x96E3,0x101,0x9756,
+  0x101,0x97DB,0x101,0x97FF,0x101,0x980B,0x101,0x983B,
+  0x101,0x9B12,0x101,0x9F9C,0x101,0x2284A,0x101,0x22844,
+  0x101,0x233D5,0x101,0x3B9D,0x101,0x4018,0x101,0x4039,
+  0x101,0x25249,0x101,0x25CD0,0x101,0x27ED3,0x101,0x9F43,
+  0x101,0x9F8E,0x200,0x66,0x66,0x200,0x66,0x69,
+  0x200,0x66,0x6C,0x300,0x66,0x66,0x69,0x300,
+  0x66,0x66,0x6C,0x200,0x73,0x74,0x200,0x73,
+  0x74,0x200,0x574,0x576,0x200,0x574,0x565,0x200,
+  0x574,0x56B,0x200,0x57E,0x576,0x200,0x574,0x56D,
+  0x202,0x5D9,0x5B4,0x202,0x5F2,0x5B7,0x100,0x5E2,
+  0x100,0x5D0,0x100,0x5D3,0x100,0x5D4,0x100,0x5DB,
+  0x100,0x5DC,0x100,0x5DD,0x100,0x5E8,0x100,0x5EA,
+  0x100,0x2B,0x202,0x5E9,0x5C1,0x202,0x5E9,0x5C2,
+  0x303,0x5E9,0x5BC,0x5C1,0x303,0x5E9,0x5BC,0x5C2,
+  0x202,0x5D0,0x5B7,0x202,0x5D0,0x5B8,0x202,0x5D0,
+  0x5BC,0x202,0x5D1,0x5BC,0x202,0x5D2,0x5BC,0x202,
+  0x5D3,0x5BC,0x202,0x5D4,0x5BC,0x202,0x5D5,0x5BC,
+  0x202,0x5D6,0x5BC,0x202,0x5D8,0x5BC,0x202,0x5D9,
+  0x5BC,0x202,0x5DA,0x5BC,0x202,0x5DB,0x5BC,0x202,
+  0x5DC,0x5BC,0x202,0x5DE,0x5BC,0x202,0x5E0,0x5BC,
+  0x202,0x5E1,0x5BC,0x202,0x5E3,0x5BC,0x202,0x5E4,
+  0x5BC,0x202,0x5E6,0x5BC,0x202,0x5E7,0x5BC,0x202,
+  0x5E8,0x5BC,0x202,0x5E9,0x5BC,0x202,0x5EA,0x5BC,
+  0x202,0x5D5,0x5B9,0x202,0x5D1,0x5BF,0x202,0x5DB,
+  0x5BF,0x202,0x5E4,0x5BF,0x200,0x5D0,0x5DC,0x100,
+  0x671,0x100,0x671,0x100,0x67B,0x100,0x67B,0x100,
+  0x67B,0x100,0x67B,0x100,0x67E,0x100,0x67E,0x100,
+  0x67E,0x100,0x67E,0x100,0x680,0x100,0x680,0x100,
+  0x680,0x100,0x680,0x100,0x67A,0x100,0x67A,0x100,
+  0x67A,0x100,0x67A,0x100,0x67F,0x100,0x67F,0x100,
+  0x67F,0x100,0x67F,0x100,0x679,0x100,0x679,0x100,
+  0x679,0x100,0x679,0x100,0x6A4,0x100,0x6A4,0x100,
+  0x6A4,0x100,0x6A4,0x100,0x6A6,0x100,0x6A6,0x100,
+  0x6A6,0x100,0x6A6,0x100,0x684,0x100,0x684,0x100,
+  0x684,0x100,0x684,0x100,0x683,0x100,0x683,0x100,
+  0x683,0x100,0x683,0x100,0x686,0x100,0x686,0x100,
+  0x686,0x100,0x686,0x100,0x687,0x100,0x687,0x100,
+  0x687,0x100,0x687,0x100,0x68D,0x100,0x68D,0x100,
+  0x68C,0x100,0x68C,0x100,0x68E,0x100,0x68E,0x100,
+  0x688,0x100,0x688,0x100,0x698,0x100,0x698,0x100,
+  0x691,0x100,0x691,0x100,0x6A9,0x100,0x6A9,0x100,
+  0x6A9,0x100,0x6A9,0x100,0x6AF,0x100,0x6AF,0x100,
+  0x6AF,0x100,0x6AF,0x100,0x6B3,0x100,0x6B3,0x100,
+  0x6B3,0x100,0x6B3,0x100,0x6B1,0x100,0x6B1,0x100,
+  0x6B1,0x100,0x6B1,0x100,0x6BA,0x100,0x6BA,0x100,
+  0x6BB,0x100,0x6BB,0x100,0x6BB,0x100,0x6BB,0x200,
+  0x6D5,0x654,0x200,0x6D5,0x654,0x100,0x6C1,0x100,
+  0x6C1,0x100,0x6C1,0x100,0x6C1,0x100,0x6BE,0x100,
+  0x6BE,0x100,0x6BE,0x100,0x6BE,0x100,0x6D2,0x100,
+  0x6D2,0x200,0x6D2,0x654,0x200,0x6D2,0x654,0x100,
+  0x6AD,0x100,0x6AD,0x100,0x6AD,0x100,0x6AD,0x100,
+  0x6C7,0x100,0x6C7,0x100,0x6C6,0x100,0x6C6,0x100,
+  0x6C8,0x100,0x6C8,0x200,0x6C7,0x674,0x100,0x6CB,
+  0x100,0x6CB,0x100,0x6C5,0x100,0x6C5,0x100,0x6C9,
+  0x100,0x6C9,0x100,0x6D0,0x100,0x6D0,0x100,0x6D0,
+  0x100,0x6D0,0x100,0x649,0x100,0x649,0x300,0x64A,
+  0x654,0x627,0x300,0x64A,0x654,0x627,0x300,0x64A,
+  0x654,0x6D5,0x300,0x64A,0x654,0x6D5,0x300,0x64A,
+  0x654,0x648,0x300,0x64A,0x654,0x648,0x300,0x64A,
+  0x654,0x6C7,0x300,0x64A,0x654,0x6C7,0x300,0x64A,
+  0x654,0x6C6,0x300,0x64A,0x654,0x6C6,0x300,0x64A,
+  0x654,0x6C8,0x300,0x64A,0x654,0x6C8,0x300,0x64A,
+  0x654,0x6D0,0x300,0x64A,0x654,0x6D0,0x300,0x64A,
+  0x654,0x6D0,0x300,0x64A,0x654,0x649,0x300,0x64A,
+  0x654,0x649,0x300,0x64A,0x654,0x649,0x100,0x6CC,
+  0x100,0x6CC,0x100,0x6CC,0x100,0x6CC,0x300,0x64A,
+  0x654,0x62C,0x300,0x64A,0x654,0x62D,0x300,0x64A,
+  0x654,0x645,0x300,0x64A,0x654,0x649,0x300,0x64A,
+  0x654,0x64A,0x200,0x628,0x62C,0x200,0x628,0x62D,
+  0x200,0x628,0x62E,0x200,0x628,0x645,0x200,0x628,
+  0x649,0x200,0x628,0x64A,0x200,0x62A,0x62C,0x200,
+  0x62A,0x62D,0x200,0x62A,0x62E,0x200,0x62A,0x645,
+  0x200,0x62A,0x649,0x200,0x62A,0x64A,0x200,0x62B,
+  0x62C,0x200,0x62B,0x645,0x200,0x62B,0x649,0x200,
+  0x62B,0x64A,0x200,0x62C,0x62D,0x200,0x62C,0x645,
+  0x200,0x62D,0x62C,0x200,0x62D,0x645,0x200,0x62E,
+  0x62C,0x200,0x62E,0x62D,0x200,0x62E,0x645,0x200,
+  0x633,0x62C,0x200,0x633,0x62D,0x200,0x633,0x62E,
+  0x200,0x633,0x645,0x200,0x635,0x62D,0x200,0x635,
+  0x645,0x200,0x636,0x62C,0x200,0x636,0x62D,0x200,
+  0x636,0x62E,0x200,0x636,0x645,0x200,0x637,0x62D,
+  0x200,0x637,0x645,0x200,0x638,0x645,0x200,0x639,
+  0x62C,0x200,0x639,0x645,0x200,0x63A,0x62C,0x200,
+  0x63A,0x645,0x200,0x641,0x62C,0x200,0x641,0x62D,
+  0x200,0x641,0x62E,0x200,0x641,0x645,0x200,0x641,
+  0x649,0x200,0x641,0x64A,0x200,0x642,0x62D,0x200,
+  0x642,0x645,0x200,0x642,0x649,0x200,0x642,0x64A,
+  0x200,0x643,0x627,0x200,0x643,0x62C,0x200,0x643,
+  0x62D,0x200,0x643,0x62E,0x200,0x643,0x644,0x200,
+  0x643,0x645,0x200,0x643,0x649,0x200,0x643,0x64A,
+  0x200,0x644,0x62C,0x200,0x644,0x62D,0x200,0x644,
+  0x62E,0x200,0x644,0x645,0x200,0x644,0x649,0x200,
+  0x644,0x64A,0x200,0x645,0x62C,0x200,0x645,0x62D,
+  0x200,0x645,0x62E,0x200,0x645,0x645,0x200,0x645,
+  0x649,0x200,0x645,0x64A,0x200,0x646,0x62C,0x200,
+  0x646,0x62D,0x200,0x646,0x62E,0x200,0x646,0x645,
+  0x200,0x646,0x649,0x200,0x646,0x64A,0x200,0x647,
+  0x62C,0x200,0x647,0x645,0x200,0x647,0x649,0x200,
+  0x647,0x64A,0x200,0x64A,0x62C,0x200,0x64A,0x62D,
+  0x200,0x64A,0x62E,0x200,0x64A,0x645,0x200,0x64A,
+  0x649,0x200,0x64A,0x64A,0x200,0x630,0x670,0x200,
+  0x631,0x670,0x200,0x649,0x670,0x300,0x20,0x64C,
+  0x651,0x300,0x20,0x64D,0x651,0x300,0x20,0x64E,
+  0x651,0x300,0x20,0x64F,0x651,0x300,0x20,0x650,
+  0x651,0x300,0x20,0x651,0x670,0x300,0x64A,0x654,
+  0x631,0x300,0x64A,0x654,0x632,0x300,0x64A,0x654,
+  0x645,0x300,0x64A,0x654,0x646,0x300,0x64A,0x654,
+  0x649,0x300,0x64A,0x654,0x64A,0x200,0x628,0x631,
+  0x200,0x628,0x632,0x200,0x628,0x645,0x200,0x628,
+  0x646,0x200,0x628,0x649,0x200,0x628,0x64A,0x200,
+  0x62A,0x631,0x200,0x62A,0x632,0x200,0x62A,0x645,
+  0x200,0x62A,0x646,0x200,0x62A,0x649,0x200,0x62A,
+  0x64A,0x200,0x62B,0x631,0x200,0x62B,0x632,0x200,
+  0x62B,0x645,0x200,0x62B,0x646,0x200,0x62B,0x649,
+  0x200,0x62B,0x64A,0x200,0x641,0x649,0x200,0x641,
+  0x64A,0x200,0x642,0x649,0x200,0x642,0x64A,0x200,
+  0x643,0x627,0x200,0x643,0x644,0x200,0x643,0x645,
+  0x200,0x643,0x649,0x200,0x643,0x64A,0x200,0x644,
+  0x645,0x200,0x644,0x649,0x200,0x644,0x64A,0x200,
+  0x645,0x627,0x200,0x645,0x645,0x200,0x646,0x631,
+  0x200,0x646,0x632,0x200,0x646,0x645,0x200,0x646,
+  0x646,0x200,0x646,0x649,0x200,0x646,0x64A,0x200,
+  0x649,0x670,0x200,0x64A,0x631,0x200,0x64A,0x632,
+  0x200,0x64A,0x645,0x200,0x64A,0x646,0x200,0x64A,
+  0x649,0x200,0x64A,0x64A,0x300,0x64A,0x654,0x62C,
+  0x300,0x64A,0x654,0x62D,0x300,0x64A,0x654,0x62E,
+  0x300,0x64A,0x654,0x645,0x300,0x64A,0x654,0x647,
+  0x200,0x628,0x62C,0x200,0x628,0x62D,0x200,0x628,
+  0x62E,0x200,0x628,0x645,0x200,0x628,0x647,0x200,
+  0x62A,0x62C,0x200,0x62A,0x62D,0x200,0x62A,0x62E,
+  0x200,0x62A,0x645,0x200,0x62A,0x647,0x200,0x62B,
+  0x645,0x200,0x62C,0x62D,0x200,0x62C,0x645,0x200,
+  0x62D,0x62C,0x200,0x62D,0x645,0x200,0x62E,0x62C,
+  0x200,0x62E,0x645,0x200,0x633,0x62C,0x200,0x633,
+  0x62D,0x200,0x633,0x62E,0x200,0x633,0x645,0x200,
+  0x635,0x62D,0x200,0x635,0x62E,0x200,0x635,0x645,
+  0x200,0x636,0x62C,0x200,0x636,0x62D,0x200,0x636,
+  0x62E,0x200,0x636,0x645,0x200,0x637,0x62D,0x200,
+  0x638,0x645,0x200,0x639,0x62C,0x200,0x639,0x645,
+  0x200,0x63A,0x62C,0x200,0x63A,0x645,0x200,0x641,
+  0x62C,0x200,0x641,0x62D,0x200,0x641,0x62E,0x200,
+  0x641,0x645,0x200,0x642,0x62D,0x200,0x642,0x645,
+  0x200,0x643,0x62C,0x200,0x643,0x62D,0x200,0x643,
+  0x62E,0x200,0x643,0x644,0x200,0x643,0x645,0x200,
+  0x644,0x62C,0x200,0x644,0x62D,0x200,0x644,0x62E,
+  0x200,0x644,0x645,0x200,0x644,0x647,0x200,0x645,
+  0x62C,0x200,0x645,0x62D,0x200,0x645,0x62E,0x200,
+  0x645,0x645,0x200,0x646,0x62C,0x200,0x646,0x62D,
+  0x200,0x646,0x62E,0x200,0x646,0x645,0x200,0x646,
+  0x647,0x200,0x647,0x62C,0x200,0x647,0x645,0x200,
+  0x647,0x670,0x200,0x64A,0x62C,0x200,0x64A,0x62D,
+  0x200,0x64A,0x62E,0x200,0x64A,0x645,0x200,0x64A,
+  0x647,0x300,0x64A,0x654,0x645,0x300,0x64A,0x654,
+  0x647,0x200,0x628,0x645,0x200,0x628,0x647,0x200,
+  0x62A,0x645,0x200,0x62A,0x647,0x200,0x62B,0x645,
+  0x200,0x62B,0x647,0x200,0x633,0x645,0x200,0x633,
+  0x647,0x200,0x634,0x645,0x200,0x634,0x647,0x200,
+  0x643,0x644,0x200,0x643,0x645,0x200,0x644,0x645,
+  0x200,0x646,0x645,0x200,0x646,0x647,0x200,0x64A,
+  0x645,0x200,0x64A,0x647,0x300,0x640,0x64E,0x651,
+  0x300,0x640,0x64F,0x651,0x300,0x640,0x650,0x651,
+  0x200,0x637,0x649,0x200,0x637,0x64A,0x200,0x639,
+  0x649,0x200,0x639,0x64A,0x200,0x63A,0x649,0x200,
+  0x63A,0x64A,0x200,0x633,0x649,0x200,0x633,0x64A,
+  0x200,0x634,0x649,0x200,0x634,0x64A,0x200,0x62D,
+  0x649,0x200,0x62D,0x64A,0x200,0x62C,0x649,0x200,
+  0x62C,0x64A,0x200,0x62E,0x649,0x200,0x62E,0x64A,
+  0x200,0x635,0x649,0x200,0x635,0x64A,0x200,0x636,
+  0x649,0x200,0x636,0x64A,0x200,0x634,0x62C,0x200,
+  0x634,0x62D,0x200,0x634,0x62E,0x200,0x634,0x645,
+  0x200,0x634,0x631,0x200,0x633,0x631,0x200,0x635,
+  0x631,0x200,0x636,0x631,0x200,0x637,0x649,0x200,
+  0x637,0x64A,0x200,0x639,0x649,0x200,0x639,0x64A,
+  0x200,0x63A,0x649,0x200,0x63A,0x64A,0x200,0x633,
+  0x649,0x200,0x633,0x64A,0x200,0x634,0x649,0x200,
+  0x634,0x64A,0x200,0x62D,0x649,0x200,0x62D,0x64A,
+  0x200,0x62C,0x649,0x200,0x62C,0x64A,0x200,0x62E,
+  0x649,0x200,0x62E,0x64A,0x200,0x635,0x649,0x200,
+  0x635,0x64A,0x200,0x636,0x649,0x200,0x636,0x64A,
+  0x200,0x634,0x62C,0x200,0x634,0x62D,0x200,0x634,
+  0x62E,0x200,0x634,0x645,0x200,0x634,0x631,0x200,
+  0x633,0x631,0x200,0x635,0x631,0x200,0x636,0x631,
+  0x200,0x634,0x62C,0x200,0x634,0x62D,0x200,0x634,
+  0x62E,0x200,0x634,0x645,0x200,0x633,0x647,0x200,
+  0x634,0x647,0x200,0x637,0x645,0x200,0x633,0x62C,
+  0x200,0x633,0x62D,0x200,0x633,0x62E,0x200,0x634,
+  0x62C,0x200,0x634,0x62D,0x200,0x634,0x62E,0x200,
+  0x637,0x645,0x200,0x638,0x645,0x200,0x627,0x64B,
+  0x200,0x627,0x64B,0x300,0x62A,0x62C,0x645,0x300,
+  0x62A,0x62D,0x62C,0x300,0x62A,0x62D,0x62C,0x300,
+  0x62A,0x62D,0x645,0x300,0x62A,0x62E,0x645,0x300,
+  0x62A,0x645,0x62C,0x300,0x62A,0x645,0x62D,0x300,
+  0x62A,0x645,0x62E,0x300,0x62C,0x645,0x62D,0x300,
+  0x62C,0x645,0x62D,0x300,0x62D,0x645,0x64A,0x300,
+  0x62D,0x645,0x649,0x300,0x633,0x62D,0x62C,0x300,
+  0x633,0x62C,0x62D,0x300,0x633,0x62C,0x649,0x300,
+  0x633,0x645,0x62D,0x300,0x633,0x645,0x62D,0x300,
+  0x633,0x645,0x62C,0x300,0x633,0x645,0x645,0x300,
+  0x633,0x645,0x645,0x300,0x635,0x62D,0x62D,0x300,
+  0x635,0x62D,0x62D,0x300,0x635,0x645,0x645,0x300,
+  0x634,0x62D,0x645,0x300,0x634,0x62D,0x645,0x300,
+  0x634,0x62C,0x64A,0x300,0x634,0x645,0x62E,0x300,
+  0x634,0x645,0x62E,0x300,0x634,0x645,0x645,0x300,
+  0x634,0x645,0x645,0x300,0x636,0x62D,0x649,0x300,
+  0x636,0x62E,0x645,0x300,0x636,0x62E,0x645,0x300,
+  0x637,0x645,0x62D,0x300,0x637,0x645,0x62D,0x300,
+  0x637,0x645,0x645,0x300,0x637,0x645,0x64A,0x300,
+  0x639,0x62C,0x645,0x300,0x639,0x645,0x645,0x300,
+  0x639,0x645,0x645,0x300,0x639,0x645,0x649,0x300,
+  0x63A,0x645,0x645,0x300,0x63A,0x645,0x64A,0x300,
+  0x63A,0x645,0x649,0x300,0x641,0x62E,0x645,0x300,
+  0x641,0x62E,0x645,0x300,0x642,0x645,0x62D,0x300,
+  0x642,0x645,0x645,0x300,0x644,0x62D,0x645,0x300,
+  0x644,0x62D,0x64A,0x300,0x644,0x62D,0x649,0x300,
+  0x644,0x62C,0x62C,0x300,0x644,0x62C,0x62C,0x300,
+  0x644,0x62E,0x645,0x300,0x644,0x62E,0x645,0x300,
+  0x644,0x645,0x62D,0x300,0x644,0x645,0x62D,0x300,
+  0x645,0x62D,0x62C,0x300,0x645,0x62D,0x645,0x300,
+  0x645,0x62D,0x64A,0x300,0x645,0x62C,0x62D,0x300,
+  0x645,0x62C,0x645,0x300,0x645,0x62E,0x62C,0x300,
+  0x645,0x62E,0x645,0x300,0x645,0x62C,0x62E,0x300,
+  0x647,0x645,0x62C,0x300,0x647,0x645,0x645,0x300,
+  0x646,0x62D,0x645,0x300,0x646,0x62D,0x649,0x300,
+  0x646,0x62C,0x645,0x300,0x646,0x62C,0x645,0x300,
+  0x646,0x62C,0x649,0x300,0x646,0x645,0x64A,0x300,
+  0x646,0x645,0x649,0x300,0x64A,0x645,0x645,0x300,
+  0x64A,0x645,0x645,0x300,0x628,0x62E,0x64A,0x300,
+  0x62A,0x62C,0x64A,0x300,0x62A,0x62C,0x649,0x300,
+  0x62A,0x62E,0x64A,0x300,0x62A,0x62E,0x649,0x300,
+  0x62A,0x645,0x64A,0x300,0x62A,0x645,0x649,0x300,
+  0x62C,0x645,0x64A,0x300,0x62C,0x62D,0x649,0x300,
+  0x62C,0x645,0x649,0x300,0x633,0x62E,0x649,0x300,
+  0x635,0x62D,0x64A,0x300,0x634,0x62D,0x64A,0x300,
+  0x636,0x62D,0x64A,0x300,0x644,0x62C,0x64A,0x300,
+  0x644,0x645,0x64A,0x300,0x64A,0x62D,0x64A,0x300,
+  0x64A,0x62C,0x64A,0x300,0x64A,0x645,0x64A,0x300,
+  0x645,0x645,0x64A,0x300,0x642,0x645,0x64A,0x300,
+  0x646,0x62D,0x64A,0x300,0x642,0x645,0x62D,0x300,
+  0x644,0x62D,0x645,0x300,0x639,0x645,0x64A,0x300,
+  0x643,0x645,0x64A,0x300,0x646,0x62C,0x62D,0x300,
+  0x645,0x62E,0x64A,0x300,0x644,0x62C,0x645,0x300,
+  0x643,0x645,0x645,0x300,0x644,0x62C,0x645,0x300,
+  0x646,0x62C,0x62D,0x300,0x62C,0x62D,0x64A,0x300,
+  0x62D,0x62C,0x64A,0x300,0x645,0x62C,0x64A,0x300,
+  0x641,0x645,0x64A,0x300,0x628,0x62D,0x64A,0x300,
+  0x643,0x645,0x645,0x300,0x639,0x62C,0x645,0x300,
+  0x635,0x645,0x645,0x300,0x633,0x62E,0x64A,0x300,
+  0x646,0x62C,0x64A,0x300,0x635,0x644,0x6D2,0x300,
+  0x642,0x644,0x6D2,0x400,0x627,0x644,0x644,0x647,
+  0x400,0x627,0x643,0x628,0x631,0x400,0x645,0x62D,
+  0x645,0x62F,0x400,0x635,0x644,0x639,0x645,0x400,
+  0x631,0x633,0x648,0x644,0x400,0x639,0x644,0x64A,
+  0x647,0x400,0x648,0x633,0x644,0x645,0x300,0x635,
+  0x644,0x649,0x1200,0x635,0x644,0x649,0x20,0x627,
+  0x644,0x644,0x647,0x20,0x639,0x644,0x64A,0x647,
+  0x20,0x648,0x633,0x644,0x645,0x800,0x62C,0x644,
+  0x20,0x62C,0x644,0x627,0x644,0x647,0x400,0x631,
+  0x6CC,0x627,0x644,0x100,0x2C,0x100,0x3001,0x100,
+  0x3002,0x100,0x3A,0x100,0x3B,0x100,0x21,0x100,
+  0x3F,0x100,0x3016,0x100,0x3017,0x300,0x2E,0x2E,
+  0x2E,0x200,0x2E,0x2E,0x100,0x2014,0x100,0x2013,
+  0x100,0x5F,0x100,0x5F,0x100,0x28,0x100,0x29,
+  0x100,0x7B,0x100,0x7D,0x100,0x3014,0x100,0x3015,
+  0x100,0x3010,0x100,0x3011,0x100,0x300A,0x100,0x300B,
+  0x100,0x3008,0x100,0x3009,0x100,0x300C,0x100,0x300D,
+  0x100,0x300E,0x100,0x300F,0x100,0x5B,0x100,0x5D,
+  0x200,0x20,0x305,0x200,0x20,0x305,0x200,0x20,
+  0x305,0x200,0x20,0x305,0x100,0x5F,0x100,0x5F,
+  0x100,0x5F,0x100,0x2C,0x100,0x3001,0x100,0x2E,
+  0x100,0x3B,0x100,0x3A,0x100,0x3F,0x100,0x21,
+  0x100,0x2014,0x100,0x28,0x100,0x29,0x100,0x7B,
+  0x100,0x7D,0x100,0x3014,0x100,0x3015,0x100,0x23,
+  0x100,0x26,0x100,0x2A,0x100,0x2B,0x100,0x2D,
+  0x100,0x3C,0x100,0x3E,0x100,0x3D,0x100,0x5C,
+  0x100,0x24,0x100,0x25,0x100,0x40,0x200,0x20,
+  0x64B,0x200,0x640,0x64B,0x200,0x20,0x64C,0x200,
+  0x20,0x64D,0x200,0x20,0x64E,0x200,0x640,0x64E,
+  0x200,0x20,0x64F,0x200,0x640,0x64F,0x200,0x20,
+  0x650,0x200,0x640,0x650,0x200,0x20,0x651,0x200,
+  0x640,0x651,0x200,0x20,0x652,0x200,0x640,0x652,
+  0x100,0x621,0x200,0x627,0x653,0x200,0x627,0x653,
+  0x200,0x627,0x654,0x200,0x627,0x654,0x200,0x648,
+  0x654,0x200,0x648,0x654,0x200,0x627,0x655,0x200,
+  0x627,0x655,0x200,0x64A,0x654,0x200,0x64A,0x654,
+  0x200,0x64A,0x654,0x200,0x64A,0x654,0x100,0x627,
+  0x100,0x627,0x100,0x628,0x100,0x628,0x100,0x628,
+  0x100,0x628,0x100,0x629,0x100,0x629,0x100,0x62A,
+  0x100,0x62A,0x100,0x62A,0x100,0x62A,0x100,0x62B,
+  0x100,0x62B,0x100,0x62B,0x100,0x62B,0x100,0x62C,
+  0x100,0x62C,0x100,0x62C,0x100,0x62C,0x100,0x62D,
+  0x100,0x62D,0x100,0x62D,0x100,0x62D,0x100,0x62E,
+  0x100,0x62E,0x100,0x62E,0x100,0x62E,0x100,0x62F,
+  0x100,0x62F,0x100,0x630,0x100,0x630,0x100,0x631,
+  0x100,0x631,0x100,0x632,0x100,0x632,0x100,0x633,
+  0x100,0x633,0x100,0x633,0x100,0x633,0x100,0x634,
+  0x100,0x634,0x100,0x634,0x100,0x634,0x100,0x635,
+  0x100,0x635,0x100,0x635,0x100,0x635,0x100,0x636,
+  0x100,0x636,0x100,0x636,0x100,0x636,0x100,0x637,
+  0x100,0x637,0x100,0x637,0x100,0x637,0x100,0x638,
+  0x100,0x638,0x100,0x638,0x100,0x638,0x100,0x639,
+  0x100,0x639,0x100,0x639,0x100,0x639,0x100,0x63A,
+  0x100,0x63A,0x100,0x63A,0x100,0x63A,0x100,0x641,
+  0x100,0x641,0x100,0x641,0x100,0x641,0x100,0x642,
+  0x100,0x642,0x100,0x642,0x100,0x642,0x100,0x643,
+  0x100,0x643,0x100,0x643,0x100,0x643,0x100,0x644,
+  0x100,0x644,0x100,0x644,0x100,0x644,0x100,0x645,
+  0x100,0x645,0x100,0x645,0x100,0x645,0x100,0x646,
+  0x100,0x646,0x100,0x646,0x100,0x646,0x100,0x647,
+  0x100,0x647,0x100,0x647,0x100,0x647,0x100,0x648,
+  0x100,0x648,0x100,0x649,0x100,0x649,0x100,0x64A,
+  0x100,0x64A,0x100,0x64A,0x100,0x64A,0x300,0x644,
+  0x627,0x653,0x300,0x644,0x627,0x653,0x300,0x644,
+  0x627,0x654,0x300,0x644,0x627,0x654,0x300,0x644,
+  0x627,0x655,0x300,0x644,0x627,0x655,0x200,0x644,
+  0x627,0x200,0x644,0x627,0x100,0x21,0x100,0x22,
+  0x100,0x23,0x100,0x24,0x100,0x25,0x100,0x26,
+  0x100,0x27,0x100,0x28,0x100,0x29,0x100,0x2A,
+  0x100,0x2B,0x100,0x2C,0x100,0x2D,0x100,0x2E,
+  0x100,0x2F,0x100,0x30,0x100,0x31,0x100,0x32,
+  0x100,0x33,0x100,0x34,0x100,0x35,0x100,0x36,
+  0x100,0x37,0x100,0x38,0x100,0x39,0x100,0x3A,
+  0x100,0x3B,0x100,0x3C,0x100,0x3D,0x100,0x3E,
+  0x100,0x3F,0x100,0x40,0x100,0x41,0x100,0x42,
+  0x100,0x43,0x100,0x44,0x100,0x45,0x100,0x46,
+  0x100,0x47,0x100,0x48,0x100,0x49,0x100,0x4A,
+  0x100,0x4B,0x100,0x4C,0x100,0x4D,0x100,0x4E,
+  0x100,0x4F,0x100,0x50,0x100,0x51,0x100,0x52,
+  0x100,0x53,0x100,0x54,0x100,0x55,0x100,0x56,
+  0x100,0x57,0x100,0x58,0x100,0x59,0x100,0x5A,
+  0x100,0x5B,0x100,0x5C,0x100,0x5D,0x100,0x5E,
+  0x100,0x5F,0x100,0x60,0x100,0x61,0x100,0x62,
+  0x100,0x63,0x100,0x64,0x100,0x65,0x100,0x66,
+  0x100,0x67,0x100,0x68,0x100,0x69,0x100,0x6A,
+  0x100,0x6B,0x100,0x6C,0x100,0x6D,0x100,0x6E,
+  0x100,0x6F,0x100,0x70,0x100,0x71,0x100,0x72,
+  0x100,0x73,0x100,0x74,0x100,0x75,0x100,0x76,
+  0x100,0x77,0x100,0x78,0x100,0x79,0x100,0x7A,
+  0x100,0x7B,0x100,0x7C,0x100,0x7D,0x100,0x7E,
+  0x100,0x2985,0x100,0x2986,0x100,0x3002,0x100,0x300C,
+  0x100,0x300D,0x100,0x3001,0x100,0x30FB,0x100,0x30F2,
+  0x100,0x30A1,0x100,0x30A3,0x100,0x30A5,0x100,0x30A7,
+  0x100,0x30A9,0x100,0x30E3,0x100,0x30E5,0x100,0x30E7,
+  0x100,0x30C3,0x100,0x30FC,0x100,0x30A2,0x100,0x30A4,
+  0x100,0x30A6,0x100,0x30A8,0x100,0x30AA,0x100,0x30AB,
+  0x100,0x30AD,0x100,0x30AF,0x100,0x30B1,0x100,0x30B3,
+  0x100,0x30B5,0x100,0x30B7,0x100,0x30B9,0x100,0x30BB,
+  0x100,0x30BD,0x100,0x30BF,0x100,0x30C1,0x100,0x30C4,
+  0x100,0x30C6,0x100,0x30C8,0x100,0x30CA,0x100,0x30CB,
+  0x100,0x30CC,0x100,0x30CD,0x100,0x30CE,0x100,0x30CF,
+  0x100,0x30D2,0x100,0x30D5,0x100,0x30D8,0x100,0x30DB,
+  0x100,0x30DE,0x100,0x30DF,0x100,0x30E0,0x100,0x30E1,
+  0x100,0x30E2,0x100,0x30E4,0x100,0x30E6,0x100,0x30E8,
+  0x100,0x30E9,0x100,0x30EA,0x100,0x30EB,0x100,0x30EC,
+  0x100,0x30ED,0x100,0x30EF,0x100,0x30F3,0x100,0x3099,
+  0x100,0x309A,0x100,0x1160,0x100,0x1100,0x100,0x1101,
+  0x100,0x11AA,0x100,0x1102,0x100,0x11AC,0x100,0x11AD,
+  0x100,0x1103,0x100,0x1104,0x100,0x1105,0x100,0x11B0,
+  0x100,0x11B1,0x100,0x11B2,0x100,0x11B3,0x100,0x11B4,
+  0x100,0x11B5,0x100,0x111A,0x100,0x1106,0x100,0x1107,
+  0x100,0x1108,0x100,0x1121,0x100,0x1109,0x100,0x110A,
+  0x100,0x110B,0x100,0x110C,0x100,0x110D,0x100,0x110E,
+  0x100,0x110F,0x100,0x1110,0x100,0x1111,0x100,0x1112,
+  0x100,0x1161,0x100,0x1162,0x100,0x1163,0x100,0x1164,
+  0x100,0x1165,0x100,0x1166,0x100,0x1167,0x100,0x1168,
+  0x100,0x1169,0x100,0x116A,0x100,0x116B,0x100,0x116C,
+  0x100,0x116D,0x100,0x116E,0x100,0x116F,0x100,0x1170,
+  0x100,0x1171,0x100,0x1172,0x100,0x1173,0x100,0x1174,
+  0x100,0x1175,0x100,0xA2,0x100,0xA3,0x100,0xAC,
+  0x200,0x20,0x304,0x100,0xA6,0x100,0xA5,0x100,
+  0x20A9,0x100,0x2502,0x100,0x2190,0x100,0x2191,0x100,
+  0x2192,0x100,0x2193,0x100,0x25A0,0x100,0x25CB,0x100,
+  0x2D0,0x100,0x2D1,0x100,0xE6,0x100,0x299,0x100,
+  0x253,0x100,0x2A3,0x100,0xAB66,0x100,0x2A5,0x100,
+  0x2A4,0x100,0x256,0x100,0x257,0x100,0x1D91,0x100,
+  0x258,0x100,0x25E,0x100,0x2A9,0x100,0x264,0x100,
+  0x262,0x100,0x260,0x100,0x29B,0x100,0x127,0x100,
+  0x29C,0x100,0x267,0x100,0x284,0x100,0x2AA,0x100,
+  0x2AB,0x100,0x26C,0x100,0x1DF04,0x100,0xA78E,0x100,
+  0x26E,0x100,0x1DF05,0x100,0x28E,0x100,0x1DF06,0x100,
+  0xF8,0x100,0x276,0x100,0x277,0x100,0x71,0x100,
+  0x27A,0x100,0x1DF08,0x100,0x27D,0x100,0x27E,0x100,
+  0x280,0x100,0x2A8,0x100,0x2A6,0x100,0xAB67,0x100,
+  0x2A7,0x100,0x288,0x100,0x2C71,0x100,0x28F,0x100,
+  0x2A1,0x100,0x2A2,0x100,0x298,0x100,0x1C0,0x100,
+  0x1C1,0x100,0x1C2,0x100,0x1DF0A,0x100,0x1DF1E,0x202,
+  0x11099,0x110BA,0x202,0x1109B,0x110BA,0x202,0x110A5,0x110BA,
+  0x202,0x11131,0x11127,0x202,0x11132,0x11127,0x202,0x11347,
+  0x1133E,0x202,0x11347,0x11357,0x202,0x114B9,0x114BA,0x202,
+  0x114B9,0x114B0,0x202,0x114B9,0x114BD,0x202,0x115B8,0x115AF,
+  0x202,0x115B9,0x115AF,0x202,0x11935,0x11930,0x202,0x1D157,
+  0x1D165,0x202,0x1D158,0x1D165,0x303,0x1D158,0x1D165,0x1D16E,
+  0x303,0x1D158,0x1D165,0x1D16F,0x303,0x1D158,0x1D165,0x1D170,
+  0x303,0x1D158,0x1D165,0x1D171,0x303,0x1D158,0x1D165,0x1D172,
+  0x202,0x1D1B9,0x1D165,0x202,0x1D1BA,0x1D165,0x303,0x1D1B9,
+  0x1D165,0x1D16E,0x303,0x1D1BA,0x1D165,0x1D16E,0x303,0x1D1B9,
+  0x1D165,0x1D16F,0x303,0x1D1BA,0x1D165,0x1D16F,0x100,0x41,
+  0x100,0x42,0x100,0x43,0x100,0x44,0x100,0x45,
+  0x100,0x46,0x100,0x47,0x100,0x48,0x100,0x49,
+  0x100,0x4A,0x100,0x4B,0x100,0x4C,0x100,0x4D,
+  0x100,0x4E,0x100,0x4F,0x100,0x50,0x100,0x51,
+  0x100,0x52,0x100,0x53,0x100,0x54,0x100,0x55,
+  0x100,0x56,0x100,0x57,0x100,0x58,0x100,0x59,
+  0x100,0x5A,0x100,0x61,0x100,0x62,0x100,0x63,
+  0x100,0x64,0x100,0x65,0x100,0x66,0x100,0x67,
+  0x100,0x68,0x100,0x69,0x100,0x6A,0x100,0x6B,
+  0x100,0x6C,0x100,0x6D,0x100,0x6E,0x100,0x6F,
+  0x100,0x70,0x100,0x71,0x100,0x72,0x100,0x73,
+  0x100,0x74,0x100,0x75,0x100,0x76,0x100,0x77,
+  0x100,0x78,0x100,0x79,0x100,0x7A,0x100,0x41,
+  0x100,0x42,0x100,0x43,0x100,0x44,0x100,0x45,
+  0x100,0x46,0x100,0x47,0x100,0x48,0x100,0x49,
+  0x100,0x4A,0x100,0x4B,0x100,0x4C,0x100,0x4D,
+  0x100,0x4E,0x100,0x4F,0x100,0x50,0x100,0x51,
+  0x100,0x52,0x100,0x53,0x100,0x54,0x100,0x55,
+  0x100,0x56,0x100,0x57,0x100,0x58,0x100,0x59,
+  0x100,0x5A,0x100,0x61,0x100,0x62,0x100,0x63,
+  0x100,0x64,0x100,0x65,0x100,0x66,0x100,0x67,
+  0x100,0x69,0x100,0x6A,0x100,0x6B,0x100,0x6C,
+  0x100,0x6D,0x100,0x6E,0x100,0x6F,0x100,0x70,
+  0x100,0x71,0x100,0x72,0x100,0x73,0x100,0x74,
+  0x100,0x75,0x100,0x76,0x100,0x77,0x100,0x78,
+  0x100,0x79,0x100,0x7A,0x100,0x41,0x100,0x42,
+  0x100,0x43,0x100,0x44,0x100,0x45,0x100,0x46,
+  0x100,0x47,0x100,0x48,0x100,0x49,0x100,0x4A,
+  0x100,0x4B,0x100,0x4C,0x100,0x4D,0x100,0x4E,
+  0x100,0x4F,0x100,0x50,0x100,0x51,0x100,0x52,
+  0x100,0x53,0x100,0x54,0x100,0x55,0x100,0x56,
+  0x100,0x57,0x100,0x58,0x100,0x59,0x100,0x5A,
+  0x100,0x61,0x100,0x62,0x100,0x63,0x100,0x64,
+  0x100,0x65,0x100,0x66,0x100,0x67,0x100,0x68,
+  0x100,0x69,0x100,0x6A,0x100,0x6B,0x100,0x6C,
+  0x100,0x6D,0x100,0x6E,0x100,0x6F,0x100,0x70,
+  0x100,0x71,0x100,0x72,0x100,0x73,0x100,0x74,
+  0x100,0x75,0x100,0x76,0x100,0x77,0x100,0x78,
+  0x100,0x79,0x100,0x7A,0x100,0x41,0x100,0x43,
+  0x100,0x44,0x100,0x47,0x100,0x4A,0x100,0x4B,
+  0x100,0x4E,0x100,0x4F,0x100,0x50,0x100,0x51,
+  0x100,0x53,0x100,0x54,0x100,0x55,0x100,0x56,
+  0x100,0x57,0x100,0x58,0x100,0x59,0x100,0x5A,
+  0x100,0x61,0x100,0x62,0x100,0x63,0x100,0x64,
+  0x100,0x66,0x100,0x68,0x100,0x69,0x100,0x6A,
+  0x100,0x6B,0x100,0x6C,0x100,0x6D,0x100,0x6E,
+  0x100,0x70,0x100,0x71,0x100,0x72,0x100,0x73,
+  0x100,0x74,0x100,0x75,0x100,0x76,0x100,0x77,
+  0x100,0x78,0x100,0x79,0x100,0x7A,0x100,0x41,
+  0x100,0x42,0x100,0x43,0x100,0x44,0x100,0x45,
+  0x100,0x46,0x100,0x47,0x100,0x48,0x100,0x49,
+  0x100,0x4A,0x100,0x4B,0x100,0x4C,0x100,0x4D,
+  0x100,0x4E,0x100,0x4F,0x100,0x50,0x100,0x51,
+  0x100,0x52,0x100,0x53,0x100,0x54,0x100,0x55,
+  0x100,0x56,0x100,0x57,0x100,0x58,0x100,0x59,
+  0x100,0x5A,0x100,0x61,0x100,0x62,0x100,0x63,
+  0x100,0x64,0x100,0x65,0x100,0x66,0x100,0x67,
+  0x100,0x68,0x100,0x69,0x100,0x6A,0x100,0x6B,
+  0x100,0x6C,0x100,0x6D,0x100,0x6E,0x100,0x6F,
+  0x100,0x70,0x100,0x71,0x100,0x72,0x100,0x73,
+  0x100,0x74,0x100,0x75,0x100,0x76,0x100,0x77,
+  0x100,0x78,0x100,0x79,0x100,0x7A,0x100,0x41,
+  0x100,0x42,0x100,0x44,0x100,0x45,0x100,0x46,
+  0x100,0x47,0x100,0x4A,0x100,0x4B,0x100,0x4C,
+  0x100,0x4D,0x100,0x4E,0x100,0x4F,0x100,0x50,
+  0x100,0x51,0x100,0x53,0x100,0x54,0x100,0x55,
+  0x100,0x56,0x100,0x57,0x100,0x58,0x100,0x59,
+  0x100,0x61,0x100,0x62,0x100,0x63,0x100,0x64,
+  0x100,0x65,0x100,0x66,0x100,0x67,0x100,0x68,
+  0x100,0x69,0x100,0x6A,0x100,0x6B,0x100,0x6C,
+  0x100,0x6D,0x100,0x6E,0x100,0x6F,0x100,0x70,
+  0x100,0x71,0x100,0x72,0x100,0x73,0x100,0x74,
+  0x100,0x75,0x100,0x76,0x100,0x77,0x100,0x78,
+  0x100,0x79,0x100,0x7A,0x100,0x41,0x100,0x42,
+  0x100,0x44,0x100,0x45,0x100,0x46,0x100,0x47,
+  0x100,0x49,0x100,0x4A,0x100,0x4B,0x100,0x4C,
+  0x100,0x4D,0x100,0x4F,0x100,0x53,0x100,0x54,
+  0x100,0x55,0x100,0x56,0x100,0x57,0x100,0x58,
+  0x100,0x59,0x100,0x61,0x100,0x62,0x100,0x63,
+  0x100,0x64,0x100,0x65,0x100,0x66,0x100,0x67,
+  0x100,0x68,0x100,0x69,0x100,0x6A,0x100,0x6B,
+  0x100,0x6C,0x100,0x6D,0x100,0x6E,0x100,0x6F,
+  0x100,0x70,0x100,0x71,0x100,0x72,0x100,0x73,
+  0x100,0x74,0x100,0x75,0x100,0x76,0x100,0x77,
+  0x100,0x78,0x100,0x79,0x100,0x7A,0x100,0x41,
+  0x100,0x42,0x100,0x43,0x100,0x44,0x100,0x45,
+  0x100,0x46,0x100,0x47,0x100,0x48,0x100,0x49,
+  0x100,0x4A,0x100,0x4B,0x100,0x4C,0x100,0x4D,
+  0x100,0x4E,0x100,0x4F,0x100,0x50,0x100,0x51,
+  0x100,0x52,0x100,0x53,0x100,0x54,0x100,0x55,
+  0x100,0x56,0x100,0x57,0x100,0x58,0x100,0x59,
+  0x100,0x5A,0x100,0x61,0x100,0x62,0x100,0x63,
+  0x100,0x64,0x100,0x65,0x100,0x66,0x100,0x67,
+  0x100,0x68,0x100,0x69,0x100,0x6A,0x100,0x6B,
+  0x100,0x6C,0x100,0x6D,0x100,0x6E,0x100,0x6F,
+  0x100,0x70,0x100,0x71,0x100,0x72,0x100,0x73,
+  0x100,0x74,0x100,0x75,0x100,0x76,0x100,0x77,
+  0x100,0x78,0x100,0x79,0x100,0x7A,0x100,0x41,
+  0x100,0x42,0x100,0x43,0x100,0x44,0x100,0x45,
+  0x100,0x46,0x100,0x47,0x100,0x48,0x100,0x49,
+  0x100,0x4A,0x100,0x4B,0x100,0x4C,0x100,0x4D,
+  0x100,0x4E,0x100,0x4F,0x100,0x50,0x100,0x51,
+  0x100,0x52,0x100,0x53,0x100,0x54,0x100,0x55,
+  0x100,0x56,0x100,0x57,0x100,0x58,0x100,0x59,
+  0x100,0x5A,0x100,0x61,0x100,0x62,0x100,0x63,
+  0x100,0x64,0x100,0x65,0x100,0x66,0x100,0x67,
+  0x100,0x68,0x100,0x69,0x100,0x6A,0x100,0x6B,
+  0x100,0x6C,0x100,0x6D,0x100,0x6E,0x100,0x6F,
+  0x100,0x70,0x100,0x71,0x100,0x72,0x100,0x73,
+  0x100,0x74,0x100,0x75,0x100,0x76,0x100,0x77,
+  0x100,0x78,0x100,0x79,0x100,0x7A,0x100,0x41,
+  0x100,0x42,0x100,0x43,0x100,0x44,0x100,0x45,
+  0x100,0x46,0x100,0x47,0x100,0x48,0x100,0x49,
+  0x100,0x4A,0x100,0x4B,0x100,0x4C,0x100,0x4D,
+  0x100,0x4E,0x100,0x4F,0x100,0x50,0x100,0x51,
+  0x100,0x52,0x100,0x53,0x100,0x54,0x100,0x55,
+  0x100,0x56,0x100,0x57,0x100,0x58,0x100,0x59,
+  0x100,0x5A,0x100,0x61,0x100,0x62,0x100,0x63,
+  0x100,0x64,0x100,0x65,0x100,0x66,0x100,0x67,
+  0x100,0x68,0x100,0x69,0x100,0x6A,0x100,0x6B,
+  0x100,0x6C,0x100,0x6D,0x100,0x6E,0x100,0x6F,
+  0x100,0x70,0x100,0x71,0x100,0x72,0x100,0x73,
+  0x100,0x74,0x100,0x75,0x100,0x76,0x100,0x77,
+  0x100,0x78,0x100,0x79,0x100,0x7A,0x100,0x41,
+  0x100,0x42,0x100,0x43,0x100,0x44,0x100,0x45,
+  0x100,0x46,0x100,0x47,0x100,0x48,0x100,0x49,
+  0x100,0x4A,0x100,0x4B,0x100,0x4C,0x100,0x4D,
+  0x100,0x4E,0x100,0x4F,0x100,0x50,0x100,0x51,
+  0x100,0x52,0x100,0x53,0x100,0x54,0x100,0x55,
+  0x100,0x56,0x100,0x57,0x100,0x58,0x100,0x59,
+  0x100,0x5A,0x100,0x61,0x100,0x62,0x100,0x63,
+  0x100,0x64,0x100,0x65,0x100,0x66,0x100,0x67,
+  0x100,0x68,0x100,0x69,0x100,0x6A,0x100,0x6B,
+  0x100,0x6C,0x100,0x6D,0x100,0x6E,0x100,0x6F,
+  0x100,0x70,0x100,0x71,0x100,0x72,0x100,0x73,
+  0x100,0x74,0x100,0x75,0x100,0x76,0x100,0x77,
+  0x100,0x78,0x100,0x79,0x100,0x7A,0x100,0x41,
+  0x100,0x42,0x100,0x43,0x100,0x44,0x100,0x45,
+  0x100,0x46,0x100,0x47,0x100,0x48,0x100,0x49,
+  0x100,0x4A,0x100,0x4B,0x100,0x4C,0x100,0x4D,
+  0x100,0x4E,0x100,0x4F,0x100,0x50,0x100,0x51,
+  0x100,0x52,0x100,0x53,0x100,0x54,0x100,0x55,
+  0x100,0x56,0x100,0x57,0x100,0x58,0x100,0x59,
+  0x100,0x5A,0x100,0x61,0x100,0x62,0x100,0x63,
+  0x100,0x64,0x100,0x65,0x100,0x66,0x100,0x67,
+  0x100,0x68,0x100,0x69,0x100,0x6A,0x100,0x6B,
+  0x100,0x6C,0x100,0x6D,0x100,0x6E,0x100,0x6F,
+  0x100,0x70,0x100,0x71,0x100,0x72,0x100,0x73,
+  0x100,0x74,0x100,0x75,0x100,0x76,0x100,0x77,
+  0x100,0x78,0x100,0x79,0x100,0x7A,0x100,0x41,
+  0x100,0x42,0x100,0x43,0x100,0x44,0x100,0x45,
+  0x100,0x46,0x100,0x47,0x100,0x48,0x100,0x49,
+  0x100,0x4A,0x100,0x4B,0x100,0x4C,0x100,0x4D,
+  0x100,0x4E,0x100,0x4F,0x100,0x50,0x100,0x51,
+  0x100,0x52,0x100,0x53,0x100,0x54,0x100,0x55,
+  0x100,0x56,0x100,0x57,0x100,0x58,0x100,0x59,
+  0x100,0x5A,0x100,0x61,0x100,0x62,0x100,0x63,
+  0x100,0x64,0x100,0x65,0x100,0x66,0x100,0x67,
+  0x100,0x68,0x100,0x69,0x100,0x6A,0x100,0x6B,
+  0x100,0x6C,0x100,0x6D,0x100,0x6E,0x100,0x6F,
+  0x100,0x70,0x100,0x71,0x100,0x72,0x100,0x73,
+  0x100,0x74,0x100,0x75,0x100,0x76,0x100,0x77,
+  0x100,0x78,0x100,0x79,0x100,0x7A,0x100,0x131,
+  0x100,0x237,0x100,0x391,0x100,0x392,0x100,0x393,
+  0x100,0x394,0x100,0x395,0x100,0x396,0x100,0x397,
+  0x100,0x398,0x100,0x399,0x100,0x39A,0x100,0x39B,
+  0x100,0x39C,0x100,0x39D,0x100,0x39E,0x100,0x39F,
+  0x100,0x3A0,0x100,0x3A1,0x100,0x398,0x100,0x3A3,
+  0x100,0x3A4,0x100,0x3A5,0x100,0x3A6,0x100,0x3A7,
+  0x100,0x3A8,0x100,0x3A9,0x100,0x2207,0x100,0x3B1,
+  0x100,0x3B2,0x100,0x3B3,0x100,0x3B4,0x100,0x3B5,
+  0x100,0x3B6,0x100,0x3B7,0x100,0x3B8,0x100,0x3B9,
+  0x100,0x3BA,0x100,0x3BB,0x100,0x3BC,0x100,0x3BD,
+  0x100,0x3BE,0x100,0x3BF,0x100,0x3C0,0x100,0x3C1,
+  0x100,0x3C2,0x100,0x3C3,0x100,0x3C4,0x100,0x3C5,
+  0x100,0x3C6,0x100,0x3C7,0x100,0x3C8,0x100,0x3C9,
+  0x100,0x2202,0x100,0x3B5,0x100,0x3B8,0x100,0x3BA,
+  0x100,0x3C6,0x100,0x3C1,0x100,0x3C0,0x100,0x391,
+  0x100,0x392,0x100,0x393,0x100,0x394,0x100,0x395,
+  0x100,0x396,0x100,0x397,0x100,0x398,0x100,0x399,
+  0x100,0x39A,0x100,0x39B,0x100,0x39C,0x100,0x39D,
+  0x100,0x39E,0x100,0x39F,0x100,0x3A0,0x100,0x3A1,
+  0x100,0x398,0x100,0x3A3,0x100,0x3A4,0x100,0x3A5,
+  0x100,0x3A6,0x100,0x3A7,0x100,0x3A8,0x100,0x3A9,
+  0x100,0x2207,0x100,0x3B1,0x100,0x3B2,0x100,0x3B3,
+  0x100,0x3B4,0x100,0x3B5,0x100,0x3B6,0x100,0x3B7,
+  0x100,0x3B8,0x100,0x3B9,0x100,0x3BA,0x100,0x3BB,
+  0x100,0x3BC,0x100,0x3BD,0x100,0x3BE,0x100,0x3BF,
+  0x100,0x3C0,0x100,0x3C1,0x100,0x3C2,0x100,0x3C3,
+  0x100,0x3C4,0x100,0x3C5,0x100,0x3C6,0x100,0x3C7,
+  0x100,0x3C8,0x100,0x3C9,0x100,0x2202,0x100,0x3B5,
+  0x100,0x3B8,0x100,0x3BA,0x100,0x3C6,0x100,0x3C1,
+  0x100,0x3C0,0x100,0x391,0x100,0x392,0x100,0x393,
+  0x100,0x394,0x100,0x395,0x100,0x396,0x100,0x397,
+  0x100,0x398,0x100,0x399,0x100,0x39A,0x100,0x39B,
+  0x100,0x39C,0x100,0x39D,0x100,0x39E,0x100,0x39F,
+  0x100,0x3A0,0x100,0x3A1,0x100,0x398,0x100,0x3A3,
+  0x100,0x3A4,0x100,0x3A5,0x100,0x3A6,0x100,0x3A7,
+  0x100,0x3A8,0x100,0x3A9,0x100,0x2207,0x100,0x3B1,
+  0x100,0x3B2,0x100,0x3B3,0x100,0x3B4,0x100,0x3B5,
+  0x100,0x3B6,0x100,0x3B7,0x100,0x3B8,0x100,0x3B9,
+  0x100,0x3BA,0x100,0x3BB,0x100,0x3BC,0x100,0x3BD,
+  0x100,0x3BE,0x100,0x3BF,0x100,0x3C0,0x100,0x3C1,
+  0x100,0x3C2,0x100,0x3C3,0x100,0x3C4,0x100,0x3C5,
+  0x100,0x3C6,0x100,0x3C7,0x100,0x3C8,0x100,0x3C9,
+  0x100,0x2202,0x100,0x3B5,0x100,0x3B8,0x100,0x3BA,
+  0x100,0x3C6,0x100,0x3C1,0x100,0x3C0,0x100,0x391,
+  0x100,0x392,0x100,0x393,0x100,0x394,0x100,0x395,
+  0x100,0x396,0x100,0x397,0x100,0x398,0x100,0x399,
+  0x100,0x39A,0x100,0x39B,0x100,0x39C,0x100,0x39D,
+  0x100,0x39E,0x100,0x39F,0x100,0x3A0,0x100,0x3A1,
+  0x100,0x398,0x100,0x3A3,0x100,0x3A4,0x100,0x3A5,
+  0x100,0x3A6,0x100,0x3A7,0x100,0x3A8,0x100,0x3A9,
+  0x100,0x2207,0x100,0x3B1,0x100,0x3B2,0x100,0x3B3,
+  0x100,0x3B4,0x100,0x3B5,0x100,0x3B6,0x100,0x3B7,
+  0x100,0x3B8,0x100,0x3B9,0x100,0x3BA,0x100,0x3BB,
+  0x100,0x3BC,0x100,0x3BD,0x100,0x3BE,0x100,0x3BF,
+  0x100,0x3C0,0x100,0x3C1,0x100,0x3C2,0x100,0x3C3,
+  0x100,0x3C4,0x100,0x3C5,0x100,0x3C6,0x100,0x3C7,
+  0x100,0x3C8,0x100,0x3C9,0x100,0x2202,0x100,0x3B5,
+  0x100,0x3B8,0x100,0x3BA,0x100,0x3C6,0x100,0x3C1,
+  0x100,0x3C0,0x100,0x391,0x100,0x392,0x100,0x393,
+  0x100,0x394,0x100,0x395,0x100,0x396,0x100,0x397,
+  0x100,0x398,0x100,0x399,0x100,0x39A,0x100,0x39B,
+  0x100,0x39C,0x100,0x39D,0x100,0x39E,0x100,0x39F,
+  0x100,0x3A0,0x100,0x3A1,0x100,0x398,0x100,0x3A3,
+  0x100,0x3A4,0x100,0x3A5,0x100,0x3A6,0x100,0x3A7,
+  0x100,0x3A8,0x100,0x3A9,0x100,0x2207,0x100,0x3B1,
+  0x100,0x3B2,0x100,0x3B3,0x100,0x3B4,0x100,0x3B5,
+  0x100,0x3B6,0x100,0x3B7,0x100,0x3B8,0x100,0x3B9,
+  0x100,0x3BA,0x100,0x3BB,0x100,0x3BC,0x100,0x3BD,
+  0x100,0x3BE,0x100,0x3BF,0x100,0x3C0,0x100,0x3C1,
+  0x100,0x3C2,0x100,0x3C3,0x100,0x3C4,0x100,0x3C5,
+  0x100,0x3C6,0x100,0x3C7,0x100,0x3C8,0x100,0x3C9,
+  0x100,0x2202,0x100,0x3B5,0x100,0x3B8,0x100,0x3BA,
+  0x100,0x3C6,0x100,0x3C1,0x100,0x3C0,0x100,0x3DC,
+  0x100,0x3DD,0x100,0x30,0x100,0x31,0x100,0x32,
+  0x100,0x33,0x100,0x34,0x100,0x35,0x100,0x36,
+  0x100,0x37,0x100,0x38,0x100,0x39,0x100,0x30,
+  0x100,0x31,0x100,0x32,0x100,0x33,0x100,0x34,
+  0x100,0x35,0x100,0x36,0x100,0x37,0x100,0x38,
+  0x100,0x39,0x100,0x30,0x100,0x31,0x100,0x32,
+  0x100,0x33,0x100,0x34,0x100,0x35,0x100,0x36,
+  0x100,0x37,0x100,0x38,0x100,0x39,0x100,0x30,
+  0x100,0x31,0x100,0x32,0x100,0x33,0x100,0x34,
+  0x100,0x35,0x100,0x36,0x100,0x37,0x100,0x38,
+  0x100,0x39,0x100,0x30,0x100,0x31,0x100,0x32,
+  0x100,0x33,0x100,0x34,0x100,0x35,0x100,0x36,
+  0x100,0x37,0x100,0x38,0x100,0x39,0x100,0x627,
+  0x100,0x628,0x100,0x62C,0x100,0x62F,0x100,0x648,
+  0x100,0x632,0x100,0x62D,0x100,0x637,0x100,0x64A,
+  0x100,0x643,0x100,0x644,0x100,0x645,0x100,0x646,
+  0x100,0x633,0x100,0x639,0x100,0x641,0x100,0x635,
+  0x100,0x642,0x100,0x631,0x100,0x634,0x100,0x62A,
+  0x100,0x62B,0x100,0x62E,0x100,0x630,0x100,0x636,
+  0x100,0x638,0x100,0x63A,0x100,0x66E,0x100,0x6BA,
+  0x100,0x6A1,0x100,0x66F,0x100,0x628,0x100,0x62C,
+  0x100,0x647,0x100,0x62D,0x100,0x64A,0x100,0x643,
+  0x100,0x644,0x100,0x645,0x100,0x646,0x100,0x633,
+  0x100,0x639,0x100,0x641,0x100,0x635,0x100,0x642,
+  0x100,0x634,0x100,0x62A,0x100,0x62B,0x100,0x62E,
+  0x100,0x636,0x100,0x63A,0x100,0x62C,0x100,0x62D,
+  0x100,0x64A,0x100,0x644,0x100,0x646,0x100,0x633,
+  0x100,0x639,0x100,0x635,0x100,0x642,0x100,0x634,
+  0x100,0x62E,0x100,0x636,0x100,0x63A,0x100,0x6BA,
+  0x100,0x66F,0x100,0x628,0x100,0x62C,0x100,0x647,
+  0x100,0x62D,0x100,0x637,0x100,0x64A,0x100,0x643,
+  0x100,0x645,0x100,0x646,0x100,0x633,0x100,0x639,
+  0x100,0x641,0x100,0x635,0x100,0x642,0x100,0x634,
+  0x100,0x62A,0x100,0x62B,0x100,0x62E,0x100,0x636,
+  0x100,0x638,0x100,0x63A,0x100,0x66E,0x100,0x6A1,
+  0x100,0x627,0x100,0x628,0x100,0x62C,0x100,0x62F,
+  0x100,0x647,0x100,0x648,0x100,0x632,0x100,0x62D,
+  0x100,0x637,0x100,0x64A,0x100,0x644,0x100,0x645,
+  0x100,0x646,0x100,0x633,0x100,0x639,0x100,0x641,
+  0x100,0x635,0x100,0x642,0x100,0x631,0x100,0x634,
+  0x100,0x62A,0x100,0x62B,0x100,0x62E,0x100,0x630,
+  0x100,0x636,0x100,0x638,0x100,0x63A,0x100,0x628,
+  0x100,0x62C,0x100,0x62F,0x100,0x648,0x100,0x632,
+  0x100,0x62D,0x100,0x637,0x100,0x64A,0x100,0x644,
+  0x100,0x645,0x100,0x646,0x100,0x633,0x100,0x639,
+  0x100,0x641,0x100,0x635,0x100,0x642,0x100,0x631,
+  0x100,0x634,0x100,0x62A,0x100,0x62B,0x100,0x62E,
+  0x100,0x630,0x100,0x636,0x100,0x638,0x100,0x63A,
+  0x200,0x30,0x2E,0x200,0x30,0x2C,0x200,0x31,
+  0x2C,0x200,0x32,0x2C,0x200,0x33,0x2C,0x200,
+  0x34,0x2C,0x200,0x35,0x2C,0x200,0x36,0x2C,
+  0x200,0x37,0x2C,0x200,0x38,0x2C,0x200,0x39,
+  0x2C,0x300,0x28,0x41,0x29,0x300,0x28,0x42,
+  0x29,0x300,0x28,0x43,0x29,0x300,0x28,0x44,
+  0x29,0x300,0x28,0x45,0x29,0x300,0x28,0x46,
+  0x29,0x300,0x28,0x47,0x29,0x300,0x28,0x48,
+  0x29,0x300,0x28,0x49,0x29,0x300,0x28,0x4A,
+  0x29,0x300,0x28,0x4B,0x29,0x300,0x28,0x4C,
+  0x29,0x300,0x28,0x4D,0x29,0x300,0x28,0x4E,
+  0x29,0x300,0x28,0x4F,0x29,0x300,0x28,0x50,
+  0x29,0x300,0x28,0x51,0x29,0x300,0x28,0x52,
+  0x29,0x300,0x28,0x53,0x29,0x300,0x28,0x54,
+  0x29,0x300,0x28,0x55,0x29,0x300,0x28,0x56,
+  0x29,0x300,0x28,0x57,0x29,0x300,0x28,0x58,
+  0x29,0x300,0x28,0x59,0x29,0x300,0x28,0x5A,
+  0x29,0x300,0x3014,0x53,0x3015,0x100,0x43,0x100,
+  0x52,0x200,0x43,0x44,0x200,0x57,0x5A,0x100,
+  0x41,0x100,0x42,0x100,0x43,0x100,0x44,0x100,
+  0x45,0x100,0x46,0x100,0x47,0x100,0x48,0x100,
+  0x49,0x100,0x4A,0x100,0x4B,0x100,0x4C,0x100,
+  0x4D,0x100,0x4E,0x100,0x4F,0x100,0x50,0x100,
+  0x51,0x100,0x52,0x100,0x53,0x100,0x54,0x100,
+  0x55,0x100,0x56,0x100,0x57,0x100,0x58,0x100,
+  0x59,0x100,0x5A,0x200,0x48,0x56,0x200,0x4D,
+  0x56,0x200,0x53,0x44,0x200,0x53,0x53,0x300,
+  0x50,0x50,0x56,0x200,0x57,0x43,0x200,0x4D,
+  0x43,0x200,0x4D,0x44,0x200,0x4D,0x52,0x200,
+  0x44,0x4A,0x200,0x307B,0x304B,0x200,0x30B3,0x30B3,
+  0x100,0x30B5,0x100,0x624B,0x100,0x5B57,0x100,0x53CC,
+  0x200,0x30C6,0x3099,0x100,0x4E8C,0x100,0x591A,0x100,
+  0x89E3,0x100,0x5929,0x100,0x4EA4,0x100,0x6620,0x100,
+  0x7121,0x100,0x6599,0x100,0x524D,0x100,0x5F8C,0x100,
+  0x518D,0x100,0x65B0,0x100,0x521D,0x100,0x7D42,0x100,
+  0x751F,0x100,0x8CA9,0x100,0x58F0,0x100,0x5439,0x100,
+  0x6F14,0x100,0x6295,0x100,0x6355,0x100,0x4E00,0x100,
+  0x4E09,0x100,0x904A,0x100,0x5DE6,0x100,0x4E2D,0x100,
+  0x53F3,0x100,0x6307,0x100,0x8D70,0x100,0x6253,0x100,
+  0x7981,0x100,0x7A7A,0x100,0x5408,0x100,0x6E80,0x100,
+  0x6709,0x100,0x6708,0x100,0x7533,0x100,0x5272,0x100,
+  0x55B6,0x100,0x914D,0x300,0x3014,0x672C,0x3015,0x300,
+  0x3014,0x4E09,0x3015,0x300,0x3014,0x4E8C,0x3015,0x300,
+  0x3014,0x5B89,0x3015,0x300,0x3014,0x70B9,0x3015,0x300,
+  0x3014,0x6253,0x3015,0x300,0x3014,0x76D7,0x3015,0x300,
+  0x3014,0x52DD,0x3015,0x300,0x3014,0x6557,0x3015,0x100,
+  0x5F97,0x100,0x53EF,0x100,0x30,0x100,0x31,0x100,
+  0x32,0x100,0x33,0x100,0x34,0x100,0x35,0x100,
+  0x36,0x100,0x37,0x100,0x38,0x100,0x39,0x101,
+  0x4E3D,0x101,0x4E38,0x101,0x4E41,0x101,0x20122,0x101,
+  0x4F60,0x101,0x4FAE,0x101,0x4FBB,0x101,0x5002,0x101,
+  0x507A,0x101,0x5099,0x101,0x50E7,0x101,0x50CF,0x101,
+  0x349E,0x101,0x2063A,0x101,0x514D,0x101,0x5154,0x101,
+  0x5164,0x101,0x5177,0x101,0x2051C,0x101,0x34B9,0x101,
+  0x5167,0x101,0x518D,0x101,0x2054B,0x101,0x5197,0x101,
+  0x51A4,0x101,0x4ECC,0x101,0x51AC,0x101,0x51B5,0x101,
+  0x291DF,0x101,0x51F5,0x101,0x5203,0x101,0x34DF,0x101,
+  0x523B,0x101,0x5246,0x101,0x5272,0x101,0x5277,0x101,
+  0x3515,0x101,0x52C7,0x101,0x52C9,0x101,0x52E4,0x101,
+  0x52FA,0x101,0x5305,0x101,0x5306,0x101,0x5317,0x101,
+  0x5349,0x101,0x5351,0x101,0x535A,0x101,0x5373,0x101,
+  0x537D,0x101,0x537F,0x101,0x537F,0x101,0x537F,0x101,
+  0x20A2C,0x101,0x7070,0x101,0x53CA,0x101,0x53DF,0x101,
+  0x20B63,0x101,0x53EB,0x101,0x53F1,0x101,0x5406,0x101,
+  0x549E,0x101,0x5438,0x101,0x5448,0x101,0x5468,0x101,
+  0x54A2,0x101,0x54F6,0x101,0x5510,0x101,0x5553,0x101,
+  0x5563,0x101,0x5584,0x101,0x5584,0x101,0x5599,0x101,
+  0x55AB,0x101,0x55B3,0x101,0x55C2,0x101,0x5716,0x101,
+  0x5606,0x101,0x5717,0x101,0x5651,0x101,0x5674,0x101,
+  0x5207,0x101,0x58EE,0x101,0x57CE,0x101,0x57F4,0x101,
+  0x580D,0x101,0x578B,0x101,0x5832,0x101,0x5831,0x101,
+  0x58AC,0x101,0x214E4,0x101,0x58F2,0x101,0x58F7,0x101,
+  0x5906,0x101,0x591A,0x101,0x5922,0x101,0x5962,0x101,
+  0x216A8,0x101,0x216EA,0x101,0x59EC,0x101,0x5A1B,0x101,
+  0x5A27,0x101,0x59D8,0x101,0x5A66,0x101,0x36EE,0x101,
+  0x36FC,0x101,0x5B08,0x101,0x5B3E,0x101,0x5B3E,0x101,
+  0x219C8,0x101,0x5BC3,0x101,0x5BD8,0x101,0x5BE7,0x101,
+  0x5BF3,0x101,0x21B18,0x101,0x5BFF,0x101,0x5C06,0x101,
+  0x5F53,0x101,0x5C22,0x101,0x3781,0x101,0x5C60,0x101,
+  0x5C6E,0x101,0x5CC0,0x101,0x5C8D,0x101,0x21DE4,0x101,
+  0x5D43,0x101,0x21DE6,0x101,0x5D6E,0x101,0x5D6B,0x101,
+  0x5D7C,0x101,0x5DE1,0x101,0x5DE2,0x101,0x382F,0x101,
+  0x5DFD,0x101,0x5E28,0x101,0x5E3D,0x101,0x5E69,0x101,
+  0x3862,0x101,0x22183,0x101,0x387C,0x101,0x5EB0,0x101,
+  0x5EB3,0x101,0x5EB6,0x101,0x5ECA,0x101,0x2A392,0x101,
+  0x5EFE,0x101,0x22331,0x101,0x22331,0x101,0x8201,0x101,
+  0x5F22,0x101,0x5F22,0x101,0x38C7,0x101,0x232B8,0x101,
+  0x261DA,0x101,0x5F62,0x101,0x5F6B,0x101,0x38E3,0x101,
+  0x5F9A,0x101,0x5FCD,0x101,0x5FD7,0x101,0x5FF9,0x101,
+  0x6081,0x101,0x393A,0x101,0x391C,0x101,0x6094,0x101,
+  0x226D4,0x101,0x60C7,0x101,0x6148,0x101,0x614C,0x101,
+  0x614E,0x101,0x614C,0x101,0x617A,0x101,0x618E,0x101,
+  0x61B2,0x101,0x61A4,0x101,0x61AF,0x101,0x61DE,0x101,
+  0x61F2,0x101,0x61F6,0x101,0x6210,0x101,0x621B,0x101,
+  0x625D,0x101,0x62B1,0x101,0x62D4,0x101,0x6350,0x101,
+  0x22B0C,0x101,0x633D,0x101,0x62FC,0x101,0x6368,0x101,
+  0x6383,0x101,0x63E4,0x101,0x22BF1,0x101,0x6422,0x101,
+  0x63C5,0x101,0x63A9,0x101,0x3A2E,0x101,0x6469,0x101,
+  0x647E,0x101,0x649D,0x101,0x6477,0x101,0x3A6C,0x101,
+  0x654F,0x101,0x656C,0x101,0x2300A,0x101,0x65E3,0x101,
+  0x66F8,0x101,0x6649,0x101,0x3B19,0x101,0x6691,0x101,
+  0x3B08,0x101,0x3AE4,0x101,0x5192,0x101,0x5195,0x101,
+  0x6700,0x101,0x669C,0x101,0x80AD,0x101,0x43D9,0x101,
+  0x6717,0x101,0x671B,0x101,0x6721,0x101,0x675E,0x101,
+  0x6753,0x101,0x233C3,0x101,0x3B49,0x101,0x67FA,0x101,
+  0x6785,0x101,0x6852,0x101,0x6885,0x101,0x2346D,0x101,
+  0x688E,0x101,0x681F,0x101,0x6914,0x101,0x3B9D,0x101,
+  0x6942,0x101,0x69A3,0x101,0x69EA,0x101,0x6AA8,0x101,
+  0x236A3,0x101,0x6ADB,0x101,0x3C18,0x101,0x6B21,0x101,
+  0x238A7,0x101,0x6B54,0x101,0x3C4E,0x101,0x6B72,0x101,
+  0x6B9F,0x101,0x6BBA,0x101,0x6BBB,0x101,0x23A8D,0x101,
+  0x21D0B,0x101,0x23AFA,0x101,0x6C4E,0x101,0x23CBC,0x101,
+  0x6CBF,0x101,0x6CCD,0x101,0x6C67,0x101,0x6D16,0x101,
+  0x6D3E,0x101,0x6D77,0x101,0x6D41,0x101,0x6D69,0x101,
+  0x6D78,0x101,0x6D85,0x101,0x23D1E,0x101,0x6D34,0x101,
+  0x6E2F,0x101,0x6E6E,0x101,0x3D33,0x101,0x6ECB,0x101,
+  0x6EC7,0x101,0x23ED1,0x101,0x6DF9,0x101,0x6F6E,0x101,
+  0x23F5E,0x101,0x23F8E,0x101,0x6FC6,0x101,0x7039,0x101,
+  0x701E,0x101,0x701B,0x101,0x3D96,0x101,0x704A,0x101,
+  0x707D,0x101,0x7077,0x101,0x70AD,0x101,0x20525,0x101,
+  0x7145,0x101,0x24263,0x101,0x719C,0x101,0x243AB,0x101,
+  0x7228,0x101,0x7235,0x101,0x7250,0x101,0x24608,0x101,
+  0x7280,0x101,0x7295,0x101,0x24735,0x101,0x24814,0x101,
+  0x737A,0x101,0x738B,0x101,0x3EAC,0x101,0x73A5,0x101,
+  0x3EB8,0x101,0x3EB8,0x101,0x7447,0x101,0x745C,0x101,
+  0x7471,0x101,0x7485,0x101,0x74CA,0x101,0x3F1B,0x101,
+  0x7524,0x101,0x24C36,0x101,0x753E,0x101,0x24C92,0x101,
+  0x7570,0x101,0x2219F,0x101,0x7610,0x101,0x24FA1,0x101,
+  0x24FB8,0x101,0x25044,0x101,0x3FFC,0x101,0x4008,0x101,
+  0x76F4,0x101,0x250F3,0x101,0x250F2,0x101,0x25119,0x101,
+  0x25133,0x101,0x771E,0x101,0x771F,0x101,0x771F,0x101,
+  0x774A,0x101,0x4039,0x101,0x778B,0x101,0x4046,0x101,
+  0x4096,0x101,0x2541D,0x101,0x784E,0x101,0x788C,0x101,
+  0x78CC,0x101,0x40E3,0x101,0x25626,0x101,0x7956,0x101,
+  0x2569A,0x101,0x256C5,0x101,0x798F,0x101,0x79EB,0x101,
+  0x412F,0x101,0x7A40,0x101,0x7A4A,0x101,0x7A4F,0x101,
+  0x2597C,0x101,0x25AA7,0x101,0x25AA7,0x101,0x7AEE,0x101,
+  0x4202,0x101,0x25BAB,0x101,0x7BC6,0x101,0x7BC9,0x101,
+  0x4227,0x101,0x25C80,0x101,0x7CD2,0x101,0x42A0,0x101,
+  0x7CE8,0x101,0x7CE3,0x101,0x7D00,0x101,0x25F86,0x101,
+  0x7D63,0x101,0x4301,0x101,0x7DC7,0x101,0x7E02,0x101,
+  0x7E45,0x101,0x4334,0x101,0x26228,0x101,0x26247,0x101,
+  0x4359,0x101,0x262D9,0x101,0x7F7A,0x101,0x2633E,0x101,
+  0x7F95,0x101,0x7FFA,0x101,0x8005,0x101,0x264DA,0x101,
+  0x26523,0x101,0x8060,0x101,0x265A8,0x101,0x8070,0x101,
+  0x2335F,0x101,0x43D5,0x101,0x80B2,0x101,0x8103,0x101,
+  0x440B,0x101,0x813E,0x101,0x5AB5,0x101,0x267A7,0x101,
+  0x267B5,0x101,0x23393,0x101,0x2339C,0x101,0x8201,0x101,
+  0x8204,0x101,0x8F9E,0x101,0x446B,0x101,0x8291,0x101,
+  0x828B,0x101,0x829D,0x101,0x52B3,0x101,0x82B1,0x101,
+  0x82B3,0x101,0x82BD,0x101,0x82E6,0x101,0x26B3C,0x101,
+  0x82E5,0x101,0x831D,0x101,0x8363,0x101,0x83AD,0x101,
+  0x8323,0x101,0x83BD,0x101,0x83E7,0x101,0x8457,0x101,
+  0x8353,0x101,0x83CA,0x101,0x83CC,0x101,0x83DC,0x101,
+  0x26C36,0x101,0x26D6B,0x101,0x26CD5,0x101,0x452B,0x101,
+  0x84F1,0x101,0x84F3,0x101,0x8516,0x101,0x273CA,0x101,
+  0x8564,0x101,0x26F2C,0x101,0x455D,0x101,0x4561,0x101,
+  0x26FB1,0x101,0x270D2,0x101,0x456B,0x101,0x8650,0x101,
+  0x865C,0x101,0x8667,0x101,0x8669,0x101,0x86A9,0x101,
+  0x8688,0x101,0x870E,0x101,0x86E2,0x101,0x8779,0x101,
+  0x8728,0x101,0x876B,0x101,0x8786,0x101,0x45D7,0x101,
+  0x87E1,0x101,0x8801,0x101,0x45F9,0x101,0x8860,0x101,
+  0x8863,0x101,0x27667,0x101,0x88D7,0x101,0x88DE,0x101,
+  0x4635,0x101,0x88FA,0x101,0x34BB,0x101,0x278AE,0x101,
+  0x27966,0x101,0x46BE,0x101,0x46C7,0x101,0x8AA0,0x101,
+  0x8AED,0x101,0x8B8A,0x101,0x8C55,0x101,0x27CA8,0x101,
+  0x8CAB,0x101,0x8CC1,0x101,0x8D1B,0x101,0x8D77,0x101,
+  0x27F2F,0x101,0x20804,0x101,0x8DCB,0x101,0x8DBC,0x101,
+  0x8DF0,0x101,0x208DE,0x101,0x8ED4,0x101,0x8F38,0x101,
+  0x285D2,0x101,0x285ED,0x101,0x9094,0x101,0x90F1,0x101,
+  0x9111,0x101,0x2872E,0x101,0x911B,0x101,0x9238,0x101,
+  0x92D7,0x101,0x92D8,0x101,0x927C,0x101,0x93F9,0x101,
+  0x9415,0x101,0x28BFA,0x101,0x958B,0x101,0x4995,0x101,
+  0x95B7,0x101,0x28D77,0x101,0x49E6,0x101,0x96C3,0x101,
+  0x5DB2,0x101,0x9723,0x101,0x29145,0x101,0x2921A,0x101,
+  0x4A6E,0x101,0x4A76,0x101,0x97E0,0x101,0x2940A,0x101,
+  0x4AB2,0x101,0x29496,0x101,0x980B,0x101,0x980B,0x101,
+  0x9829,0x101,0x295B6,0x101,0x98E2,0x101,0x4B33,0x101,
+  0x9929,0x101,0x99A7,0x101,0x99C2,0x101,0x99FE,0x101,
+  0x4BCE,0x101,0x29B30,0x101,0x9B12,0x101,0x9C40,0x101,
+  0x9CFD,0x101,0x4CCE,0x101,0x4CED,0x101,0x9D67,0x101,
+  0x2A0CE,0x101,0x4CF8,0x101,0x2A105,0x101,0x2A20E,0x101,
+  0x2A291,0x101,0x9EBB,0x101,0x4D56,0x101,0x9EF9,0x101,
+  0x9EFE,0x101,0x9F05,0x101,0x9F0F,0x101,0x9F16,0x101,
+  0x9F3B,0x101,0x2A600,
+};
+
+static const u64 normCompositionKeys[941] = {
+  0x7800338ull,0x7A00338ull,0x7C00338ull,0x8200300ull,0x8200301ull,0x8200302ull,
+  0x8200303ull,0x8200304ull,0x8200306ull,0x8200307ull,0x8200308ull,0x8200309ull,
+  0x820030Aull,0x820030Cull,0x820030Full,0x8200311ull,0x8200323ull,0x8200325ull,
+  0x8200328ull,0x8400307ull,0x8400323ull,0x8400331ull,0x8600301ull,0x8600302ull,
+  0x8600307ull,0x860030Cull,0x8600327ull,0x8800307ull,0x880030Cull,0x8800323ull,
+  0x8800327ull,0x880032Dull,0x8800331ull,0x8A00300ull,0x8A00301ull,0x8A00302ull,
+  0x8A00303ull,0x8A00304ull,0x8A00306ull,0x8A00307ull,0x8A00308ull,0x8A00309ull,
+  0x8A0030Cull,0x8A0030Full,0x8A00311ull,0x8A00323ull,0x8A00327ull,0x8A00328ull,
+  0x8A0032Dull,0x8A00330ull,0x8C00307ull,0x8E00301ull,0x8E00302ull,0x8E00304ull,
+  0x8E00306ull,0x8E00307ull,0x8E0030Cull,0x8E00327ull,0x9000302ull,0x9000307ull,
+  0x9000308ull,0x900030Cull,0x9000323ull,0x9000327ull,0x900032Eull,0x9200300ull,
+  0x9200301ull,0x9200302ull,0x9200303ull,0x9200304ull,0x9200306ull,0x9200307ull,
+  0x9200308ull,0x9200309ull,0x920030Cull,0x920030Full,0x9200311ull,0x9200323ull,
+  0x9200328ull,0x9200330ull,0x9400302ull,0x9600301ull,0x960030Cull,0x9600323ull,
+  0x9600327ull,0x9600331ull,0x9800301ull,0x980030Cull,0x9800323ull,0x9800327ull,
+  0x980032Dull,0x9800331ull,0x9A00301ull,0x9A00307ull,0x9A00323ull,0x9C00300ull,
+  0x9C00301ull,0x9C00303ull,0x9C00307ull,0x9C0030Cull,0x9C00323ull,0x9C00327ull,
+  0x9C0032Dull,0x9C00331ull,0x9E00300ull,0x9E00301ull,0x9E00302ull,0x9E00303ull,
+  0x9E00304ull,0x9E00306ull,0x9E00307ull,0x9E00308ull,0x9E00309ull,0x9E0030Bull,
+  0x9E0030Cull,0x9E0030Full,0x9E00311ull,0x9E0031Bull,0x9E00323ull,0x9E00328ull,
+  0xA000301ull,0xA000307ull,0xA400301ull,0xA400307ull,0xA40030Cull,0xA40030Full,
+  0xA400311ull,0xA400323ull,0xA400327ull,0xA400331ull,0xA600301ull,0xA600302ull,
+  0xA600307ull,0xA60030Cull,0xA600323ull,0xA600326ull,0xA600327ull,0xA800307ull,
+  0xA80030Cull,0xA800323ull,0xA800326ull,0xA800327ull,0xA80032Dull,0xA800331ull,
+  0xAA00300ull,0xAA00301ull,0xAA00302ull,0xAA00303ull,0xAA00304ull,0xAA00306ull,
+  0xAA00308ull,0xAA00309ull,0xAA0030Aull,0xAA0030Bull,0xAA0030Cull,0xAA0030Full,
+  0xAA00311ull,0xAA0031Bull,0xAA00323ull,0xAA00324ull,0xAA00328ull,0xAA0032Dull,
+  0xAA00330ull,0xAC00303ull,0xAC00323ull,0xAE00300ull,0xAE00301ull,0xAE00302ull,
+  0xAE00307ull,0xAE00308ull,0xAE00323ull,0xB000307ull,0xB000308ull,0xB200300ull,
+  0xB200301ull,0xB200302ull,0xB200303ull,0xB200304ull,0xB200307ull,0xB200308ull,
+  0xB200309ull,0xB200323ull,0xB400301ull,0xB400302ull,0xB400307ull,0xB40030Cull,
+  0xB400323ull,0xB400331ull,0xC200300ull,0xC200301ull,0xC200302ull,0xC200303ull,
+  0xC200304ull,0xC200306ull,0xC200307ull,0xC200308ull,0xC200309ull,0xC20030Aull,
+  0xC20030Cull,0xC20030Full,0xC200311ull,0xC200323ull,0xC200325ull,0xC200328ull,
+  0xC400307ull,0xC400323ull,0xC400331ull,0xC600301ull,0xC600302ull,0xC600307ull,
+  0xC60030Cull,0xC600327ull,0xC800307ull,0xC80030Cull,0xC800323ull,0xC800327ull,
+  0xC80032Dull,0xC800331ull,0xCA00300ull,0xCA00301ull,0xCA00302ull,0xCA00303ull,
+  0xCA00304ull,0xCA00306ull,0xCA00307ull,0xCA00308ull,0xCA00309ull,0xCA0030Cull,
+  0xCA0030Full,0xCA00311ull,0xCA00323ull,0xCA00327ull,0xCA00328ull,0xCA0032Dull,
+  0xCA00330ull,0xCC00307ull,0xCE00301ull,0xCE00302ull,0xCE00304ull,0xCE00306ull,
+  0xCE00307ull,0xCE0030Cull,0xCE00327ull,0xD000302ull,0xD000307ull,0xD000308ull,
+  0xD00030Cull,0xD000323ull,0xD000327ull,0xD00032Eull,0xD000331ull,0xD200300ull,
+  0xD200301ull,0xD200302ull,0xD200303ull,0xD200304ull,0xD200306ull,0xD200308ull,
+  0xD200309ull,0xD20030Cull,0xD20030Full,0xD200311ull,0xD200323ull,0xD200328ull,
+  0xD200330ull,0xD400302ull,0xD40030Cull,0xD600301ull,0xD60030Cull,0xD600323ull,
+  0xD600327ull,0xD600331ull,0xD800301ull,0xD80030Cull,0xD800323ull,0xD800327ull,
+  0xD80032Dull,0xD800331ull,0xDA00301ull,0xDA00307ull,0xDA00323ull,0xDC00300ull,
+  0xDC00301ull,0xDC00303ull,0xDC00307ull,0xDC0030Cull,0xDC00323ull,0xDC00327ull,
+  0xDC0032Dull,0xDC00331ull,0xDE00300ull,0xDE00301ull,0xDE00302ull,0xDE00303ull,
+  0xDE00304ull,0xDE00306ull,0xDE00307ull,0xDE00308ull,0xDE00309ull,0xDE0030Bull,
+  0xDE0030Cull,0xDE0030Full,0xDE00311ull,0xDE0031Bull,0xDE00323ull,0xDE00328ull,
+  0xE000301ull,0xE000307ull,0xE400301ull,0xE400307ull,0xE40030Cull,0xE40030Full,
+  0xE400311ull,0xE400323ull,0xE400327ull,0xE400331ull,0xE600301ull,0xE600302ull,
+  0xE600307ull,0xE60030Cull,0xE600323ull,0xE600326ull,0xE600327ull,0xE800307ull,
+  0xE800308ull,0xE80030Cull,0xE800323ull,0xE800326ull,0xE800327ull,0xE80032Dull,
+  0xE800331ull,0xEA00300ull,0xEA00301ull,0xEA00302ull,0xEA00303ull,0xEA00304ull,
+  0xEA00306ull,0xEA00308ull,0xEA00309ull,0xEA0030Aull,0xEA0030Bull,0xEA0030Cull,
+  0xEA0030Full,0xEA00311ull,0xEA0031Bull,0xEA00323ull,0xEA00324ull,0xEA00328ull,
+  0xEA0032Dull,0xEA00330ull,0xEC00303ull,0xEC00323ull,0xEE00300ull,0xEE00301ull,
+  0xEE00302ull,0xEE00307ull,0xEE00308ull,0xEE0030Aull,0xEE00323ull,0xF000307ull,
+  0xF000308ull,0xF200300ull,0xF200301ull,0xF200302ull,0xF200303ull,0xF200304ull,
+  0xF200307ull,0xF200308ull,0xF200309ull,0xF20030Aull,0xF200323ull,0xF400301ull,
+  0xF400302ull,0xF400307ull,0xF40030Cull,0xF400323ull,0xF400331ull,0x15000300ull,
+  0x15000301ull,0x15000342ull,0x18400300ull,0x18400301ull,0x18400303ull,0x18400309ull,
+  0x18800304ull,0x18A00301ull,0x18C00301ull,0x18C00304ull,0x18E00301ull,0x19400300ull,
+  0x19400301ull,0x19400303ull,0x19400309ull,0x19E00301ull,0x1A800300ull,0x1A800301ull,
+  0x1A800303ull,0x1A800309ull,0x1AA00301ull,0x1AA00304ull,0x1AA00308ull,0x1AC00304ull,
+  0x1B000301ull,0x1B800300ull,0x1B800301ull,0x1B800304ull,0x1B80030Cull,0x1C400300ull,
+  0x1C400301ull,0x1C400303ull,0x1C400309ull,0x1C800304ull,0x1CA00301ull,0x1CC00301ull,
+  0x1CC00304ull,0x1CE00301ull,0x1D400300ull,0x1D400301ull,0x1D400303ull,0x1D400309ull,
+  0x1DE00301ull,0x1E800300ull,0x1E800301ull,0x1E800303ull,0x1E800309ull,0x1EA00301ull,
+  0x1EA00304ull,0x1EA00308ull,0x1EC00304ull,0x1F000301ull,0x1F800300ull,0x1F800301ull,
+  0x1F800304ull,0x1F80030Cull,0x20400300ull,0x20400301ull,0x20400303ull,0x20400309ull,
+  0x20600300ull,0x20600301ull,0x20600303ull,0x20600309ull,0x22400300ull,0x22400301ull,
+  0x22600300ull,0x22600301ull,0x29800300ull,0x29800301ull,0x29A00300ull,0x29A00301ull,
+  0x2B400307ull,0x2B600307ull,0x2C000307ull,0x2C200307ull,0x2D000301ull,0x2D200301ull,
+  0x2D400308ull,0x2D600308ull,0x2FE00307ull,0x34000300ull,0x34000301ull,0x34000303ull,
+  0x34000309ull,0x34000323ull,0x34200300ull,0x34200301ull,0x34200303ull,0x34200309ull,
+  0x34200323ull,0x35E00300ull,0x35E00301ull,0x35E00303ull,0x35E00309ull,0x35E00323ull,
+  0x36000300ull,0x36000301ull,0x36000303ull,0x36000309ull,0x36000323ull,0x36E0030Cull,
+  0x3D400304ull,0x3D600304ull,0x44C00304ull,0x44E00304ull,0x45000306ull,0x45200306ull,
+  0x45C00304ull,0x45E00304ull,0x5240030Cull,0x72200300ull,0x72200301ull,0x72200304ull,
+  0x72200306ull,0x72200313ull,0x72200314ull,0x72200345ull,0x72A00300ull,0x72A00301ull,
+  0x72A00313ull,0x72A00314ull,0x72E00300ull,0x72E00301ull,0x72E00313ull,0x72E00314ull,
+  0x72E00345ull,0x73200300ull,0x73200301ull,0x73200304ull,0x73200306ull,0x73200308ull,
+  0x73200313ull,0x73200314ull,0x73E00300ull,0x73E00301ull,0x73E00313ull,0x73E00314ull,
+  0x74200314ull,0x74A00300ull,0x74A00301ull,0x74A00304ull,0x74A00306ull,0x74A00308ull,
+  0x74A00314ull,0x75200300ull,0x75200301ull,0x75200313ull,0x75200314ull,0x75200345ull,
+  0x75800345ull,0x75C00345ull,0x76200300ull,0x76200301ull,0x76200304ull,0x76200306ull,
+  0x76200313ull,0x76200314ull,0x76200342ull,0x76200345ull,0x76A00300ull,0x76A00301ull,
+  0x76A00313ull,0x76A00314ull,0x76E00300ull,0x76E00301ull,0x76E00313ull,0x76E00314ull,
+  0x76E00342ull,0x76E00345ull,0x77200300ull,0x77200301ull,0x77200304ull,0x77200306ull,
+  0x77200308ull,0x77200313ull,0x77200314ull,0x77200342ull,0x77E00300ull,0x77E00301ull,
+  0x77E00313ull,0x77E00314ull,0x78200313ull,0x78200314ull,0x78A00300ull,0x78A00301ull,
+  0x78A00304ull,0x78A00306ull,0x78A00308ull,0x78A00313ull,0x78A00314ull,0x78A00342ull,
+  0x79200300ull,0x79200301ull,0x79200313ull,0x79200314ull,0x79200342ull,0x79200345ull,
+  0x79400300ull,0x79400301ull,0x79400342ull,0x79600300ull,0x79600301ull,0x79600342ull,
+  0x79C00345ull,0x7A400301ull,0x7A400308ull,0x80C00308ull,0x82000306ull,0x82000308ull,
+  0x82600301ull,0x82A00300ull,0x82A00306ull,0x82A00308ull,0x82C00306ull,0x82C00308ull,
+  0x82E00308ull,0x83000300ull,0x83000304ull,0x83000306ull,0x83000308ull,0x83400301ull,
+  0x83C00308ull,0x84600304ull,0x84600306ull,0x84600308ull,0x8460030Bull,0x84E00308ull,
+  0x85600308ull,0x85A00308ull,0x86000306ull,0x86000308ull,0x86600301ull,0x86A00300ull,
+  0x86A00306ull,0x86A00308ull,0x86C00306ull,0x86C00308ull,0x86E00308ull,0x87000300ull,
+  0x87000304ull,0x87000306ull,0x87000308ull,0x87400301ull,0x87C00308ull,0x88600304ull,
+  0x88600306ull,0x88600308ull,0x8860030Bull,0x88E00308ull,0x89600308ull,0x89A00308ull,
+  0x8AC00308ull,0x8E80030Full,0x8EA0030Full,0x9B000308ull,0x9B200308ull,0x9D000308ull,
+  0x9D200308ull,0xC4E00653ull,0xC4E00654ull,0xC4E00655ull,0xC9000654ull,0xC9400654ull,
+  0xD8200654ull,0xDA400654ull,0xDAA00654ull,0x12500093Cull,0x12600093Cull,0x12660093Cull,
+  0x138E009BEull,0x138E009D7ull,0x168E00B3Eull,0x168E00B56ull,0x168E00B57ull,0x172400BD7ull,
+  0x178C00BBEull,0x178C00BD7ull,0x178E00BBEull,0x188C00C56ull,0x197E00CD5ull,0x198C00CC2ull,
+  0x198C00CD5ull,0x198C00CD6ull,0x199400CD5ull,0x1A8C00D3Eull,0x1A8C00D57ull,0x1A8E00D3Eull,
+  0x1BB200DCAull,0x1BB200DCFull,0x1BB200DDFull,0x1BB800DCAull,0x204A0102Eull,0x360A01B35ull,
+  0x360E01B35ull,0x361201B35ull,0x361601B35ull,0x361A01B35ull,0x362201B35ull,0x367401B35ull,
+  0x367801B35ull,0x367C01B35ull,0x367E01B35ull,0x368401B35ull,0x3C6C00304ull,0x3C6E00304ull,
+  0x3CB400304ull,0x3CB600304ull,0x3CC400307ull,0x3CC600307ull,0x3D4000302ull,0x3D4000306ull,
+  0x3D4200302ull,0x3D4200306ull,0x3D7000302ull,0x3D7200302ull,0x3D9800302ull,0x3D9A00302ull,
+  0x3E0000300ull,0x3E0000301ull,0x3E0000342ull,0x3E0000345ull,0x3E0200300ull,0x3E0200301ull,
+  0x3E0200342ull,0x3E0200345ull,0x3E0400345ull,0x3E0600345ull,0x3E0800345ull,0x3E0A00345ull,
+  0x3E0C00345ull,0x3E0E00345ull,0x3E1000300ull,0x3E1000301ull,0x3E1000342ull,0x3E1000345ull,
+  0x3E1200300ull,0x3E1200301ull,0x3E1200342ull,0x3E1200345ull,0x3E1400345ull,0x3E1600345ull,
+  0x3E1800345ull,0x3E1A00345ull,0x3E1C00345ull,0x3E1E00345ull,0x3E2000300ull,0x3E2000301ull,
+  0x3E2200300ull,0x3E2200301ull,0x3E3000300ull,0x3E3000301ull,0x3E3200300ull,0x3E3200301ull,
+  0x3E4000300ull,0x3E4000301ull,0x3E4000342ull,0x3E4000345ull,0x3E4200300ull,0x3E4200301ull,
+  0x3E4200342ull,0x3E4200345ull,0x3E4400345ull,0x3E4600345ull,0x3E4800345ull,0x3E4A00345ull,
+  0x3E4C00345ull,0x3E4E00345ull,0x3E5000300ull,0x3E5000301ull,0x3E5000342ull,0x3E5000345ull,
+  0x3E5200300ull,0x3E5200301ull,0x3E5200342ull,0x3E5200345ull,0x3E5400345ull,0x3E5600345ull,
+  0x3E5800345ull,0x3E5A00345ull,0x3E5C00345ull,0x3E5E00345ull,0x3E6000300ull,0x3E6000301ull,
+  0x3E6000342ull,0x3E6200300ull,0x3E6200301ull,0x3E6200342ull,0x3E7000300ull,0x3E7000301ull,
+  0x3E7000342ull,0x3E7200300ull,0x3E7200301ull,0x3E7200342ull,0x3E8000300ull,0x3E8000301ull,
+  0x3E8200300ull,0x3E8200301ull,0x3E9000300ull,0x3E9000301ull,0x3E9200300ull,0x3E9200301ull,
+  0x3EA000300ull,0x3EA000301ull,0x3EA000342ull,0x3EA200300ull,0x3EA200301ull,0x3EA200342ull,
+  0x3EB200300ull,0x3EB200301ull,0x3EB200342ull,0x3EC000300ull,0x3EC000301ull,0x3EC000342ull,
+  0x3EC000345ull,0x3EC200300ull,0x3EC200301ull,0x3EC200342ull,0x3EC200345ull,0x3EC400345ull,
+  0x3EC600345ull,0x3EC800345ull,0x3ECA00345ull,0x3ECC00345ull,0x3ECE00345ull,0x3ED000300ull,
+  0x3ED000301ull,0x3ED000342ull,0x3ED000345ull,0x3ED200300ull,0x3ED200301ull,0x3ED200342ull,
+  0x3ED200345ull,0x3ED400345ull,0x3ED600345ull,0x3ED800345ull,0x3EDA00345ull,0x3EDC00345ull,
+  0x3EDE00345ull,0x3EE000345ull,0x3EE800345ull,0x3EF800345ull,0x3F6C00345ull,0x3F7E00300ull,
+  0x3F7E00301ull,0x3F7E00342ull,0x3F8C00345ull,0x3FEC00345ull,0x3FFC00300ull,0x3FFC00301ull,
+  0x3FFC00342ull,0x432000338ull,0x432400338ull,0x432800338ull,0x43A000338ull,0x43A400338ull,
+  0x43A800338ull,0x440600338ull,0x441000338ull,0x441600338ull,0x444600338ull,0x444A00338ull,
+  0x447800338ull,0x448600338ull,0x448A00338ull,0x449000338ull,0x449A00338ull,0x44C200338ull,
+  0x44C800338ull,0x44CA00338ull,0x44E400338ull,0x44E600338ull,0x44EC00338ull,0x44EE00338ull,
+  0x44F400338ull,0x44F600338ull,0x44F800338ull,0x44FA00338ull,0x450400338ull,0x450600338ull,
+  0x450C00338ull,0x450E00338ull,0x452200338ull,0x452400338ull,0x454400338ull,0x455000338ull,
+  0x455200338ull,0x455600338ull,0x456400338ull,0x456600338ull,0x456800338ull,0x456A00338ull,
+  0x608C03099ull,0x609603099ull,0x609A03099ull,0x609E03099ull,0x60A203099ull,0x60A603099ull,
+  0x60AA03099ull,0x60AE03099ull,0x60B203099ull,0x60B603099ull,0x60BA03099ull,0x60BE03099ull,
+  0x60C203099ull,0x60C803099ull,0x60CC03099ull,0x60D003099ull,0x60DE03099ull,0x60DE0309Aull,
+  0x60E403099ull,0x60E40309Aull,0x60EA03099ull,0x60EA0309Aull,0x60F003099ull,0x60F00309Aull,
+  0x60F603099ull,0x60F60309Aull,0x613A03099ull,0x614C03099ull,0x615603099ull,0x615A03099ull,
+  0x615E03099ull,0x616203099ull,0x616603099ull,0x616A03099ull,0x616E03099ull,0x617203099ull,
+  0x617603099ull,0x617A03099ull,0x617E03099ull,0x618203099ull,0x618803099ull,0x618C03099ull,
+  0x619003099ull,0x619E03099ull,0x619E0309Aull,0x61A403099ull,0x61A40309Aull,0x61AA03099ull,
+  0x61AA0309Aull,0x61B003099ull,0x61B00309Aull,0x61B603099ull,0x61B60309Aull,0x61DE03099ull,
+  0x61E003099ull,0x61E203099ull,0x61E403099ull,0x61FA03099ull,0x22132110BAull,0x22136110BAull,
+  0x2214A110BAull,0x2226211127ull,0x2226411127ull,0x2268E1133Eull,0x2268E11357ull,0x22972114B0ull,
+  0x22972114BAull,0x22972114BDull,0x22B70115AFull,0x22B72115AFull,0x2326A11930ull,
+};
+
+static const u32 normCompositionValues[941] = {
+  0x226E,0x2260,0x226F,0xC0,0xC1,0xC2,0xC3,0x100,0x102,0x226,0xC4,0x1EA2,
+  0xC5,0x1CD,0x200,0x202,0x1EA0,0x1E00,0x104,0x1E02,0x1E04,0x1E06,0x106,0x108,
+  0x10A,0x10C,0xC7,0x1E0A,0x10E,0x1E0C,0x1E10,0x1E12,0x1E0E,0xC8,0xC9,0xCA,
+  0x1EBC,0x112,0x114,0x116,0xCB,0x1EBA,0x11A,0x204,0x206,0x1EB8,0x228,0x118,
+  0x1E18,0x1E1A,0x1E1E,0x1F4,0x11C,0x1E20,0x11E,0x120,0x1E6,0x122,0x124,0x1E22,
+  0x1E26,0x21E,0x1E24,0x1E28,0x1E2A,0xCC,0xCD,0xCE,0x128,0x12A,0x12C,0x130,
+  0xCF,0x1EC8,0x1CF,0x208,0x20A,0x1ECA,0x12E,0x1E2C,0x134,0x1E30,0x1E8,0x1E32,
+  0x136,0x1E34,0x139,0x13D,0x1E36,0x13B,0x1E3C,0x1E3A,0x1E3E,0x1E40,0x1E42,0x1F8,
+  0x143,0xD1,0x1E44,0x147,0x1E46,0x145,0x1E4A,0x1E48,0xD2,0xD3,0xD4,0xD5,
+  0x14C,0x14E,0x22E,0xD6,0x1ECE,0x150,0x1D1,0x20C,0x20E,0x1A0,0x1ECC,0x1EA,
+  0x1E54,0x1E56,0x154,0x1E58,0x158,0x210,0x212,0x1E5A,0x156,0x1E5E,0x15A,0x15C,
+  0x1E60,0x160,0x1E62,0x218,0x15E,0x1E6A,0x164,0x1E6C,0x21A,0x162,0x1E70,0x1E6E,
+  0xD9,0xDA,0xDB,0x168,0x16A,0x16C,0xDC,0x1EE6,0x16E,0x170,0x1D3,0x214,
+  0x216,0x1AF,0x1EE4,0x1E72,0x172,0x1E76,0x1E74,0x1E7C,0x1E7E,0x1E80,0x1E82,0x174,
+  0x1E86,0x1E84,0x1E88,0x1E8A,0x1E8C,0x1EF2,0xDD,0x176,0x1EF8,0x232,0x1E8E,0x178,
+  0x1EF6,0x1EF4,0x179,0x1E90,0x17B,0x17D,0x1E92,0x1E94,0xE0,0xE1,0xE2,0xE3,
+  0x101,0x103,0x227,0xE4,0x1EA3,0xE5,0x1CE,0x201,0x203,0x1EA1,0x1E01,0x105,
+  0x1E03,0x1E05,0x1E07,0x107,0x109,0x10B,0x10D,0xE7,0x1E0B,0x10F,0x1E0D,0x1E11,
+  0x1E13,0x1E0F,0xE8,0xE9,0xEA,0x1EBD,0x113,0x115,0x117,0xEB,0x1EBB,0x11B,
+  0x205,0x207,0x1EB9,0x229,0x119,0x1E19,0x1E1B,0x1E1F,0x1F5,0x11D,0x1E21,0x11F,
+  0x121,0x1E7,0x123,0x125,0x1E23,0x1E27,0x21F,0x1E25,0x1E29,0x1E2B,0x1E96,0xEC,
+  0xED,0xEE,0x129,0x12B,0x12D,0xEF,0x1EC9,0x1D0,0x209,0x20B,0x1ECB,0x12F,
+  0x1E2D,0x135,0x1F0,0x1E31,0x1E9,0x1E33,0x137,0x1E35,0x13A,0x13E,0x1E37,0x13C,
+  0x1E3D,0x1E3B,0x1E3F,0x1E41,0x1E43,0x1F9,0x144,0xF1,0x1E45,0x148,0x1E47,0x146,
+  0x1E4B,0x1E49,0xF2,0xF3,0xF4,0xF5,0x14D,0x14F,0x22F,0xF6,0x1ECF,0x151,
+  0x1D2,0x20D,0x20F,0x1A1,0x1ECD,0x1EB,0x1E55,0x1E57,0x155,0x1E59,0x159,0x211,
+  0x213,0x1E5B,0x157,0x1E5F,0x15B,0x15D,0x1E61,0x161,0x1E63,0x219,0x15F,0x1E6B,
+  0x1E97,0x165,0x1E6D,0x21B,0x163,0x1E71,0x1E6F,0xF9,0xFA,0xFB,0x169,0x16B,
+  0x16D,0xFC,0x1EE7,0x16F,0x171,0x1D4,0x215,0x217,0x1B0,0x1EE5,0x1E73,0x173,
+  0x1E77,0x1E75,0x1E7D,0x1E7F,0x1E81,0x1E83,0x175,0x1E87,0x1E85,0x1E98,0x1E89,0x1E8B,
+  0x1E8D,0x1EF3,0xFD,0x177,0x1EF9,0x233,0x1E8F,0xFF,0x1EF7,0x1E99,0x1EF5,0x17A,
+  0x1E91,0x17C,0x17E,0x1E93,0x1E95,0x1FED,0x385,0x1FC1,0x1EA6,0x1EA4,0x1EAA,0x1EA8,
+  0x1DE,0x1FA,0x1FC,0x1E2,0x1E08,0x1EC0,0x1EBE,0x1EC4,0x1EC2,0x1E2E,0x1ED2,0x1ED0,
+  0x1ED6,0x1ED4,0x1E4C,0x22C,0x1E4E,0x22A,0x1FE,0x1DB,0x1D7,0x1D5,0x1D9,0x1EA7,
+  0x1EA5,0x1EAB,0x1EA9,0x1DF,0x1FB,0x1FD,0x1E3,0x1E09,0x1EC1,0x1EBF,0x1EC5,0x1EC3,
+  0x1E2F,0x1ED3,0x1ED1,0x1ED7,0x1ED5,0x1E4D,0x22D,0x1E4F,0x22B,0x1FF,0x1DC,0x1D8,
+  0x1D6,0x1DA,0x1EB0,0x1EAE,0x1EB4,0x1EB2,0x1EB1,0x1EAF,0x1EB5,0x1EB3,0x1E14,0x1E16,
+  0x1E15,0x1E17,0x1E50,0x1E52,0x1E51,0x1E53,0x1E64,0x1E65,0x1E66,0x1E67,0x1E78,0x1E79,
+  0x1E7A,0x1E7B,0x1E9B,0x1EDC,0x1EDA,0x1EE0,0x1EDE,0x1EE2,0x1EDD,0x1EDB,0x1EE1,0x1EDF,
+  0x1EE3,0x1EEA,0x1EE8,0x1EEE,0x1EEC,0x1EF0,0x1EEB,0x1EE9,0x1EEF,0x1EED,0x1EF1,0x1EE,
+  0x1EC,0x1ED,0x1E0,0x1E1,0x1E1C,0x1E1D,0x230,0x231,0x1EF,0x1FBA,0x386,0x1FB9,
+  0x1FB8,0x1F08,0x1F09,0x1FBC,0x1FC8,0x388,0x1F18,0x1F19,0x1FCA,0x389,0x1F28,0x1F29,
+  0x1FCC,0x1FDA,0x38A,0x1FD9,0x1FD8,0x3AA,0x1F38,0x1F39,0x1FF8,0x38C,0x1F48,0x1F49,
+  0x1FEC,0x1FEA,0x38E,0x1FE9,0x1FE8,0x3AB,0x1F59,0x1FFA,0x38F,0x1F68,0x1F69,0x1FFC,
+  0x1FB4,0x1FC4,0x1F70,0x3AC,0x1FB1,0x1FB0,0x1F00,0x1F01,0x1FB6,0x1FB3,0x1F72,0x3AD,
+  0x1F10,0x1F11,0x1F74,0x3AE,0x1F20,0x1F21,0x1FC6,0x1FC3,0x1F76,0x3AF,0x1FD1,0x1FD0,
+  0x3CA,0x1F30,0x1F31,0x1FD6,0x1F78,0x3CC,0x1F40,0x1F41,0x1FE4,0x1FE5,0x1F7A,0x3CD,
+  0x1FE1,0x1FE0,0x3CB,0x1F50,0x1F51,0x1FE6,0x1F7C,0x3CE,0x1F60,0x1F61,0x1FF6,0x1FF3,
+  0x1FD2,0x390,0x1FD7,0x1FE2,0x3B0,0x1FE7,0x1FF4,0x3D3,0x3D4,0x407,0x4D0,0x4D2,
+  0x403,0x400,0x4D6,0x401,0x4C1,0x4DC,0x4DE,0x40D,0x4E2,0x419,0x4E4,0x40C,
+  0x4E6,0x4EE,0x40E,0x4F0,0x4F2,0x4F4,0x4F8,0x4EC,0x4D1,0x4D3,0x453,0x450,
+  0x4D7,0x451,0x4C2,0x4DD,0x4DF,0x45D,0x4E3,0x439,0x4E5,0x45C,0x4E7,0x4EF,
+  0x45E,0x4F1,0x4F3,0x4F5,0x4F9,0x4ED,0x457,0x476,0x477,0x4DA,0x4DB,0x4EA,
+  0x4EB,0x622,0x623,0x625,0x624,0x626,0x6C2,0x6D3,0x6C0,0x929,0x931,0x934,
+  0x9CB,0x9CC,0xB4B,0xB48,0xB4C,0xB94,0xBCA,0xBCC,0xBCB,0xC48,0xCC0,0xCCA,
+  0xCC7,0xCC8,0xCCB,0xD4A,0xD4C,0xD4B,0xDDA,0xDDC,0xDDE,0xDDD,0x1026,0x1B06,
+  0x1B08,0x1B0A,0x1B0C,0x1B0E,0x1B12,0x1B3B,0x1B3D,0x1B40,0x1B41,0x1B43,0x1E38,0x1E39,
+  0x1E5C,0x1E5D,0x1E68,0x1E69,0x1EAC,0x1EB6,0x1EAD,0x1EB7,0x1EC6,0x1EC7,0x1ED8,0x1ED9,
+  0x1F02,0x1F04,0x1F06,0x1F80,0x1F03,0x1F05,0x1F07,0x1F81,0x1F82,0x1F83,0x1F84,0x1F85,
+  0x1F86,0x1F87,0x1F0A,0x1F0C,0x1F0E,0x1F88,0x1F0B,0x1F0D,0x1F0F,0x1F89,0x1F8A,0x1F8B,
+  0x1F8C,0x1F8D,0x1F8E,0x1F8F,0x1F12,0x1F14,0x1F13,0x1F15,0x1F1A,0x1F1C,0x1F1B,0x1F1D,
+  0x1F22,0x1F24,0x1F26,0x1F90,0x1F23,0x1F25,0x1F27,0x1F91,0x1F92,0x1F93,0x1F94,0x1F95,
+  0x1F96,0x1F97,0x1F2A,0x1F2C,0x1F2E,0x1F98,0x1F2B,0x1F2D,0x1F2F,0x1F99,0x1F9A,0x1F9B,
+  0x1F9C,0x1F9D,0x1F9E,0x1F9F,0x1F32,0x1F34,0x1F36,0x1F33,0x1F35,0x1F37,0x1F3A,0x1F3C,
+  0x1F3E,0x1F3B,0x1F3D,0x1F3F,0x1F42,0x1F44,0x1F43,0x1F45,0x1F4A,0x1F4C,0x1F4B,0x1F4D,
+  0x1F52,0x1F54,0x1F56,0x1F53,0x1F55,0x1F57,0x1F5B,0x1F5D,0x1F5F,0x1F62,0x1F64,0x1F66,
+  0x1FA0,0x1F63,0x1F65,0x1F67,0x1FA1,0x1FA2,0x1FA3,0x1FA4,0x1FA5,0x1FA6,0x1FA7,0x1F6A,
+  0x1F6C,0x1F6E,0x1FA8,0x1F6B,0x1F6D,0x1F6F,0x1FA9,0x1FAA,0x1FAB,0x1FAC,0x1FAD,0x1FAE,
+  0x1FAF,0x1FB2,0x1FC2,0x1FF2,0x1FB7,0x1FCD,0x1FCE,0x1FCF,0x1FC7,0x1FF7,0x1FDD,0x1FDE,
+  0x1FDF,0x219A,0x219B,0x21AE,0x21CD,0x21CF,0x21CE,0x2204,0x2209,0x220C,0x2224,0x2226,
+  0x2241,0x2244,0x2247,0x2249,0x226D,0x2262,0x2270,0x2271,0x2274,0x2275,0x2278,0x2279,
+  0x2280,0x2281,0x22E0,0x22E1,0x2284,0x2285,0x2288,0x2289,0x22E2,0x22E3,0x22AC,0x22AD,
+  0x22AE,0x22AF,0x22EA,0x22EB,0x22EC,0x22ED,0x3094,0x304C,0x304E,0x3050,0x3052,0x3054,
+  0x3056,0x3058,0x305A,0x305C,0x305E,0x3060,0x3062,0x3065,0x3067,0x3069,0x3070,0x3071,
+  0x3073,0x3074,0x3076,0x3077,0x3079,0x307A,0x307C,0x307D,0x309E,0x30F4,0x30AC,0x30AE,
+  0x30B0,0x30B2,0x30B4,0x30B6,0x30B8,0x30BA,0x30BC,0x30BE,0x30C0,0x30C2,0x30C5,0x30C7,
+  0x30C9,0x30D0,0x30D1,0x30D3,0x30D4,0x30D6,0x30D7,0x30D9,0x30DA,0x30DC,0x30DD,0x30F7,
+  0x30F8,0x30F9,0x30FA,0x30FE,0x1109A,0x1109C,0x110AB,0x1112E,0x1112F,0x1134B,0x1134C,0x114BC,
+  0x114BB,0x114BE,0x115BA,0x115BB,0x11938,
+};
+
+static const u8 charWidthStage1[272] = {
+  0,1,2,3,4,5,5,5,5,5,6,5,5,7,8,9,10,11,8,12,8,8,13,5,14,8,15,16,17,18,19,20,
+  5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,21,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,21,
+  8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+  8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+  8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+  8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+  8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+  22,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+  8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+};
+
+static const u8 charWidthStage2[23][32] = {
+  {
+    0,1,2,2,2,2,3,2,2,4,2,5,6,7,8,9,
+    10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,
+  },
+  {
+    26,27,28,29,2,2,30,2,2,2,2,2,2,2,31,32,
+    33,34,35,2,36,37,38,39,40,41,2,42,2,2,2,2,
+  },
+  {
+    43,44,2,2,2,2,45,46,2,2,2,47,48,49,50,51,
+    2,2,2,2,2,2,52,2,2,53,54,55,2,56,57,58,
+  },
+  {
+    59,60,61,62,63,57,57,57,57,57,57,57,57,57,57,57,
+    57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,
+  },
+  {
+    57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,
+    57,57,57,57,57,57,57,57,57,57,57,64,57,57,57,57,
+  },
+  {
+    57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,
+    57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,
+  },
+  {
+    57,57,57,57,57,57,57,57,57,65,2,2,66,67,2,2,
+    68,69,70,71,72,73,2,74,57,57,57,57,57,57,57,57,
+  },
+  {
+    57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,75,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  },
+  {
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  },
+  {
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,57,57,57,57,76,2,2,2,2,2,77,54,78,79,
+  },
+  {
+    2,2,2,80,2,81,82,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,83,84,2,2,2,2,85,2,2,86,87,88,
+  },
+  {
+    89,90,91,92,93,94,95,2,96,97,2,98,99,100,101,2,
+    102,2,103,104,105,106,2,2,107,108,109,110,2,111,2,2,
+  },
+  {
+    2,2,2,2,2,2,2,2,112,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  },
+  {
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,113,114,2,2,2,2,2,2,2,115,116,
+  },
+  {
+    57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,117,
+    57,57,57,57,57,57,57,57,57,118,119,2,2,2,2,2,
+  },
+  {
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,120,
+  },
+  {
+    57,57,121,57,57,122,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,123,2,2,2,2,2,2,
+  },
+  {
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,124,2,
+  },
+  {
+    2,2,125,126,127,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,128,129,2,2,2,2,2,2,2,2,2,2,
+  },
+  {
+    130,2,114,2,2,131,2,2,2,2,2,2,2,2,2,2,
+    2,132,133,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  },
+  {
+    134,135,2,136,137,2,138,139,140,141,142,143,144,145,2,146,
+    2,2,147,57,148,149,2,2,2,2,2,2,2,2,2,2,
+  },
+  {
+    57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,
+    57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,150,
+  },
+  {
+    151,2,29,3,2,2,2,2,2,2,2,2,2,2,2,2,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+  },
+};
+
+static const u8 charWidthBlocks[152][32] = {
+  {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,
+  },
+  {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x15,0x00,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,
+    0x41,0x10,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x00,0x50,0x55,0x55,0x00,0x00,0x40,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x15,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x54,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x10,0x00,0x14,0x04,0x50,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x15,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x00,0x54,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x55,0x55,0x51,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x05,0x10,0x00,0x00,0x01,0x01,0x50,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x50,0x55,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  },
+  {
+    0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x54,
+    0x01,0x00,0x54,0x51,0x01,0x00,0x55,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,
+    0x01,0x54,0x55,0x51,0x55,0x55,0x55,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x45,
+  },
+  {
+    0x41,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,
+    0x41,0x15,0x14,0x50,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x51,0x55,0x55,
+  },
+  {
+    0x41,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,
+    0x01,0x10,0x54,0x51,0x55,0x55,0x55,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x05,0x00,
+  },
+  {
+    0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x14,
+    0x01,0x54,0x55,0x51,0x55,0x41,0x55,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x54,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x54,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x04,
+    0x54,0x05,0x04,0x50,0x55,0x41,0x55,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x14,
+    0x55,0x45,0x55,0x50,0x55,0x55,0x55,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x54,
+    0x01,0x54,0x55,0x51,0x55,0x55,0x55,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x45,0x55,0x05,0x44,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x00,0x40,0x55,
+    0x55,0x15,0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x00,0x00,0x54,
+    0x55,0x55,0x00,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x11,0x51,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00,0x00,0x40,
+  },
+  {
+    0x00,0x04,0x55,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,
+    0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x04,0x00,0x41,0x41,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x05,0x54,0x55,0x55,0x55,0x01,0x54,0x55,0x55,
+  },
+  {
+    0x45,0x41,0x55,0x51,0x55,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  },
+  {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x05,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x10,0x00,0x50,
+    0x55,0x45,0x01,0x00,0x00,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x15,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x41,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x40,0x15,0x54,0x55,0x45,0x55,0x01,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x15,0x14,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x45,0x00,0x40,0x44,0x01,0x00,0x54,0x15,0x00,0x00,0x14,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x04,0x40,0x54,
+    0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x55,0x55,0x55,
+  },
+  {
+    0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x50,0x10,0x50,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x50,0x11,0x50,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x05,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x40,0x00,0x00,0x00,0x04,0x00,0x54,0x51,0x55,0x54,0x50,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  },
+  {
+    0x55,0x55,0x15,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x40,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x04,0x00,0x00,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0xa5,0x55,0x55,0x55,0x69,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xa9,0x56,0x96,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x69,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x5a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0xaa,0xaa,0xaa,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x95,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x95,0x55,0x55,0x55,0x59,0x55,0xa5,0x55,0x55,0x55,0x55,0x69,
+    0x55,0x5a,0x55,0x65,0x55,0x56,0x55,0x55,0x55,0x55,0x65,0x55,0xa5,0x59,0x65,0x59,
+  },
+  {
+    0x55,0x59,0xa5,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x56,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x66,0x95,0x9a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0xa9,0x55,0x55,0x55,0x55,0x55,0x55,0x56,0x55,0x55,0x95,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x95,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x56,0x59,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x50,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x9a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0xaa,0x5a,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0xaa,0xaa,0x55,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x0a,0xa0,0xaa,0xaa,0xaa,0x6a,
+    0xa9,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,0x81,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+  },
+  {
+    0x55,0xa9,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xa9,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+  },
+  {
+    0xaa,0xaa,0xaa,0x6a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0xaa,0xaa,0xaa,0x56,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0x6a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x40,0x00,0x00,0x50,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x55,0x55,0x55,
+  },
+  {
+    0x45,0x45,0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x41,0x55,0x54,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x50,0x55,0x55,0x15,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x50,0x55,0x55,0x55,0x55,
+    0x55,0x15,0x00,0x00,0x50,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x56,
+  },
+  {
+    0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x05,0x50,0x50,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x40,0x41,0x41,0x55,0x55,
+    0x15,0x55,0x55,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x04,0x14,0x54,0x05,
+    0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x55,0x45,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,0x54,0x51,0x55,0x55,0x55,0x55,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x00,0x00,0x00,0x00,0xaa,0xaa,0x5a,0x55,0x00,0x00,0x00,0x00,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0x6a,0xaa,0xaa,0xaa,0xaa,0x6a,0xaa,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0xa9,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0x6a,0x55,0x55,0x55,0x55,0x01,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x40,0x55,
+  },
+  {
+    0x01,0x41,0x55,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x40,0x15,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x41,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x54,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x05,0x00,0x00,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x05,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,
+    0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x14,0x54,0x55,0x15,
+  },
+  {
+    0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x40,0x41,0x51,
+    0x45,0x55,0x55,0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x01,0x00,0x54,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x55,0x55,0x55,
+  },
+  {
+    0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x40,
+    0x55,0x55,0x01,0x14,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x50,0x04,0x55,0x45,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x15,0x00,0x40,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x54,
+    0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x54,0x00,0x54,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,
+    0x05,0x44,0x55,0x55,0x55,0x55,0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x44,0x15,
+    0x04,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x50,0x55,0x10,
+    0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x40,0x11,
+    0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x51,0x00,0x10,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x05,0x10,0x00,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x41,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x44,
+    0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x00,0x05,0x55,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x01,0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x14,0x40,
+    0x55,0x15,0x55,0x55,0x01,0x40,0x01,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x05,0x00,0x00,0x40,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x40,0x00,0x10,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x05,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x41,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x40,0x45,0x10,
+    0x00,0x10,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x50,0x11,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x54,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x54,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x54,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x40,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x15,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0x54,0x55,0x55,0x5a,0x55,0x55,0x55,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0xaa,0x5a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0xaa,0xaa,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0xa9,0xaa,0x69,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x6a,0x55,0x55,0x55,0x55,0xaa,0x55,0x55,0xaa,0xaa,0xaa,0xaa,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x41,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,
+    0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x50,0x55,0x15,0x00,0x00,0x00,
+  },
+  {
+    0x40,0x01,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x50,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x05,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x15,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x55,0x51,0x55,0x55,
+  },
+  {
+    0x55,0x54,0x55,0x55,0x55,0x55,0x15,0x00,0x01,0x00,0x00,0x00,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x00,0x40,0x00,0x00,0x00,0x00,0x14,0x00,0x10,0x04,0x40,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x95,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x65,0xa9,0xaa,0x6a,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xa5,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+  },
+  {
+    0x6a,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,
+    0xaa,0xaa,0x56,0x55,0x5a,0x55,0x55,0x55,0xaa,0x5a,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x56,0x55,0x55,0xa9,0xaa,0x9a,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xa6,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0x6a,0x95,0xaa,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0x56,0x56,0xaa,0xaa,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,
+    0xa6,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x96,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x5a,
+    0x55,0x55,0x95,0x6a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0x55,0x65,0x55,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x69,0x55,0x55,0x55,0x56,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x95,0xaa,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0x5a,0x55,0x56,0x6a,0xa9,0x55,0xa9,0x55,0x55,0x95,0x56,0x55,0xaa,0xaa,0x56,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0xaa,0xaa,0x55,0x56,0x55,0x55,0x55,
+  },
+  {
+    0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,0xaa,
+    0xaa,0x9a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+  },
+  {
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+    0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xaa,0x56,0xaa,0x56,
+  },
+  {
+    0xaa,0x6a,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x56,0xaa,0xaa,0x6a,0x55,
+    0xaa,0x5a,0x55,0x55,0xaa,0xaa,0x5a,0x55,0xaa,0xaa,0x55,0x55,0xaa,0x6a,0x55,0x55,
+  },
+  {
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+    0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x5a,
+  },
+  {
+    0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  },
+};
+
+static inline u32 charWidth(u32 uc) {
+  if (uc >= 0x110000) {
+    return 1;
+  }
+  u32 block = charWidthStage2[charWidthStage1[uc >> 12]][(uc >> 7) & 31];
+  return (charWidthBlocks[block][(uc >> 2) & 31] >> ((uc & 3) * 2)) & 3;
+}
+
+
+static void unfold(u32 folded, std::vector<u32>& out) {
+  out.push_back(folded);
+  const u32* keysE = caseUnfoldKeys + sizeof(caseUnfoldKeys) / sizeof(u32);
+  auto r = std::equal_range(caseUnfoldKeys, keysE, folded);
+  for (const u32* I = r.first; I != r.second; ++I) {
+    out.push_back(caseUnfoldValues[I - caseUnfoldKeys]);
+  }
+}
+
+
+// Normalization forms, following UAX #15. Text is checked with the quick check properties, and
+// only spans which fail it are decomposed, reordered and, for NFC and NFKC, recomposed. A span
+// runs from the last character which passes the check and has combining class 0 up to the next
+// such character, as nothing on either side of those can combine or reorder with the span.
+
+static const u32 hangulSBase = 0xAC00, hangulLBase = 0x1100, hangulVBase = 0x1161;
+static const u32 hangulTBase = 0x11A7, hangulLCount = 19, hangulVCount = 21, hangulTCount = 28;
+static const u32 hangulNCount = hangulVCount * hangulTCount;
+static const u32 hangulSCount = hangulLCount * hangulNCount;
+
+// Lead bytes below these only start characters which pass the quick check and have combining
+// class 0, i.e. below U+0300 for NFC, U+00C0 for NFD and U+0080 for NFKC and NFKD
+static const u8 normFastLimits[4] = {0xcc, 0xc3, 0xc2, 0xc2};
+
+static inline u32 quickCheck(u16 props, NormalizationForm form) {
+  return (props >> (8 + 2 * form)) & 3; // 0 for yes, 1 for maybe, 2 for no
+}
+
+static void decompose(u32 uc, bool compat, std::vector<u32>& out) {
+  if (uc - hangulSBase < hangulSCount) {
+    u32 s = uc - hangulSBase;
+    out.push_back(hangulLBase + s / hangulNCount);
+    out.push_back(hangulVBase + (s % hangulNCount) / hangulTCount);
+    if (s % hangulTCount != 0) {
+      out.push_back(hangulTBase + s % hangulTCount);
+    }
+    return;
+  }
+  u16 offset = normDecompOffset(uc);
+  if (offset != 0) {
+    u32 header = normDecompData[offset];
+    u32 n = compat ? (header >> 8) & 0xff : header & 0xff;
+    if (n != 0) {
+      const u32* p = normDecompData + offset + 1 + (compat ? header >> 16 : 0);
+      out.insert(out.end(), p, p + n);
+      return;
+    }
+  }
+  out.push_back(uc);
+}
+
+static void reorder(std::vector<u32>& cps) {
+  // Stable insertion sort of each run of non-starters by combining class
+  for (size_t i = 1; i < cps.size(); ++i) {
+    u32 uc = cps[i];
+    u8 ccc = (u8)normProps(uc);
+    size_t k = i;
+    for (; ccc != 0 && k != 0; --k) {
+      u8 prev = (u8)normProps(cps[k - 1]);
+      if (prev <= ccc) {
+        break;
+      }
+      cps[k] = cps[k - 1];
+    }
+    cps[k] = uc;
+  }
+}
+
+static u32 composePair(u32 a, u32 b) {
+  // Returns the primary composite of a and b, or 0 if there is none
+  if (a - hangulLBase < hangulLCount && b - hangulVBase < hangulVCount) {
+    return hangulSBase + ((a - hangulLBase) * hangulVCount + (b - hangulVBase)) * hangulTCount;
+  }
+  if (a - hangulSBase < hangulSCount && (a - hangulSBase) % hangulTCount == 0 &&
+      b - hangulTBase - 1 < hangulTCount - 1) {
+    return a + (b - hangulTBase);
+  }
+  u64 key = ((u64)a << 21) | b;
+  const u64* keysE = normCompositionKeys + sizeof(normCompositionKeys) / sizeof(u64);
+  const u64* I = std::lower_bound(normCompositionKeys, keysE, key);
+  return (I != keysE && *I == key) ? normCompositionValues[I - normCompositionKeys] : 0;
+}
+
+static void compose(std::vector<u32>& cps) {
+  size_t starter = (size_t)-1; // output index of the last starter
+  size_t n = 0;
+  u8 lastCCC = 0;
+  for (size_t i = 0; i != cps.size(); ++i) {
+    u32 uc = cps[i];
+    u8 ccc = (u8)normProps(uc);
+    // A character combines with the last starter unless something in between blocks it
+    if (starter != (size_t)-1 && (n == starter + 1 || (lastCCC != 0 && lastCCC < ccc))) {
+      u32 composite = composePair(cps[starter], uc);
+      if (composite != 0) {
+        cps[starter] = composite;
+        continue;
+      }
+    }
+    if (ccc == 0) {
+      starter = n;
+    }
+    lastCCC = ccc;
+    cps[n++] = uc;
+  }
+  cps.resize(n);
+}
+
+static void normalizeSpan(
+  const char* inI, const char* inE, NormalizationForm form, std::vector<u32>& cps,
+  std::string& outs)
+{
+  cps.clear();
+  while (inI != inE) {
+    decompose(UTF8_NEXT(inI, inE), form == NFKC || form == NFKD, cps);
+  }
+  reorder(cps);
+  if (form == NFC || form == NFKC) {
+    compose(cps);
+  }
+  outs.clear();
+  for (u32 uc : cps) {
+    char b[4];
+    outs.append(b, _appendUTF8(b, uc) - b);
+  }
+}
+
+static bool normalizeImp(View ins, NormalizationForm form, std::string* outs) {
+  // Returns true if `ins` is already normalized. Otherwise, unless `outs` is null, the normalized
+  // text is written to *outs.
+  const char* inB = ins.begin();
+  const char* inI = inB;
+  const char* inE = ins.end();
+  const char* copied = inB;   // input before this has been written to outs
+  const char* boundary = inB; // start of the current span
+  u8 lastCCC = 0;
+  std::vector<u32> cps;
+  std::string span;
+  while (true) {
+    size_t n = simd::spanBelow(inI, inE - inI, normFastLimits[form]);
+    if (n != 0) {
+      const char* skipped = inI;
+      if (!canDecodeUnchecked(skipped, n)) {
+        // Let the decoder report invalid input, as it does for the rest of the input
+        for (const char* p = skipped; p != inE; ) {
+          UTF8_NEXT(p, inE);
+        }
+      }
+      inI += n;
+      boundary = inI - 1;
+      while (boundary != skipped && simd::isTrail((u8)*boundary)) {
+        --boundary;
+      }
+      lastCCC = 0;
+    }
+    if (inI == inE) {
+      break;
+    }
+    const char* charI = inI;
+    u16 props = normProps(UTF8_NEXT(inI, inE));
+    u8 ccc = (u8)props;
+    u32 qc = quickCheck(props, form);
+    if (qc == 0 && (ccc == 0 || ccc >= lastCCC)) {
+      if (ccc == 0) {
+        boundary = charI;
+      }
+      lastCCC = ccc;
+      continue;
+    }
+    if (outs == nullptr && (qc == 2 || (ccc != 0 && ccc < lastCCC))) {
+      return false;
+    }
+    // Normalize up to the next character which passes the check and has combining class 0. When
+    // the check said maybe, the span may turn out to be normalized already.
+    const char* spanE = inI;
+    while (spanE != inE) {
+      const char* p = spanE;
+      props = normProps(UTF8_NEXT(p, inE));
+      if ((u8)props == 0 && quickCheck(props, form) == 0) {
+        break;
+      }
+      spanE = p;
+    }
+    normalizeSpan(boundary, spanE, form, cps, span);
+    if (span.size() != (size_t)(spanE - boundary) || memcmp(span.data(), boundary, span.size())) {
+      if (outs == nullptr) {
+        return false;
+      }
+      if (copied == inB) {
+        outs->clear();
+      }
+      outs->append(copied, boundary);
+      outs->append(span);
+      copied = spanE;
+    }
+    inI = spanE;
+    boundary = spanE;
+    lastCCC = 0;
+  }
+  if (copied == inB) {
+    return true;
+  }
+  outs->append(copied, inE);
+  return false;
+}
+
+View normalize(View ins, NormalizationForm form, std::string& buf) {
+  if (pointsInto(ins, buf)) {
+    std::string tmp;
+    if (normalizeImp(ins, form, &tmp)) {
+      return ins;
+    }
+    buf.swap(tmp);
+    return View{buf};
+  }
+  return normalizeImp(ins, form, &buf) ? ins : View{buf};
+}
+
+std::string normalize(View ins, NormalizationForm form) {
+  std::string outs;
+  return normalizeImp(ins, form, &outs) ? ins.str() : outs;
+}
+
+bool isNormalized(View ins, NormalizationForm form) {
+  return normalizeImp(ins, form, nullptr);
+}
+
+
+// Display width. Runs of printable ASCII, one column per byte, are measured with SIMD and other
+// characters are looked up in the generated charWidth table.
+
+static size_t widthImp(View s, size_t columns, size_t& width) {
+  // Returns the length in bytes of the longest prefix of `s` which fits in `columns` columns, and
+  // stores its width in `width`
+  const char* inB = s.begin();
+  const char* inI = inB;
+  const char* inE = s.end();
+  size_t w = 0;
+  while (inI != inE) {
+    size_t n = simd::spanPrintableASCII(inI, inE - inI);
+    if (n >= columns - w) {
+      inI += columns - w;
+      w = columns;
+      // Keep any zero-width characters which follow
+      while (inI != inE) {
+        const char* p = inI;
+        u8 b = (u8)*p;
+        if ((b >= 0x20 && b < 0x7f) || charWidth(b < 0x80 ? b : UTF8_NEXT(p, inE)) != 0) {
+          break;
+        }
+        inI = (b < 0x80) ? inI + 1 : p;
+      }
+      break;
+    }
+    inI += n;
+    w += n;
+    if (inI == inE) {
+      break;
+    }
+    const char* p = inI;
+    u32 uc = (u8)*p;
+    if (uc < 0x80) {
+      ++p;
+    } else {
+      uc = UTF8_NEXT(p, inE);
+    }
+    u32 cw = charWidth(uc);
+    if (cw > columns - w) {
+      break;
+    }
+    w += cw;
+    inI = p;
+  }
+  width = w;
+  return inI - inB;
+}
+
+size_t displayWidth(View s) {
+  size_t width;
+  widthImp(s, (size_t)-1, width);
+  return width;
+}
+
+View truncateToWidth(View s, size_t columns, size_t* width) {
+  size_t w;
+  size_t n = widthImp(s, columns, w);
+  if (width) {
+    *width = w;
   }
+  return View{s.data(), n};
 }
 
 
@@ -2,49 +2,368 @@
 #pragma once
 #include <string>
 #include <ostream>
+#include <vector>
 #include <set>
+#include <initializer_list>
+#include <iterator>
 
 namespace rx {
   using Text = std::basic_string<u32>;
     // Unicode text
+
+  struct CompactText {
+    // Unicode text which stores each code point in 1, 2 or 4 bytes, depending on the widest code
+    // point: U+0000..U+00FF (Latin-1), U+0000..U+FFFF (UCS-2) or anything (UCS-4). Supports
+    // indexing in constant time like Text. Storage is widened as needed by mutations, but is never
+    // narrowed again.
+    CompactText() : _shift{0} {}
+    explicit CompactText(const Text&);
+    size_t size() const { return _bytes.size() >> _shift; }
+    bool empty() const { return _bytes.empty(); }
+    size_t width() const { return (size_t)1 << _shift; } // bytes per code point
+    u32 operator[](size_t i) const;
+    void set(size_t i, u32);
+    void push_back(u32);
+    void append(const CompactText&);
+    void reserve(size_t n) { _bytes.reserve(n << _shift); }
+    void clear() { _bytes.clear(); }
+    Text text() const;
+    bool operator==(const CompactText&) const;
+    bool operator!=(const CompactText& t) const { return !(*this == t); }
+
+    struct const_iterator {
+      u32 operator*() const { return (*t)[i]; }
+      const_iterator& operator++() { ++i; return *this; }
+      bool operator==(const const_iterator& it) const { return i == it.i; }
+      bool operator!=(const const_iterator& it) const { return i != it.i; }
+      const CompactText* t;
+      size_t             i;
+    };
+    const_iterator begin() const { return const_iterator{this, 0}; }
+    const_iterator end() const { return const_iterator{this, size()}; }
+
+    const std::string& bytes() const { return _bytes; }
+      // Code points in host byte order, width() bytes each
+
+    static CompactText fromBytes(std::string bytes, size_t width);
+      // Takes over storage as returned by bytes(). `width` must be 1, 2 or 4.
+
+  private:
+    void widen(u8 shift);
+    std::string _bytes;
+    u8          _shift; // log2 of width()
+  };
+
+  inline u32 CompactText::operator[](size_t i) const {
+    const char* p = _bytes.data();
+    switch (_shift) {
+      case 0: return (u8)p[i];
+      case 1: { u16 c; memcpy(&c, p + i * 2, 2); return c; }
+      default: { u32 c; memcpy(&c, p + i * 4, 4); return c; }
+    }
+  }
 }
 
 namespace std { std::string to_string(const ::rx::Text&); }
   // Convert Unicode text to a UTF8 string
+namespace std { std::string to_string(const ::rx::CompactText&); }
+  // Convert compact Unicode text to a UTF8 string
 
 namespace rx {
 namespace text {
 
+struct View {
+  // A non-owning reference to a range of UTF8 text, e.g. part of a std::string. The referenced
+  // memory must outlive the view.
+  View() : _p{nullptr}, _z{0} {}
+  View(const char* p, size_t z) : _p{p}, _z{z} {}
+  View(const std::string& s) : _p{s.data()}, _z{s.size()} {}
+  const char* data() const { return _p; }
+  size_t size() const { return _z; }
+  const char* begin() const { return _p; }
+  const char* end() const { return _p + _z; }
+  bool empty() const { return _z == 0; }
+  std::string str() const { return std::string{_p, _z}; }
+  bool operator==(const View& v) const {
+    return _z == v._z && (_z == 0 || memcmp(_p, v._p, _z) == 0); // data() may be null when empty
+  }
+  bool operator!=(const View& v) const { return !(*this == v); }
+private:
+  const char* _p;
+  size_t      _z;
+};
+
 struct CharacterSet {
   template <typename... Characters> CharacterSet(Characters...);
+  CharacterSet(std::initializer_list<u32>);
+  void insert(u32);
   bool contains(u32) const;
-  std::set<u32> characters;
+
+  template <typename F> void each(F fun) const;
+    // Calls fun(u32) for each member, in ascending order
+  const std::set<u32> characters() const;
+    // Deprecated: a copy of the members. This replaces the former public `std::set<u32>
+    // characters` member, which is an API change: code which read `cs.characters.x` must now call
+    // `cs.characters().x`, or better contains() or each(), which don't allocate. Members can no
+    // longer be added through it; use insert() instead. The copy is const so that
+    // `cs.characters().insert(c)` doesn't compile rather than silently doing nothing.
+
+  // Internal
+  void _each(const rx::func<void(u32)>&) const;
+  const u8* _asciiNibbles() const { return _nibbles; }
+  bool _asciiOnly() const { return _bmpLeaves.size() <= 4 && _astral.empty(); }
+
+private:
+  bool containsAstral(u32) const;
+
+  // Members are stored as a bitmap for U+0000..U+007F, a two-level bitmap for the rest of the
+  // BMP (one 256-bit leaf per non-empty block of 256 code points; empty blocks share leaf 0) and
+  // a sorted list of disjoint ranges for the astral planes.
+  struct Range { u32 first; u32 last; };
+  u64                _ascii[2];
+  u16                _bmpIndex[256];
+  std::vector<u64>   _bmpLeaves; // 4 words per leaf
+  std::vector<Range> _astral;
+  u8                 _nibbles[16];
+    // ASCII members as a nibble lookup table for vectorized scans: bit N of _nibbles[L] is set
+    // when the character (N << 4 | L) is a member.
 };
 
 extern const CharacterSet WhitespaceCharacterSet;
-  // All whitespace characters as per Unicode 7 (category Zs)
+  // All whitespace characters as per Unicode 14.0 (category Zs)
 extern const CharacterSet LinebreakCharacterSet;
-  // All linebreak characters as per Unicode 7 (type LF, CR and BK). Note that this only includes
+  // All linebreak characters as per Unicode 14.0 (type LF, CR and BK). Note that this only includes
   // pure line-breaking characters. It does not express Unicode Line Breaking Algorithm (UAX#14.)
 extern const CharacterSet ControlCharacterSet;
-  // All control characters as per Unicode 7 (category Cc)
+  // All control characters as per Unicode 14.0 (category Cc)
 extern const CharacterSet WhitespaceLinebreakAndControlCharacterSet;
   // A combination of WhitespaceCharacterSet, LinebreakCharacterSet and ControlCharacterSet
   // commonly used when trimming strings.
 
 Text decodeUTF8(const std::string&);
+Text decodeUTF8(View);
   // Convert a UTF8 string to Unicode text. See std::to_string(const Text&) for the inverse.
+CompactText decodeUTF8Compact(View);
+  // Convert a UTF8 string to compact Unicode text, picking the narrowest width that fits all of
+  // its characters. See std::to_string(const CompactText&) for the inverse.
+
+bool isValidUTF8(const char*, size_t);
+  // True if the bytes are valid UTF8, i.e. without overlong sequences, surrogates or code points
+  // larger than U+10FFFF, and not ending in the middle of a sequence.
+
+size_t findInvalid(const char*, size_t);
+  // Returns the offset of the first invalid UTF8 sequence, or the size of the input if the input
+  // is valid UTF8.
+
+View repairUTF8(View, std::string& buf);
+  // Replace invalid UTF8 sequences with U+FFFD, like utf8::replace_invalid. Valid input is
+  // returned as it is, without copying. Otherwise the repaired text is written to `buf` and a view
+  // of it is returned. An invalid lead byte is replaced on its own, while any other invalid or
+  // truncated sequence is replaced along with the continuation bytes which follow its lead. The
+  // input may be a view of `buf` itself, as in v = repairUTF8(v, buf).
 
 u32 normalize(u32);
-  // Convert a Unicode point to its normalized folded value, used for case-less comparison.
+  // Convert a Unicode point to its normalized folded value, used for case-less comparison. This
+  // is simple case folding as per Unicode 14.0 (CaseFolding.txt status C and S.)
 
 std::string normalize(const std::string&);
+std::string normalize(View);
   // Convert a UTF8 string to its normalized folded version, used for case-less comparison.
 
+enum NormalizationForm : u8 { NFC, NFD, NFKC, NFKD };
+
+std::string normalize(View, NormalizationForm);
+View normalize(View, NormalizationForm, std::string& buf);
+  // Convert a UTF8 string to a Unicode normalization form (UAX #15) as per Unicode 14.0. Unlike
+  // the folding normalize functions above, these keep case and only choose between equivalent
+  // spellings of the same text: canonically equivalent for NFC and NFD, and also compatibility
+  // equivalent for NFKC and NFKD. Text which is already normalized is found as such in a single
+  // pass, and the second version then returns the input itself without touching `buf`. Otherwise
+  // it writes the normalized text to `buf` and returns a view of it. The input may be a view of
+  // `buf` itself, as in v = normalize(v, NFC, buf). Invalid UTF8 is reported like decodeUTF8 does.
+
+bool isNormalized(View, NormalizationForm);
+
+int compareFolded(View, View);
+bool equalsFolded(View, View);
+  // Compare two UTF8 strings by their normalized folded characters, without allocating memory.
+  // compareFolded returns a negative number, zero or a positive number when the first string
+  // orders before, the same as or after the second. Invalid UTF8 is reported like decodeUTF8 does
+  // when it's reached, so equal strings which hold it are never taken as equal.
+
+struct FoldedHash {
+  // Hash and equality of the normalized folded version of UTF8 strings. Can be used for both the
+  // hasher and key-equal of unordered containers, e.g.
+  //   std::unordered_map<std::string, int, FoldedHash, FoldedHash>
+  size_t operator()(View) const;
+  bool operator()(View a, View b) const { return equalsFolded(a, b); }
+};
+
+struct FoldedSearcher {
+  // Case-less substring search, comparing normalized folded characters like compareFolded. The
+  // needle is folded once, so a searcher can be reused for any number of haystacks.
+  explicit FoldedSearcher(View needle);
+  size_t find(View haystack, size_t* matchSize = nullptr) const;
+    // Returns the byte offset of the first match in `haystack`, or npos. The match can differ in
+    // size from the needle, e.g. "K" (U+212A KELVIN SIGN) is three bytes long and matches "k",
+    // which is why its size is returned in `matchSize`.
+  static const size_t npos = (size_t)-1;
+
+private:
+  std::vector<u32> _needle;    // folded characters
+  u32              _skip[256]; // Horspool shifts, by the low byte of a folded character
+  u8               _first[4];  // bytes which can start a match
+  u8               _nfirst;    // 0 if there are too many
+};
+
+size_t findFolded(View haystack, View needle, size_t* matchSize = nullptr);
+  // Same as FoldedSearcher{needle}.find(haystack, matchSize)
+
+struct MultiMatcher { RX_REF_MIXIN(MultiMatcher)
+  // Finds any number of patterns in UTF8 text in a single pass, comparing normalized folded
+  // characters (Aho-Corasick.) The automaton is immutable once built, so copies of a matcher
+  // share it and can be used from any number of threads.
+  struct Match {
+    size_t pattern; // index into the patterns the matcher was built from
+    size_t begin;   // byte range of the match in the input
+    size_t end;
+  };
+  MultiMatcher(); // == nullptr
+  explicit MultiMatcher(const std::vector<std::string>& patterns);
+
+  bool match(View, rx::func<bool(const Match&)>) const;
+    // Calls fun for each match, including overlapping ones, in order of their end offset.
+    // Stops and returns false if fun returns false. Empty patterns never match.
+  std::vector<Match> matchAll(View) const;
+  bool matchesAny(View) const;
+};
+
+std::string sortKey(View);
+  // Binary sort key for case-less sorting. Keys compare with memcmp in the same order as their
+  // strings do with compareFolded, so that a list can be folded once per element rather than once
+  // per comparison. A key is the UTF8 of the folded characters followed by two zero bytes, with
+  // NUL characters written as 0 1. No key is thus a prefix of another, and comparing the first
+  // min(a.size(), b.size()) bytes is enough to order any two keys.
+
+struct SortKeys {
+  // Sort keys for a list of strings, stored back to back in one buffer
+  std::string         arena;
+  std::vector<size_t> offsets; // key i spans arena[offsets[i]] up to arena[offsets[i + 1]]
+
+  size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+  View operator[](size_t i) const {
+    return View{arena.data() + offsets[i], offsets[i + 1] - offsets[i]};
+  }
+};
+
+SortKeys sortKeys(const std::vector<std::string>&);
+
 std::string ltrim(const std::string&, const CharacterSet& cs=WhitespaceLinebreakAndControlCharacterSet);
 std::string rtrim(const std::string&, const CharacterSet& cs=WhitespaceLinebreakAndControlCharacterSet);
 std::string trim(const std::string&, const CharacterSet& cs=WhitespaceLinebreakAndControlCharacterSet);
+View ltrim(View, const CharacterSet& cs=WhitespaceLinebreakAndControlCharacterSet);
+View rtrim(View, const CharacterSet& cs=WhitespaceLinebreakAndControlCharacterSet);
+View trim(View, const CharacterSet& cs=WhitespaceLinebreakAndControlCharacterSet);
   // Remove leading(1), trailing(2) or both leading and trailing(3) characters from a UTF8 string.
+  // The View versions return a sub-range of their input and never allocate memory. Only the
+  // characters at the trimmed ends are decoded, up to and including the first one which is kept:
+  // invalid UTF8 there is reported like decodeUTF8 does, while the rest of the string is returned
+  // unchecked. (rtrim and trim used to decode, and so validate, the whole string.)
+
+enum SplitOptions : u8 {
+  SplitSkipEmpty      = 1 << 0, // Leave out empty tokens, e.g. between adjacent delimiters
+  SplitKeepDelimiters = 1 << 1, // Produce each delimiter as a token of its own
+};
+
+struct SplitRange {
+  // Lazy range of the tokens in a UTF8 string, as returned by split
+  struct iterator {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = View;
+    using difference_type   = ptrdiff_t;
+    using pointer           = const View*;
+    using reference         = View;
+    View operator*() const { return _token; }
+    const View* operator->() const { return &_token; }
+    iterator& operator++() { _next(); return *this; }
+    iterator operator++(int) { iterator it = *this; _next(); return it; }
+    bool operator==(const iterator& it) const {
+      // With SplitKeepDelimiters, an empty token starts where the delimiter after it does
+      return _done == it._done &&
+             (_done || (_token.data() == it._token.data() && _token.size() == it._token.size()));
+    }
+    bool operator!=(const iterator& it) const { return !(*this == it); }
+
+    // Internal
+    void _next();
+    const CharacterSet* _cs;
+    const char*         _p;     // start of the input after _token
+    const char*         _e;
+    View                _token;
+    View                _delim; // delimiter to produce next, with SplitKeepDelimiters
+    u8                  _options;
+    bool                _last;  // _token is the last token
+    bool                _done;
+  };
+  iterator begin() const;
+  iterator end() const { return iterator{_cs, _s.end(), _s.end(), View{}, View{}, _options, true, true}; }
+
+  View                _s;
+  const CharacterSet* _cs;
+  u8                  _options;
+};
+
+SplitRange split(View, const CharacterSet& cs=WhitespaceLinebreakAndControlCharacterSet, u8 options=0);
+  // Split a UTF8 string into the tokens between characters in `cs`. Tokens are produced as the
+  // range is iterated and refer to the input string; no memory is allocated. E.g.
+  //   for (View token : split(s, cs, SplitSkipEmpty)) { ... }
+
+enum CanonicalizeOptions : u8 {
+  CanonicalizeFold     = 1 << 0, // Fold characters like normalize(View)
+  CanonicalizeCollapse = 1 << 1, // Replace each run of whitespace and controls with one space
+  CanonicalizeTrim     = 1 << 2, // Remove leading and trailing whitespace and controls
+  CanonicalizeAll      = CanonicalizeFold | CanonicalizeCollapse | CanonicalizeTrim,
+};
+
+void canonicalize(View, std::string& out, u8 options=CanonicalizeAll);
+  // Prepare a UTF8 string for search indexing in a single pass, writing the result to `out` (its
+  // capacity is kept for reuse.) Whitespace and controls are the characters in
+  // WhitespaceLinebreakAndControlCharacterSet. With all options, the result is the same as
+  // joining split(normalize(s), WhitespaceLinebreakAndControlCharacterSet, SplitSkipEmpty) with
+  // spaces, without the intermediate strings.
+
+bool findLinebreaks(const char*, size_t, rx::func<bool(const size_t* offsets, size_t count)>);
+void findLinebreaks(const char*, size_t, std::vector<size_t>& offsets);
+  // Find the line breaks in a UTF8 string, i.e. the characters in LinebreakCharacterSet, with CR
+  // LF counting as one. The offset just past each line break, where the next line starts, is
+  // reported to `fun` in batches (return false to stop; the function then returns false) or
+  // appended to `offsets`. A CR at the very end of the input is reported as a line break of its
+  // own, even if the input continues elsewhere with a LF.
+
+size_t displayWidth(View);
+  // Number of terminal columns taken up by UTF8 text, as per Unicode 14.0. Wide and fullwidth
+  // characters, including emoji, take two columns. Combining marks, format and control characters
+  // take none. Other characters take one column, including those of ambiguous East Asian width.
+
+View truncateToWidth(View, size_t columns, size_t* width = nullptr);
+  // The longest prefix of UTF8 text which fits in `columns` terminal columns, as measured by
+  // displayWidth. Characters which take no columns are kept with the character before them. The
+  // width of the prefix is stored in `width` if it's not null.
+
+size_t escapeJSON(char* out, size_t outsize, View);
+void escapeJSON(std::string& outs, View);
+  // Escape UTF8 text for use in a JSON string literal, without the surrounding quotes. Quote,
+  // backslash and the characters in ControlCharacterSet are escaped, with the short escapes JSON
+  // has for some of them and as \u00XX otherwise. The first version writes to a fixed-size buffer
+  // and returns the size of the complete result like normalizeInto, which is at most six times the
+  // size of the input. The second version appends to `outs`.
+
+size_t unescapeJSON(char* out, View, size_t* invalid = nullptr);
+  // Replace the escapes in the contents of a JSON string literal with the characters they stand
+  // for, writing UTF8 to `out` and returning its size. The result is never larger than the input,
+  // and `out` may point to the input itself. Surrogate pairs are combined, and lone surrogates
+  // become U+FFFD. Malformed escapes are copied as they are; the offset of the first one, or the
+  // size of the input if there is none, is stored in `invalid` if it's not null.
 
 std::string map(const std::string&, rx::func<u32(u32)>);
 std::string mapF(const std::string&, u32(*fun)(u32));
@@ -68,25 +387,320 @@ std::string filter(const std::string&, rx::func<bool(u32)>);
   // Apply a function to each Unicode character in a UTF8 string, and include the character in
   // the resulting UTF8 string if the function returns `true`.
 
+template <typename F> std::string map(const std::string&, F fun);
+template <typename F> std::string filter(const std::string&, F fun);
+  // Versions of map and filter which accept any callable and inline it into the decoding loop,
+  // rather than calling it through rx::func.
+
+void mapInto(std::string& out, View, rx::func<u32(u32)>);
+template <typename F> void mapInto(std::string& out, View, F fun);
+template <typename F> void filterInto(std::string& out, View, F fun);
+void normalizeInto(std::string& out, View);
+  // Versions of map, filter and normalize which append their result to `out`. Clear `out` first
+  // to overwrite it, which keeps its capacity for reuse.
+
+template <typename F> size_t mapInto(char* out, size_t outsize, View, F fun);
+template <typename F> size_t filterInto(char* out, size_t outsize, View, F fun);
+size_t normalizeInto(char* out, size_t outsize, View);
+  // Versions of map, filter and normalize which write their result to a fixed-size buffer.
+  // Returns the size of the complete result in bytes. When that is larger than `outsize`, `out`
+  // holds as many whole characters of the result as fit.
+
+Text decodeUTF8Parallel(View, size_t nthreads = 0);
+std::string mapParallel(View, rx::func<u32(u32)>, size_t nthreads = 0);
+std::string filterParallel(View, rx::func<bool(u32)>, size_t nthreads = 0);
+std::string normalizeParallel(View, size_t nthreads = 0);
+  // Versions of decodeUTF8, map, filter and normalize which split large inputs into chunks and
+  // process them on up to `nthreads` threads (0 means one per CPU core). The result is the same
+  // as for the single-threaded versions, including for early stops like MapIgnoreAll, but `fun`
+  // is called concurrently, out of order, and possibly for characters after an early stop. If
+  // `fun` throws, the exception is rethrown on the calling thread once the other threads are done.
+
+struct UTF8Index {
+  // Maps between code point indices and byte offsets in UTF8 text, in time proportional to
+  // `interval`. The byte offset of every interval'th code point is sampled when the index is
+  // built. The indexed text must outlive the index. Any byte which is not a continuation byte is
+  // counted as a code point, which is exact for valid UTF8.
+  UTF8Index() : _interval{1}, _count{0} {}
+  explicit UTF8Index(View, size_t interval = 64);
+
+  size_t count() const { return _count; }
+    // Number of code points in the text
+  size_t byteOffset(size_t cpIndex) const;
+    // Byte offset of the code point at `cpIndex`, or the size of the text if past the end
+  size_t cpIndex(size_t byteOffset) const;
+    // Index of the code point which contains the byte at `byteOffset`, or count() if past the end
+
+private:
+  View                _s;
+  size_t              _interval;
+  size_t              _count;
+  std::vector<size_t> _samples; // byte offset of code point N * _interval
+};
+
+struct StreamDecoder {
+  // Incremental UTF8 decoder for input which arrives in chunks, e.g. from a socket or a file. Byte
+  // sequences which are split across chunks are carried over to the next call to `feed`. An
+  // optional map function is applied to each character, with the same SpecialMapFunResult
+  // controls as `map`.
+  StreamDecoder();
+  StreamDecoder(rx::func<u32(u32)>);
+
+  size_t feed(const char*, size_t, u32* out);
+    // Decode a chunk into `out`, which must have room for at least as many characters as the
+    // chunk has bytes. Returns the number of characters written.
+  size_t feed(const char*, size_t, char* out);
+    // Decode a chunk and write the result as UTF8 to `out`, which must have room for at least four
+    // times as many bytes as the chunk has. Returns the number of bytes written.
+
+  bool finish();
+    // End the stream and reset the decoder for reuse. Returns false if the stream ended in the
+    // middle of a UTF8 sequence, in which case the incomplete sequence is discarded.
+  bool stopped() const;
+    // True when the map function has ended iteration with MapIgnoreAll or MapIgnoreRest. Any
+    // further input is ignored until `finish` is called.
+
+private:
+  enum class Mode : u8 { Map, Pass, Ignore };
+  rx::func<u32(u32)> _fun;
+  Mode               _mode;
+  u8                 _npending;
+  char               _pending[4];
+  template <typename O> bool put(u32, O*&);
+  template <typename O> size_t feedImp(const char*, size_t, O*);
+};
+
 
 // ------------------------------------------------------------------------------------------------
 
 inline std::string normalize(const std::string& s) {
-  return mapF(s, normalize);
+  return map(s, [](u32 c) { return normalize(c); });
+}
+
+inline std::string normalize(View s) {
+  std::string outs;
+  normalizeInto(outs, s);
+  return outs;
 }
 
 template <typename... Characters>
 inline CharacterSet::CharacterSet(Characters... chars)
-  : characters{std::forward<u32>(std::forward<Characters>(chars))...} {}
+  : CharacterSet(std::initializer_list<u32>{static_cast<u32>(chars)...}) {}
 
 inline bool CharacterSet::contains(u32 uc) const {
-  return characters.find(uc) != characters.cend();
+  if (uc < 0x80) {
+    return (_ascii[uc >> 6] >> (uc & 63)) & 1;
+  }
+  if (uc < 0x10000) {
+    const u64* leaf = _bmpLeaves.data() + ((size_t)_bmpIndex[uc >> 8] * 4);
+    return (leaf[(uc >> 6) & 3] >> (uc & 63)) & 1;
+  }
+  return containsAstral(uc);
+}
+
+template <typename F> inline void CharacterSet::each(F fun) const {
+  _each([&](u32 c) { fun(c); });
 }
 
 inline std::string filter(const std::string& s, rx::func<bool(u32)> f) {
   return map(s, [=](u32 c) { return f(c) ? c : MapIgnore; });
 }
 
+inline u32 _nextValidUTF8(const char*& p) {
+  // Decode the next character of valid UTF8
+  u32 c = (u8)*p++;
+  if (c < 0x80) {
+    return c;
+  } else if (c < 0xe0) {
+    c = ((c & 0x1f) << 6) | ((u8)p[0] & 0x3f);
+    p += 1;
+  } else if (c < 0xf0) {
+    c = ((c & 0x0f) << 12) | (((u8)p[0] & 0x3f) << 6) | ((u8)p[1] & 0x3f);
+    p += 2;
+  } else {
+    c = ((c & 0x07) << 18) | (((u8)p[0] & 0x3f) << 12) | (((u8)p[1] & 0x3f) << 6) |
+        ((u8)p[2] & 0x3f);
+    p += 3;
+  }
+  return c;
+}
+
+char* _appendInvalidUTF8(char*, u32);
+  // Append a surrogate or out-of-range code point the same way map(string, rx::func) would
+
+inline char* _appendUTF8(char* p, u32 c) {
+  if (c < 0x80) {
+    *p++ = (char)c;
+  } else if (c < 0x800) {
+    *p++ = (char)(0xc0 | (c >> 6));
+    *p++ = (char)(0x80 | (c & 0x3f));
+  } else if (c < 0x10000) {
+    if (c - 0xd800 < 0x800) {
+      return _appendInvalidUTF8(p, c);
+    }
+    *p++ = (char)(0xe0 | (c >> 12));
+    *p++ = (char)(0x80 | ((c >> 6) & 0x3f));
+    *p++ = (char)(0x80 | (c & 0x3f));
+  } else if (c < 0x110000) {
+    *p++ = (char)(0xf0 | (c >> 18));
+    *p++ = (char)(0x80 | ((c >> 12) & 0x3f));
+    *p++ = (char)(0x80 | ((c >> 6) & 0x3f));
+    *p++ = (char)(0x80 | (c & 0x3f));
+  } else {
+    return _appendInvalidUTF8(p, c);
+  }
+  return p;
+}
+
+struct _StringSink {
+  // Appends to a string, which is grown ahead of the output and shrunk to fit when done
+  _StringSink(std::string& s, size_t sizeHint) : s(s), n(s.size()) { s.resize(n + sizeHint + 4); }
+  ~_StringSink() { s.resize(n); }
+  void put(u32 c) {
+    if (s.size() - n < 4) {
+      s.resize(s.size() * 2);
+    }
+    char* p = &s[0];
+    n = _appendUTF8(p + n, c) - p;
+  }
+  void append(const char* p, const char* e) {
+    s.resize(n);
+    s.append(p, e);
+    n = s.size();
+  }
+  std::string& s;
+  size_t       n;
+};
+
+struct _SpanSink {
+  // Writes whole characters to a fixed-size buffer until one doesn't fit, and counts the bytes
+  // needed for all of the output
+  _SpanSink(char* p, size_t size) : p(p), size(size), n(0) {}
+  void put(u32 c) {
+    if (n + 4 <= size) {
+      n = _appendUTF8(p + n, c) - p;
+    } else {
+      char b[4];
+      size_t z = _appendUTF8(b, c) - b;
+      write(b, z);
+    }
+  }
+  void append(const char* s, const char* e) {
+    // Any partial character at the end of the buffer is not counted as written
+    size_t z = e - s;
+    if (n + z <= size) {
+      memcpy(p + n, s, z);
+    } else {
+      size_t fits = (n < size) ? size - n : 0;
+      while (fits != 0 && fits < z && (s[fits] & 0xc0) == 0x80) {
+        --fits;
+      }
+      memcpy(p + n, s, fits);
+      size = 0;
+    }
+    n += z;
+  }
+  void write(const char* b, size_t z) {
+    if (n + z <= size) {
+      memcpy(p + n, b, z);
+    } else {
+      size = 0; // full; only count from now on
+    }
+    n += z;
+  }
+  char*  p;
+  size_t size;
+  size_t n;
+};
+
+template <typename Sink, typename F>
+inline void _mapValidUTF8(Sink& out, const char* inI, const char* inE, F& fun) {
+  // Same as mapImp in text.cc, for input which is known to be valid UTF8
+  while (inI != inE) {
+    u32 uc = _nextValidUTF8(inI);
+    u32 mapped = fun(uc);
+    switch (mapped) {
+      case MapIgnore: {
+        break;
+      }
+      case MapIncludeAll: {
+        out.put(uc);
+        out.append(inI, inE);
+        return;
+      }
+      case MapIncludeRest: {
+        out.append(inI, inE);
+        return;
+      }
+      case MapIgnoreAll: {
+        return;
+      }
+      case MapIgnoreRest: {
+        out.put(uc);
+        return;
+      }
+      default: {
+        assert(mapped < _MapSpecialMin || mapped > _MapSpecialMax);
+        out.put(mapped);
+        break;
+      }
+    }
+  }
+}
+
+template <typename F>
+inline std::string map(const std::string& s, F fun) {
+  std::string outs;
+  mapInto(outs, s, std::move(fun));
+  return outs;
+}
+
+template <typename F>
+inline void mapInto(std::string& outs, View s, F fun) {
+  if (!isValidUTF8(s.data(), s.size())) {
+    // Let the non-inline version deal with (and report) the invalid input
+    return mapInto(outs, s, rx::func<u32(u32)>{std::move(fun)});
+  }
+  _StringSink sink{outs, s.size()};
+  _mapValidUTF8(sink, s.begin(), s.end(), fun);
+}
+
+template <typename F>
+inline size_t mapInto(char* out, size_t outsize, View s, F fun) {
+  _SpanSink sink{out, outsize};
+  if (!isValidUTF8(s.data(), s.size())) {
+    std::string tmp;
+    mapInto(tmp, s, rx::func<u32(u32)>{std::move(fun)});
+    sink.append(tmp.data(), tmp.data() + tmp.size());
+  } else {
+    _mapValidUTF8(sink, s.begin(), s.end(), fun);
+  }
+  return sink.n;
+}
+
+template <typename F>
+inline void filterInto(std::string& outs, View s, F f) {
+  mapInto(outs, s, [&](u32 c) -> u32 { return f(c) ? c : (u32)MapIgnore; });
+}
+
+template <typename F>
+inline size_t filterInto(char* out, size_t outsize, View s, F f) {
+  return mapInto(out, outsize, s, [&](u32 c) -> u32 { return f(c) ? c : (u32)MapIgnore; });
+}
+
+inline void normalizeInto(std::string& outs, View s) {
+  mapInto(outs, s, [](u32 c) { return normalize(c); });
+}
+
+inline size_t normalizeInto(char* out, size_t outsize, View s) {
+  return mapInto(out, outsize, s, [](u32 c) { return normalize(c); });
+}
+
+template <typename F>
+inline std::string filter(const std::string& s, F f) {
+  return map(s, [&](u32 c) -> u32 { return f(c) ? c : (u32)MapIgnore; });
+}
+
 }} // namespace
 
 inline std::ostream& operator<< (std::ostream& os, const ::rx::Text& v) {